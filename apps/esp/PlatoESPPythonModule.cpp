@@ -71,6 +71,14 @@ class SharedData {
     {
       aData = m_data;
     }
+    double* getSendBuffer()
+    {
+      return m_data.data();
+    }
+    const double* getRecvBuffer() const
+    {
+      return m_data.data();
+    }
     int size() const
     {
       return m_data.size();
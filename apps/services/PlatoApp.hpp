@@ -277,12 +277,11 @@ public:
 
             int tMyLength = tLocalData->getEpetraVector()->MyLength();
             assert(tMyLength == aImportData.size());
-            std::vector<double> tImportData(tMyLength);
-            aImportData.getData(tImportData);
 
             double* tDataView;
             tLocalData->getEpetraVector()->ExtractView(&tDataView);
-            std::copy(tImportData.begin(), tImportData.end(), tDataView);
+            const double* tImportView = aImportData.getRecvBuffer();
+            std::copy(tImportView, tImportView + tMyLength, tDataView);
 
             tLocalData->Import();
             tLocalData->DisAssemble();
@@ -298,10 +297,8 @@ public:
 
             assert(tMyLength == aImportData.size());
 
-            std::vector<double> tImportData(tMyLength);
-            aImportData.getData(tImportData);
-
-            std::copy(tImportData.begin(), tImportData.end(), tDataView);
+            const double* tImportView = aImportData.getRecvBuffer();
+            std::copy(tImportView, tImportView + tMyLength, tDataView);
         }
         else if(aImportData.myLayout() == Plato::data::layout_t::SCALAR)
         {
@@ -331,12 +328,8 @@ public:
             double* tDataView;
             tLocalData->getEpetraVector()->ExtractView(&tDataView);
 
-            int tMyLength = tLocalData->getEpetraVector()->MyLength();
-            assert(tMyLength == aExportData.size());
-            std::vector<double> tExportData(tMyLength);
-            std::copy(tDataView, tDataView + tMyLength, tExportData.begin());
-
-            aExportData.setData(tExportData);
+            assert(tLocalData->getEpetraVector()->MyLength() == aExportData.size());
+            aExportData.copyToSendBuffer(tDataView);
         }
         else if(aExportData.myLayout() == Plato::data::layout_t::ELEMENT_FIELD)
         {
@@ -345,13 +338,8 @@ public:
             auto dataContainer = mLightMp->getDataContainer();
             double* tDataView;
             dataContainer->getVariable(getElementField(aArgumentName), tDataView);
-            int tMyLength = mLightMp->getMesh()->getNumElems();
-
-            assert(tMyLength == aExportData.size());
-            std::vector<double> tExportData(tMyLength);
-            std::copy(tDataView, tDataView + tMyLength, tExportData.begin());
-
-            aExportData.setData(tExportData);
+            assert(mLightMp->getMesh()->getNumElems() == aExportData.size());
+            aExportData.copyToSendBuffer(tDataView);
         }
         else if(aExportData.myLayout() == Plato::data::layout_t::SCALAR)
         {
@@ -92,7 +92,9 @@ int main(int aArgc, char *aArgv[])
     feenableexcept(FE_DIVBYZERO | FE_INVALID | FE_OVERFLOW);
 #endif
 
-    MPI_Init(&aArgc, (char***) &aArgv);
+    // asynchronous iso-surface extraction communicates from a background thread
+    int tThreadSupport = MPI_THREAD_SINGLE;
+    MPI_Init_thread(&aArgc, (char***) &aArgv, MPI_THREAD_MULTIPLE, &tThreadSupport);
 
 #if defined(GEOMETRY) || defined(AMFILTER_ENABLED)
     Kokkos::initialize(aArgc, aArgv);
@@ -49,6 +49,8 @@
 
 #include <vector>
 #include <cmath>
+#include <chrono>
+#include <iostream>
 
 namespace PlatoSubproblemLibrary
 {
@@ -1433,6 +1435,116 @@ PSL_TEST(AMFilterUtilities, computeTetMeshPrintableDensity_manyElements)
         // printf("%.17e\n", tDensityVector.get_value(i));
         EXPECT_DOUBLE_EQ(tDensityVector.get_value(i), tGoldDensity[i]);
     }
+
+    // threaded grid and tet mesh sweeps match the serial ones
+    std::vector<double> tSerialGridPrintableDensity;
+    tAMFilterUtilities.computeGridPrintableDensity(tGridDensity,tSerialGridPrintableDensity);
+
+    tAMFilterUtilities.setNumThreads(4);
+    std::vector<double> tThreadedGridPrintableDensity;
+    tAMFilterUtilities.computeGridPrintableDensity(tGridDensity,tThreadedGridPrintableDensity);
+    ASSERT_EQ(tThreadedGridPrintableDensity.size(), tSerialGridPrintableDensity.size());
+    for(size_t i = 0; i < tSerialGridPrintableDensity.size(); ++i)
+    {
+        EXPECT_DOUBLE_EQ(tThreadedGridPrintableDensity[i], tSerialGridPrintableDensity[i]);
+    }
+
+    example::Interface_ParallelVector tThreadedDensityVector(tData);
+    tAMFilterUtilities.computeTetMeshPrintableDensity(tGridDensity,&tThreadedDensityVector);
+    ASSERT_EQ(tThreadedDensityVector.get_length(), tGoldDensity.size());
+    for(int i = 0; i < (int) tGoldDensity.size(); ++i)
+    {
+        EXPECT_DOUBLE_EQ(tThreadedDensityVector.get_value(i), tGoldDensity[i]);
+    }
+}
+
+static void computeReferenceGridPrintableDensity(const OrthogonalGridUtilities& aGridUtilities,
+                                                 const std::vector<double>& aGridBlueprintDensity,
+                                                 const double& aPNorm,
+                                                 std::vector<double>& aGridPrintableDensity)
+{
+    std::vector<size_t> tGridDimensions = aGridUtilities.getGridDimensions();
+    aGridPrintableDensity.assign(aGridBlueprintDensity.size(),0.0);
+    for(size_t k = 0; k < tGridDimensions[2]; ++k)
+    {
+        for(size_t i = 0; i < tGridDimensions[0]; ++i)
+        {
+            for(size_t j = 0; j < tGridDimensions[1]; ++j)
+            {
+                double tSupportDensity = 1.0;
+                if(k > 0)
+                {
+                    std::vector<double> tSupportDensities;
+                    for(auto tSupportIndex : aGridUtilities.getSupportIndices(i,j,k))
+                        tSupportDensities.push_back(aGridPrintableDensity[aGridUtilities.getSerializedIndex(tSupportIndex)]);
+                    tSupportDensity = smax(tSupportDensities,aPNorm);
+                }
+                size_t tSerializedIndex = aGridUtilities.getSerializedIndex(i,j,k);
+                aGridPrintableDensity[tSerializedIndex] = smin(aGridBlueprintDensity[tSerializedIndex],tSupportDensity);
+            }
+        }
+    }
+}
+
+PSL_TEST(AMFilterUtilities, computeGridPrintableDensityBenchmark)
+{
+    std::vector<std::vector<double>> tCoordinates;
+    std::vector<std::vector<int>> tConnectivity;
+
+    tCoordinates.push_back({0.0,0.0,0.0});
+    tCoordinates.push_back({1.0,0.0,0.0});
+    tCoordinates.push_back({0.0,1.0,0.0});
+    tCoordinates.push_back({0.0,0.0,1.0});
+
+    tConnectivity.push_back({0,1,2,3});
+
+    TetMeshUtilities tTetUtilities(tCoordinates,tConnectivity);
+
+    Vector tUBasisVector({1.0,0.0,0.0});
+    Vector tVBasisVector({0.0,1.0,0.0});
+    Vector tWBasisVector({0.0,0.0,1.0});
+
+    Vector tMaxUVWCoords({1.0,1.0,1.0});
+    Vector tMinUVWCoords({0.0,0.0,0.0});
+
+    double tPNorm = 200;
+
+    // the reference implementation is slow, so keep the grids small (at most 21^3 points)
+    for(double tTargetEdgeLength : {0.1, 0.05})
+    {
+        OrthogonalGridUtilities tGridUtilities(tUBasisVector,tVBasisVector,tWBasisVector,tMaxUVWCoords,tMinUVWCoords,tTargetEdgeLength);
+        std::vector<size_t> tGridDimensions = tGridUtilities.getGridDimensions();
+        size_t tGridSize = tGridDimensions[0]*tGridDimensions[1]*tGridDimensions[2];
+
+        std::vector<double> tGridBlueprintDensity(tGridSize);
+        for(size_t tIndex = 0; tIndex < tGridSize; ++tIndex)
+            tGridBlueprintDensity[tIndex] = 0.5 + 0.5*std::sin(0.37*tIndex);
+
+        std::chrono::steady_clock::time_point tStart = std::chrono::steady_clock::now();
+        std::vector<double> tGoldPrintableDensity;
+        computeReferenceGridPrintableDensity(tGridUtilities,tGridBlueprintDensity,tPNorm,tGoldPrintableDensity);
+        double tReferenceTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count();
+
+        std::cout << "Printable density of " << tGridSize << " grid points: reference " << tReferenceTime << "s";
+
+        AMFilterUtilities tAMFilterUtilities(tTetUtilities,tGridUtilities,tPNorm);
+        for(size_t tNumThreads : {1u, 4u})
+        {
+            tAMFilterUtilities.setNumThreads(tNumThreads);
+
+            tStart = std::chrono::steady_clock::now();
+            std::vector<double> tGridPrintableDensity;
+            tAMFilterUtilities.computeGridPrintableDensity(tGridBlueprintDensity,tGridPrintableDensity);
+            double tTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count();
+
+            ASSERT_EQ(tGridPrintableDensity.size(), tGoldPrintableDensity.size());
+            for(size_t tIndex = 0; tIndex < tGridSize; ++tIndex)
+                EXPECT_DOUBLE_EQ(tGridPrintableDensity[tIndex], tGoldPrintableDensity[tIndex]);
+
+            std::cout << ", " << tNumThreads << " thread(s) " << tTime << "s";
+        }
+        std::cout << std::endl;
+    }
 }
 
 PSL_TEST(AMFilterUtilities, smoothMax)
@@ -48,12 +48,16 @@
 #include "PSL_FreeHelpers.hpp"
 #include "PSL_Abstract_FixedRadiusNearestNeighborsSearcher.hpp"
 #include "PSL_RadixGridFixedRadiusNearestNeighbors.hpp"
+#include "PSL_HashedGridFixedRadiusNearestNeighbors.hpp"
 #include "PSL_BruteForceFixedRadiusNearestNeighbors.hpp"
 #include "PSL_SpatialSearcherFactory.hpp"
 #include "PSL_Random.hpp"
 
 #include <cstddef>
 #include <vector>
+#include <chrono>
+#include <iostream>
+#include <algorithm>
 
 namespace PlatoSubproblemLibrary
 {
@@ -64,6 +68,12 @@ namespace FixedRadiusNearestNeighborsSearchesTest
 void get_random_points_in_unit_cube(std::vector<PlatoSubproblemLibrary::Point>& test_points);
 void rigorous_search_comparison(AbstractInterface::FixedRadiusNearestNeighborsSearcher* searcher);
 void handle_zero_radius(spatial_searcher_t::spatial_searcher_t searcher_type);
+void batch_search_comparison(spatial_searcher_t::spatial_searcher_t searcher_type, size_t num_threads);
+double time_build_and_batch_search(spatial_searcher_t::spatial_searcher_t searcher_type,
+                                   size_t num_threads,
+                                   PlatoSubproblemLibrary::PointCloud* points,
+                                   double radius,
+                                   size_t& num_found);
 
 PSL_TEST(FixedRadiusNearestNeighborsSearches,simpleRadixGrid)
 {
@@ -199,6 +209,13 @@ PSL_TEST(FixedRadiusNearestNeighborsSearches,rigorousRadixGrid)
     rigorous_search_comparison(&searcher);
 }
 
+PSL_TEST(FixedRadiusNearestNeighborsSearches,rigorousHashedGrid)
+{
+    set_rand_seed();
+    HashedGridFixedRadiusNearestNeighbors searcher;
+    rigorous_search_comparison(&searcher);
+}
+
 PSL_TEST(FixedRadiusNearestNeighborsSearches,rigorousBruteForce)
 {
     set_rand_seed();
@@ -277,6 +294,185 @@ PSL_TEST(FixedRadiusNearestNeighborsSearches,handleZeroRadius_radixGridFixedRadi
     handle_zero_radius(spatial_searcher_t::spatial_searcher_t::radix_grid_fixed_radius_nearest_neighbors);
 }
 
+PSL_TEST(FixedRadiusNearestNeighborsSearches,handleZeroRadius_hashedGridFixedRadiusNearestNeighbors)
+{
+    set_rand_seed();
+    handle_zero_radius(spatial_searcher_t::spatial_searcher_t::hashed_grid_fixed_radius_nearest_neighbors);
+}
+
+PSL_TEST(FixedRadiusNearestNeighborsSearches,twoDimensionalPoints_hashedGridFixedRadiusNearestNeighbors)
+{
+    set_rand_seed();
+    // two dimensional points, compare to brute force
+    const size_t num_points = 200u;
+    const double radius = 0.15;
+
+    std::vector<Point> answer_points;
+    std::vector<Point> query_points;
+    for(size_t i = 0u; i < num_points; i++)
+    {
+        std::vector<double> answer_data = {uniform_rand_double(), uniform_rand_double()};
+        answer_points.push_back(PlatoSubproblemLibrary::Point(i, answer_data));
+        std::vector<double> query_data = {uniform_rand_double(), uniform_rand_double()};
+        query_points.push_back(PlatoSubproblemLibrary::Point(i, query_data));
+    }
+    PlatoSubproblemLibrary::PointCloud answer_cloud;
+    answer_cloud.assign(answer_points);
+
+    AbstractInterface::FixedRadiusNearestNeighborsSearcher* hashed_searcher =
+            build_fixed_radius_nearest_neighbors_searcher(spatial_searcher_t::hashed_grid_fixed_radius_nearest_neighbors, NULL);
+    hashed_searcher->build(&answer_cloud, radius);
+    BruteForceFixedRadiusNearestNeighbors brute_searcher;
+    brute_searcher.build(&answer_cloud, radius);
+
+    std::vector<size_t> hashed_results(num_points);
+    std::vector<size_t> brute_results(num_points);
+    for(size_t i = 0u; i < num_points; i++)
+    {
+        size_t num_hashed_results = 0u;
+        hashed_searcher->get_neighbors(&query_points[i], hashed_results, num_hashed_results);
+        size_t num_brute_results = 0u;
+        brute_searcher.get_neighbors(&query_points[i], brute_results, num_brute_results);
+
+        std::sort(&hashed_results[0], &hashed_results[num_hashed_results]);
+        std::sort(&brute_results[0], &brute_results[num_brute_results]);
+        ASSERT_EQ(num_hashed_results, num_brute_results);
+        for(size_t j = 0u; j < num_brute_results; j++)
+        {
+            EXPECT_EQ(hashed_results[j], brute_results[j]);
+        }
+    }
+
+    delete hashed_searcher;
+}
+
+void batch_search_comparison(spatial_searcher_t::spatial_searcher_t searcher_type, size_t num_threads)
+{
+    // compare batch queries to one query at a time
+    const size_t num_points = 2000;
+    const double radius = 0.1;
+
+    std::vector<Point> answer_points(num_points);
+    get_random_points_in_unit_cube(answer_points);
+    PlatoSubproblemLibrary::PointCloud answer_cloud;
+    answer_cloud.assign(answer_points);
+
+    std::vector<Point> query_points(num_points);
+    get_random_points_in_unit_cube(query_points);
+    PlatoSubproblemLibrary::PointCloud query_cloud;
+    query_cloud.assign(query_points);
+
+    AbstractInterface::FixedRadiusNearestNeighborsSearcher* searcher =
+            build_fixed_radius_nearest_neighbors_searcher(searcher_type, NULL);
+    searcher->set_num_threads(num_threads);
+    searcher->build(&answer_cloud, radius);
+
+    std::vector<size_t> offsets;
+    std::vector<size_t> neighbors;
+    searcher->get_neighbors_of_points(&query_cloud, 0u, num_points, num_points, offsets, neighbors);
+    ASSERT_EQ(offsets.size(), num_points + 1u);
+    EXPECT_EQ(offsets.back(), neighbors.size());
+
+    std::vector<size_t> results(num_points);
+    size_t num_results = 0u;
+    for(size_t i = 0; i < num_points; i++)
+    {
+        num_results = 0u;
+        searcher->get_neighbors(&query_points[i], results, num_results);
+        std::sort(&results[0], &results[num_results]);
+
+        std::vector<size_t> batch_results(neighbors.begin() + offsets[i], neighbors.begin() + offsets[i + 1u]);
+        std::sort(batch_results.begin(), batch_results.end());
+
+        ASSERT_EQ(batch_results.size(), num_results);
+        for(size_t j = 0; j < num_results; j++)
+        {
+            EXPECT_EQ(batch_results[j], results[j]);
+        }
+    }
+
+    // a sub-range of queries matches the same queries of the full batch
+    const size_t range_begin = num_points / 3u;
+    const size_t range_end = 2u * num_points / 3u;
+    std::vector<size_t> range_offsets;
+    std::vector<size_t> range_neighbors;
+    searcher->get_neighbors_of_points(&query_cloud, range_begin, range_end, num_points, range_offsets, range_neighbors);
+    ASSERT_EQ(range_offsets.size(), range_end - range_begin + 1u);
+    for(size_t i = range_begin; i < range_end; i++)
+    {
+        std::vector<size_t> range_results(range_neighbors.begin() + range_offsets[i - range_begin],
+                                          range_neighbors.begin() + range_offsets[i - range_begin + 1u]);
+        std::vector<size_t> batch_results(neighbors.begin() + offsets[i], neighbors.begin() + offsets[i + 1u]);
+        std::sort(range_results.begin(), range_results.end());
+        std::sort(batch_results.begin(), batch_results.end());
+        EXPECT_EQ(range_results, batch_results);
+    }
+
+    delete searcher;
+}
+
+PSL_TEST(FixedRadiusNearestNeighborsSearches,batchQueries_radixGridFixedRadiusNearestNeighbors)
+{
+    set_rand_seed();
+    batch_search_comparison(spatial_searcher_t::spatial_searcher_t::radix_grid_fixed_radius_nearest_neighbors, 1u);
+}
+
+PSL_TEST(FixedRadiusNearestNeighborsSearches,batchQueries_hashedGridFixedRadiusNearestNeighbors)
+{
+    set_rand_seed();
+    batch_search_comparison(spatial_searcher_t::spatial_searcher_t::hashed_grid_fixed_radius_nearest_neighbors, 1u);
+    batch_search_comparison(spatial_searcher_t::spatial_searcher_t::hashed_grid_fixed_radius_nearest_neighbors, 4u);
+}
+
+double time_build_and_batch_search(spatial_searcher_t::spatial_searcher_t searcher_type,
+                                   size_t num_threads,
+                                   PlatoSubproblemLibrary::PointCloud* points,
+                                   double radius,
+                                   size_t& num_found)
+{
+    AbstractInterface::FixedRadiusNearestNeighborsSearcher* searcher =
+            build_fixed_radius_nearest_neighbors_searcher(searcher_type, NULL);
+    searcher->set_num_threads(num_threads);
+
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    std::vector<size_t> offsets;
+    std::vector<size_t> neighbors;
+    searcher->build(points, radius);
+    searcher->get_neighbors_of_points(points, 0u, points->get_num_points(), points->get_num_points(), offsets, neighbors);
+    const std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+
+    num_found = neighbors.size();
+    delete searcher;
+    return std::chrono::duration<double>(stop - start).count();
+}
+
+PSL_TEST(FixedRadiusNearestNeighborsSearches,buildAndSearchBenchmark)
+{
+    set_rand_seed();
+    const size_t num_points = 50000;
+    const double radius = 0.03;
+
+    std::vector<Point> points(num_points);
+    get_random_points_in_unit_cube(points);
+    PlatoSubproblemLibrary::PointCloud point_cloud;
+    point_cloud.assign(points);
+
+    size_t num_radix_found = 0u;
+    size_t num_hashed_found = 0u;
+    size_t num_threaded_found = 0u;
+    const double radix_time = time_build_and_batch_search(spatial_searcher_t::radix_grid_fixed_radius_nearest_neighbors,
+                                                          1u, &point_cloud, radius, num_radix_found);
+    const double hashed_time = time_build_and_batch_search(spatial_searcher_t::hashed_grid_fixed_radius_nearest_neighbors,
+                                                           1u, &point_cloud, radius, num_hashed_found);
+    const double threaded_time = time_build_and_batch_search(spatial_searcher_t::hashed_grid_fixed_radius_nearest_neighbors,
+                                                             4u, &point_cloud, radius, num_threaded_found);
+    EXPECT_EQ(num_radix_found, num_hashed_found);
+    EXPECT_EQ(num_radix_found, num_threaded_found);
+
+    std::cout << "Fixed radius search of " << num_points << " points: radix grid " << radix_time << "s, hashed grid "
+              << hashed_time << "s, hashed grid with 4 threads " << threaded_time << "s" << std::endl;
+}
+
 }
 
 }
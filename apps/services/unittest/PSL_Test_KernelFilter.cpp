@@ -77,6 +77,8 @@
 #include <string>
 #include <cstddef>
 #include <sstream>
+#include <cmath>
+#include <algorithm>
 
 namespace PlatoSubproblemLibrary
 {
@@ -1136,6 +1138,166 @@ PSL_TEST(KernelFilter,consistentExchangers)
     EXPECT_GT(parallel_error_tolerance, global_max_error);
 }
 
+PSL_TEST(KernelFilter,strongScalingBenchmark)
+{
+    set_rand_seed();
+    AbstractAuthority authority;
+
+    const size_t mpi_rank = authority.mpi_wrapper->get_rank();
+    const size_t mpi_size = authority.mpi_wrapper->get_size();
+
+    // fixed global problem, divided among a cube of processors
+    const size_t global_num_intervals = 24u;
+    const double global_dist = 1.;
+    const size_t parallel_cube_dimension = std::ceil(std::pow(mpi_size, 1. / 3.));
+    const size_t local_num_intervals = std::max(size_t(1u), global_num_intervals / parallel_cube_dimension);
+    const size_t local_len = local_num_intervals + 1u;
+    const double local_dist = global_dist / parallel_cube_dimension;
+    example::ElementBlock modular_block;
+    modular_block.build_from_structured_grid(local_len, local_len, local_len,
+                                             local_dist, local_dist, local_dist,
+                                             mpi_rank, mpi_size);
+    example::Interface_MeshModular modular_interface;
+    modular_interface.set_mesh(&modular_block);
+
+    // input data
+    ParameterData input_data;
+    input_data.set_absolute(3.5 * global_dist / global_num_intervals);
+    input_data.set_iterations(2);
+    input_data.set_penalty(1.);
+    input_data.set_node_resolution_tolerance(1e-6);
+    input_data.set_spatial_searcher(spatial_searcher_t::recommended);
+    input_data.set_normalization(normalization_t::classical_row_normalization);
+    input_data.set_reproduction(reproduction_level_t::reproduce_constant);
+    input_data.set_matrix_assembly_agent(matrix_assembly_agent_t::by_row);
+    input_data.set_symmetry_plane_agent(symmetry_plane_agent_t::by_narrow_clone);
+    input_data.set_mesh_scale_agent(mesh_scale_agent_t::by_average_optimized_element_side);
+    input_data.set_matrix_normalization_agent(matrix_normalization_agent_t::default_agent);
+    input_data.set_point_ghosting_agent(point_ghosting_agent_t::by_narrow_share);
+    input_data.set_bounded_support_function(bounded_support_function_t::polynomial_tent_function);
+
+    // parallel exchanger
+    example::Interface_ParallelExchanger_localAndNonlocal exchanger(&authority);
+    std::vector<std::vector<std::pair<size_t, size_t> > > shared_node_data;
+    modular_block.get_shared_node_data(shared_node_data);
+    exchanger.put_shared_pairs(shared_node_data);
+    const size_t local_num_nodes = modular_block.get_num_nodes();
+    exchanger.put_num_local_locations(local_num_nodes);
+    exchanger.build();
+
+    // parallel consistent field
+    std::vector<size_t> global_ids;
+    modular_block.get_global_ids(global_ids);
+    std::vector<double> field(local_num_nodes);
+    for(size_t local_point = 0; local_point < local_num_nodes; local_point++)
+    {
+        field[local_point] = 2.4 / (0.13 + 0.41 * (global_ids[local_point] % 5u));
+    }
+    example::Interface_ParallelVector field_vector(field);
+    example::Interface_ParallelVector gradient_vector(field);
+
+    KernelFilter kernel_filter(&authority, &input_data, &modular_interface, &exchanger);
+    kernel_filter.build();
+
+    // time repeated applies
+    const size_t num_applies = 10u;
+    const double start_time = authority.mpi_wrapper->get_time();
+    for(size_t apply = 0u; apply < num_applies; apply++)
+    {
+        kernel_filter.apply(&field_vector);
+        kernel_filter.apply(&field_vector, &gradient_vector);
+    }
+    double local_elapsed = authority.mpi_wrapper->get_time() - start_time;
+    double global_elapsed = 0.;
+    authority.mpi_wrapper->all_reduce_max(local_elapsed, global_elapsed);
+
+    std::stringstream stream;
+    stream << "KernelFilter strong scaling: processors=" << mpi_size
+           << ", applies=" << 2u * num_applies
+           << ", seconds=" << global_elapsed
+           << ", seconds per apply=" << global_elapsed / (2u * num_applies) << "\n";
+    if(authority.mpi_wrapper->is_root())
+    {
+        authority.utilities->print(stream.str());
+    }
+
+    // check parallel errors
+    const double parallel_error_tolerance = 1e-10;
+    EXPECT_GT(parallel_error_tolerance, exchanger.get_maximum_absolute_parallel_error(&field_vector));
+    EXPECT_GT(parallel_error_tolerance, exchanger.get_maximum_absolute_parallel_error(&gradient_vector));
+}
+
+PSL_TEST(KernelFilter,buildBenchmark)
+{
+    set_rand_seed();
+    AbstractAuthority authority;
+
+    const size_t mpi_rank = authority.mpi_wrapper->get_rank();
+    const size_t mpi_size = authority.mpi_wrapper->get_size();
+
+    // build mesh
+    const size_t num_nodes_per_side = 41u;
+    const double dist = 1.;
+    example::ElementBlock modular_block;
+    modular_block.build_from_structured_grid(num_nodes_per_side, num_nodes_per_side, num_nodes_per_side,
+                                             dist, dist, dist,
+                                             mpi_rank, mpi_size);
+    example::Interface_MeshModular modular_interface;
+    modular_interface.set_mesh(&modular_block);
+
+    // input data
+    ParameterData input_data;
+    input_data.set_absolute(2.5 * dist / (num_nodes_per_side - 1u));
+    input_data.set_iterations(1);
+    input_data.set_penalty(1.);
+    input_data.set_node_resolution_tolerance(1e-6);
+    input_data.set_spatial_searcher(spatial_searcher_t::recommended);
+    input_data.set_normalization(normalization_t::classical_row_normalization);
+    input_data.set_reproduction(reproduction_level_t::reproduce_constant);
+    input_data.set_matrix_assembly_agent(matrix_assembly_agent_t::by_row);
+    input_data.set_symmetry_plane_agent(symmetry_plane_agent_t::by_narrow_clone);
+    input_data.set_mesh_scale_agent(mesh_scale_agent_t::by_average_optimized_element_side);
+    input_data.set_matrix_normalization_agent(matrix_normalization_agent_t::default_agent);
+    input_data.set_point_ghosting_agent(point_ghosting_agent_t::by_narrow_share);
+    input_data.set_bounded_support_function(bounded_support_function_t::polynomial_tent_function);
+
+    // parallel exchanger
+    example::Interface_ParallelExchanger_localAndNonlocal exchanger(&authority);
+    std::vector<std::vector<std::pair<size_t, size_t> > > shared_node_data;
+    modular_block.get_shared_node_data(shared_node_data);
+    exchanger.put_shared_pairs(shared_node_data);
+    exchanger.put_num_local_locations(modular_block.get_num_nodes());
+    exchanger.build();
+
+    // time the filter build
+    KernelFilter kernel_filter(&authority, &input_data, &modular_interface, &exchanger);
+    const double start_time = authority.mpi_wrapper->get_time();
+    kernel_filter.build();
+    double local_elapsed = authority.mpi_wrapper->get_time() - start_time;
+    double global_elapsed = 0.;
+    authority.mpi_wrapper->all_reduce_max(local_elapsed, global_elapsed);
+
+    std::stringstream stream;
+    stream << "KernelFilter build: processors=" << mpi_size
+           << ", nodes per processor=" << modular_block.get_num_nodes()
+           << ", seconds=" << global_elapsed << "\n";
+    if(authority.mpi_wrapper->is_root())
+    {
+        authority.utilities->print(stream.str());
+    }
+
+    // a built filter with row normalization reproduces a constant field
+    const double constant_field_value = 0.7;
+    std::vector<double> field_data(modular_block.get_num_nodes(), constant_field_value);
+    example::Interface_ParallelVector field(field_data);
+    kernel_filter.apply(&field);
+    ASSERT_EQ(field.get_length(), modular_block.get_num_nodes());
+    for(size_t node = 0u; node < field.get_length(); node++)
+    {
+        EXPECT_NEAR(field.get_value(node), constant_field_value, 1e-10);
+    }
+}
+
 }
 
 }
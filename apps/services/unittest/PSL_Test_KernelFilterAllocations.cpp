@@ -0,0 +1,135 @@
+/*
+ * PSL_Test_KernelFilterAllocations.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+// This test replaces the global operator new, so it is linked into its own
+// executable (PlatoAllocationsUnitTester) rather than PlatoMainUnitTester.
+
+#include "PSL_UnitTestingHelper.hpp"
+
+#include "PSL_Implementation_MeshModular.hpp"
+#include "PSL_Interface_MeshModular.hpp"
+#include "PSL_Abstract_MpiWrapper.hpp"
+#include "PSL_KernelFilter.hpp"
+#include "PSL_ParameterData.hpp"
+#include "PSL_Interface_ParallelVector.hpp"
+#include "PSL_Interface_ParallelExchanger_localAndNonlocal.hpp"
+#include "PSL_Random.hpp"
+#include "PSL_AbstractAuthority.hpp"
+
+#include <vector>
+#include <utility>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+// heap allocation counter, used to check that repeated filter applies do not allocate
+namespace TestingKernelFilterAllocations
+{
+bool g_is_counting = false;
+size_t g_num_allocations = 0u;
+}
+
+void* operator new(std::size_t size)
+{
+    if(TestingKernelFilterAllocations::g_is_counting)
+    {
+        TestingKernelFilterAllocations::g_num_allocations++;
+    }
+    void* result = std::malloc(size == 0u ? 1u : size);
+    if(!result)
+    {
+        throw std::bad_alloc();
+    }
+    return result;
+}
+
+void operator delete(void* pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+    std::free(pointer);
+}
+
+namespace PlatoSubproblemLibrary
+{
+namespace TestingKernelFilter
+{
+
+PSL_TEST(KernelFilter,repeatedAppliesDoNotAllocate)
+{
+    set_rand_seed();
+    AbstractAuthority authority;
+
+    const size_t mpi_rank = authority.mpi_wrapper->get_rank();
+    const size_t mpi_size = authority.mpi_wrapper->get_size();
+
+    // build mesh
+    const size_t xlen = 4;
+    const size_t ylen = 5;
+    const size_t zlen = 6;
+    const double xdist = 1.;
+    const double ydist = 1.;
+    const double zdist = 1.;
+    example::ElementBlock modular_block;
+    modular_block.build_from_structured_grid(xlen, ylen, zlen, xdist, ydist, zdist, mpi_rank, mpi_size);
+    example::Interface_MeshModular modular_interface;
+    modular_interface.set_mesh(&modular_block);
+
+    // input data
+    ParameterData input_data;
+    input_data.set_absolute(0.6);
+    input_data.set_iterations(1);
+    input_data.set_penalty(1.);
+    input_data.set_node_resolution_tolerance(1e-6);
+    input_data.set_spatial_searcher(spatial_searcher_t::recommended);
+    input_data.set_normalization(normalization_t::classical_row_normalization);
+    input_data.set_reproduction(reproduction_level_t::reproduce_constant);
+    input_data.set_matrix_assembly_agent(matrix_assembly_agent_t::by_row);
+    input_data.set_symmetry_plane_agent(symmetry_plane_agent_t::by_narrow_clone);
+    input_data.set_mesh_scale_agent(mesh_scale_agent_t::by_average_optimized_element_side);
+    input_data.set_matrix_normalization_agent(matrix_normalization_agent_t::default_agent);
+    input_data.set_point_ghosting_agent(point_ghosting_agent_t::by_narrow_share);
+    input_data.set_bounded_support_function(bounded_support_function_t::polynomial_tent_function);
+
+    // parallel exchanger
+    example::Interface_ParallelExchanger_localAndNonlocal exchanger(&authority);
+    std::vector<std::vector<std::pair<size_t, size_t> > > shared_node_data;
+    modular_block.get_shared_node_data(shared_node_data);
+    exchanger.put_shared_pairs(shared_node_data);
+    const size_t local_num_nodes = modular_block.get_num_nodes();
+    exchanger.put_num_local_locations(local_num_nodes);
+    exchanger.build();
+
+    std::vector<double> field(local_num_nodes, 0.5);
+    example::Interface_ParallelVector field_vector(field);
+
+    KernelFilter kernel_filter(&authority, &input_data, &modular_interface, &exchanger);
+    kernel_filter.build();
+    std::vector<double> field_at_kernel_points = kernel_filter.internal_get_field_at_kernel_points(&field_vector);
+
+    // warm up, then count allocations; only the returned vector may allocate regardless of iterations
+    for(int transpose = 0; transpose < 2; transpose++)
+    {
+        for(int iterations = 1; iterations <= 4; iterations += 3)
+        {
+            input_data.set_iterations(iterations);
+            kernel_filter.internal_parallel_matvec_apply(field_at_kernel_points, transpose);
+
+            TestingKernelFilterAllocations::g_num_allocations = 0u;
+            TestingKernelFilterAllocations::g_is_counting = true;
+            std::vector<double> output = kernel_filter.internal_parallel_matvec_apply(field_at_kernel_points, transpose);
+            TestingKernelFilterAllocations::g_is_counting = false;
+            EXPECT_EQ(1u, TestingKernelFilterAllocations::g_num_allocations);
+            EXPECT_EQ(field_at_kernel_points.size(), output.size());
+        }
+    }
+}
+
+}
+}
@@ -186,6 +186,40 @@ PSL_TEST(MpiWrapperInterface,send_and_recv_double)
     EXPECT_FLOAT_EQ(receive_data[2], double(recv_rank*some_constant));
 }
 
+PSL_TEST(MpiWrapperInterface,isend_and_ireceive_double)
+{
+    set_rand_seed();
+    MpiWrapperInterfaceTest_AllocateUtilities
+
+    const size_t rank = mpi_wrapper->get_rank();
+    const size_t size = mpi_wrapper->get_size();
+
+    // exchange with both neighbors at once; no ordering required
+    const size_t up_rank = (int(rank) + 1) % size;
+    const size_t down_rank = (int(size + rank) - 1) % size;
+
+    const double some_constant = 7.31;
+    const size_t expected_data_size = 3u;
+
+    std::vector<double> send_data = {some_constant, double(rank), double(some_constant * rank)};
+    std::vector<double> receive_from_down(expected_data_size);
+    std::vector<double> receive_from_up(expected_data_size);
+
+    mpi_wrapper->ireceive(down_rank, receive_from_down);
+    mpi_wrapper->ireceive(up_rank, receive_from_up);
+    mpi_wrapper->isend(up_rank, send_data);
+    mpi_wrapper->isend(down_rank, send_data);
+    mpi_wrapper->wait_all();
+
+    // check
+    EXPECT_FLOAT_EQ(receive_from_down[0], some_constant);
+    EXPECT_FLOAT_EQ(receive_from_down[1], double(down_rank));
+    EXPECT_FLOAT_EQ(receive_from_down[2], double(down_rank*some_constant));
+    EXPECT_FLOAT_EQ(receive_from_up[0], some_constant);
+    EXPECT_FLOAT_EQ(receive_from_up[1], double(up_rank));
+    EXPECT_FLOAT_EQ(receive_from_up[2], double(up_rank*some_constant));
+}
+
 PSL_TEST(MpiWrapperInterface,allgather_int)
 {
     set_rand_seed();
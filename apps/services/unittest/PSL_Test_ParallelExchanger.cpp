@@ -408,15 +408,15 @@ void test_rigorous_shared_node_data(AbstractInterface::MpiWrapper* mpi_wrapper,
         // for each local node
         for(size_t local_index = 0u; local_index < local_num_nodes; local_index++)
         {
-            Point* local_point = local_point_cloud->get_point(local_index);
+            Point local_point = local_point_cloud->get_point(local_index);
 
             // for each nonlocal node
             for(size_t nonlocal_index = 0; nonlocal_index < nonlocal_num_nodes; nonlocal_index++)
             {
-                Point* nonlocal_point = nonlocal_point_cloud->get_point(nonlocal_index);
+                Point nonlocal_point = nonlocal_point_cloud->get_point(nonlocal_index);
 
                 // if distance less than threshold, assume same point
-                const double distance = local_point->distance(nonlocal_point);
+                const double distance = local_point.distance(&nonlocal_point);
                 if(distance < epsilon)
                 {
                     local_and_nonlocal_pairs.push_back(std::make_pair(local_index, nonlocal_index));
@@ -497,15 +497,15 @@ void test_rigorous_global_ids(AbstractInterface::MpiWrapper* mpi_wrapper,
         // for each local node
         for(size_t local_index = 0u; local_index < local_num_nodes; local_index++)
         {
-            Point* local_point = local_point_cloud->get_point(local_index);
+            Point local_point = local_point_cloud->get_point(local_index);
 
             // for each nonlocal node
             for(size_t nonlocal_index = 0; nonlocal_index < nonlocal_num_nodes; nonlocal_index++)
             {
-                Point* nonlocal_point = nonlocal_point_cloud->get_point(nonlocal_index);
+                Point nonlocal_point = nonlocal_point_cloud->get_point(nonlocal_index);
 
                 // if distance less than threshold, same point
-                const double distance = local_point->distance(nonlocal_point);
+                const double distance = local_point.distance(&nonlocal_point);
                 if(distance < epsilon)
                 {
                     // check global matching
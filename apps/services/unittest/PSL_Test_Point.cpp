@@ -44,10 +44,12 @@
 #include "PSL_UnitTestingHelper.hpp"
 
 #include "PSL_Point.hpp"
+#include "PSL_PointCloud.hpp"
 #include "PSL_FreeHelpers.hpp"
 #include "PSL_Random.hpp"
 
 #include <vector>
+#include <stdexcept>
 
 namespace PlatoSubproblemLibrary
 {
@@ -102,5 +104,19 @@ PSL_TEST(Point,charSet)
     EXPECT_EQ(p(2),xyz_floats[2]);
 }
 
+PSL_TEST(Point,pointCloudDimension)
+{
+    // lower dimensional points are padded with zeros
+    PointCloud cloud;
+    cloud.push_back(Point(7u, {0.5, -0.25}));
+    EXPECT_EQ(cloud.get_point(0u).dimension(), 2u);
+    EXPECT_EQ(cloud.get_index(0u), 7u);
+    EXPECT_EQ(cloud.get_coordinate(0u, 1u), -0.25);
+    EXPECT_EQ(cloud.get_coordinate(0u, 2u), 0.0);
+
+    // the packed storage holds at most three coordinates per point
+    EXPECT_THROW(cloud.push_back(Point(8u, {0.1, 0.2, 0.3, 0.4})), std::length_error);
+}
+
 }
 }
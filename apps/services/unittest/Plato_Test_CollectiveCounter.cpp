@@ -0,0 +1,55 @@
+/*
+ * Plato_Test_CollectiveCounter.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <mpi.h>
+
+#include "Plato_Test_CollectiveCounter.hpp"
+
+namespace PlatoTestCollectives
+{
+bool gIsCounting = false;
+int gNumCollectives = 0;
+}
+
+// intercept collectives through the MPI profiling interface (PMPI)
+extern "C"
+{
+int MPI_Bcast(void *aBuffer, int aCount, MPI_Datatype aType, int aRoot, MPI_Comm aComm)
+{
+    PlatoTestCollectives::count();
+    return PMPI_Bcast(aBuffer, aCount, aType, aRoot, aComm);
+}
+
+int MPI_Reduce(const void *aSend, void *aRecv, int aCount, MPI_Datatype aType, MPI_Op aOp, int aRoot, MPI_Comm aComm)
+{
+    PlatoTestCollectives::count();
+    return PMPI_Reduce(aSend, aRecv, aCount, aType, aOp, aRoot, aComm);
+}
+
+int MPI_Allreduce(const void *aSend, void *aRecv, int aCount, MPI_Datatype aType, MPI_Op aOp, MPI_Comm aComm)
+{
+    PlatoTestCollectives::count();
+    return PMPI_Allreduce(aSend, aRecv, aCount, aType, aOp, aComm);
+}
+
+int MPI_Ibcast(void *aBuffer, int aCount, MPI_Datatype aType, int aRoot, MPI_Comm aComm, MPI_Request *aRequest)
+{
+    PlatoTestCollectives::count();
+    return PMPI_Ibcast(aBuffer, aCount, aType, aRoot, aComm, aRequest);
+}
+
+int MPI_Iallreduce(const void *aSend, void *aRecv, int aCount, MPI_Datatype aType, MPI_Op aOp, MPI_Comm aComm, MPI_Request *aRequest)
+{
+    PlatoTestCollectives::count();
+    return PMPI_Iallreduce(aSend, aRecv, aCount, aType, aOp, aComm, aRequest);
+}
+
+int MPI_Comm_split(MPI_Comm aComm, int aColor, int aKey, MPI_Comm *aNewComm)
+{
+    PlatoTestCollectives::count();
+    return PMPI_Comm_split(aComm, aColor, aKey, aNewComm);
+}
+}
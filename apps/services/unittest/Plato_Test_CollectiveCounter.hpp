@@ -0,0 +1,39 @@
+/*
+ * Plato_Test_CollectiveCounter.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#pragma once
+
+/******************************************************************************//**
+ * \brief Collective counters used to benchmark the number of collectives issued
+ * by a code section. The MPI profiling interface (PMPI) wrappers that increment
+ * the counters are defined in Plato_Test_CollectiveCounter.cpp, which is only
+ * linked into PlatoCollectivesUnitTester so other unit tests call MPI directly.
+**********************************************************************************/
+namespace PlatoTestCollectives
+{
+extern bool gIsCounting;
+extern int gNumCollectives;
+
+inline void count()
+{
+    if(gIsCounting)
+    {
+        gNumCollectives++;
+    }
+}
+
+inline void start()
+{
+    gNumCollectives = 0;
+    gIsCounting = true;
+}
+
+inline int stop()
+{
+    gIsCounting = false;
+    return gNumCollectives;
+}
+}
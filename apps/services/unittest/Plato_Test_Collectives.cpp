@@ -0,0 +1,194 @@
+/*
+ * Plato_Test_Collectives.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <gtest/gtest.h>
+
+#include <mpi.h>
+
+#include <cmath>
+#include <vector>
+#include <memory>
+
+#include "Plato_Test_CollectiveCounter.hpp"
+
+#include "Plato_DataFactory.hpp"
+#include "Plato_LinearAlgebra.hpp"
+#include "Plato_StandardVector.hpp"
+#include "Plato_DistributedVector.hpp"
+#include "Plato_DeferredReductions.hpp"
+#include "Plato_OptimalityCriteriaDataMng.hpp"
+#include "Plato_DistributedReductionOperations.hpp"
+#include "Plato_StandardVectorReductionOperations.hpp"
+
+namespace PlatoTest
+{
+
+TEST(PlatoTest, DeferredReductions)
+{
+    int tMyRank = 0;
+    MPI_Comm_rank(MPI_COMM_WORLD, &tMyRank);
+    const double tShift = tMyRank;
+    std::vector<double> tDataOne = { 1 + tShift, -2, 3, 4, 5 };
+    std::vector<double> tDataTwo = { 2, 2, 2, 2, -1 - tShift };
+    Plato::DistributedVector<double, size_t> tVectorOne(MPI_COMM_WORLD, tDataOne);
+    Plato::DistributedVector<double, size_t> tVectorTwo(MPI_COMM_WORLD, tDataTwo);
+    Plato::DistributedReductionOperations<double, size_t> tReductionOperations;
+
+    // one collective per reduction
+    PlatoTestCollectives::start();
+    const double tGoldSum = tReductionOperations.sum(tVectorOne);
+    const double tGoldDot = tVectorOne.dot(tVectorTwo);
+    const double tGoldMax = tReductionOperations.max(tVectorOne);
+    const double tGoldMin = tReductionOperations.min(tVectorTwo);
+    const int tNumIndividualCollectives = PlatoTestCollectives::stop();
+
+    // one collective for all queued reductions
+    Plato::DeferredReductions<double, size_t> tReductions(tReductionOperations);
+    PlatoTestCollectives::start();
+    const size_t tSumHandle = tReductions.addSum(tVectorOne);
+    const size_t tDotHandle = tReductions.addDot(tVectorOne, tVectorTwo);
+    const size_t tMaxHandle = tReductions.addMax(tVectorOne);
+    const size_t tMinHandle = tReductions.addMin(tVectorTwo);
+    const size_t tRankHandle = tReductions.addLocalMax(tShift);
+    tReductions.evaluate();
+    const int tNumDeferredCollectives = PlatoTestCollectives::stop();
+
+    const double tTolerance = 1e-12;
+    EXPECT_EQ(5u, tReductions.size());
+    EXPECT_NEAR(tGoldSum, tReductions.get(tSumHandle), tTolerance);
+    EXPECT_NEAR(tGoldDot, tReductions.get(tDotHandle), tTolerance);
+    EXPECT_NEAR(tGoldMax, tReductions.get(tMaxHandle), tTolerance);
+    EXPECT_NEAR(tGoldMin, tReductions.get(tMinHandle), tTolerance);
+    int tNumRanks = 0;
+    MPI_Comm_size(MPI_COMM_WORLD, &tNumRanks);
+    EXPECT_NEAR(static_cast<double>(tNumRanks - 1), tReductions.get(tRankHandle), tTolerance);
+
+    EXPECT_EQ(4, tNumIndividualCollectives);
+    EXPECT_EQ(1, tNumDeferredCollectives);
+
+    // serial reductions need no collective at all
+    Plato::StandardVector<double, size_t> tStandardVector(tDataOne);
+    Plato::StandardVectorReductionOperations<double, size_t> tStandardOperations;
+    Plato::DeferredReductions<double, size_t> tStandardReductions(tStandardOperations);
+    const size_t tStandardMaxHandle = tStandardReductions.addMax(tStandardVector);
+    const size_t tStandardDotHandle = tStandardReductions.addDot(tStandardVector, tStandardVector);
+    tStandardReductions.evaluate();
+    EXPECT_NEAR(tStandardOperations.max(tStandardVector), tStandardReductions.get(tStandardMaxHandle), tTolerance);
+    EXPECT_NEAR(tStandardVector.dot(tStandardVector), tStandardReductions.get(tStandardDotHandle), tTolerance);
+}
+
+TEST(PlatoTest, DeferredReductions_AddAfterEvaluate)
+{
+    int tMyRank = 0;
+    int tNumRanks = 0;
+    MPI_Comm_rank(MPI_COMM_WORLD, &tMyRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &tNumRanks);
+    Plato::DistributedReductionOperations<double, size_t> tReductionOperations;
+    Plato::DeferredReductions<double, size_t> tReductions(tReductionOperations);
+
+    // first phase
+    const double tTolerance = 1e-12;
+    const size_t tSumHandle = tReductions.addLocalSum(1.0);
+    const size_t tMaxHandle = tReductions.addLocalMax(static_cast<double>(tMyRank));
+    tReductions.evaluate();
+    EXPECT_NEAR(static_cast<double>(tNumRanks), tReductions.get(tSumHandle), tTolerance);
+    EXPECT_NEAR(static_cast<double>(tNumRanks - 1), tReductions.get(tMaxHandle), tTolerance);
+
+    // second phase: earlier results are not reduced a second time
+    const size_t tSecondSumHandle = tReductions.addLocalSum(2.0);
+    const size_t tMinHandle = tReductions.addLocalMin(static_cast<double>(tMyRank));
+    tReductions.evaluate();
+    EXPECT_NEAR(static_cast<double>(tNumRanks), tReductions.get(tSumHandle), tTolerance);
+    EXPECT_NEAR(static_cast<double>(tNumRanks - 1), tReductions.get(tMaxHandle), tTolerance);
+    EXPECT_NEAR(2.0 * tNumRanks, tReductions.get(tSecondSumHandle), tTolerance);
+    EXPECT_NEAR(0.0, tReductions.get(tMinHandle), tTolerance);
+
+    // a repeated evaluate leaves the results unchanged
+    tReductions.evaluate();
+    EXPECT_NEAR(static_cast<double>(tNumRanks), tReductions.get(tSumHandle), tTolerance);
+}
+
+TEST(PlatoTest, DistributedReductionOperations_RepeatedPackedReduce)
+{
+    int tMyRank = 0;
+    int tNumRanks = 0;
+    MPI_Comm_rank(MPI_COMM_WORLD, &tMyRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &tNumRanks);
+    Plato::DistributedReductionOperations<double, size_t> tReductionOperations;
+
+    // the cached operation and type serve repeated calls and follow changes of the buffer length
+    const double tTolerance = 1e-12;
+    const std::vector<size_t> tNumSums = { 2, 2, 3, 1 };
+    for(size_t tCall = 0; tCall < tNumSums.size(); tCall++)
+    {
+        std::vector<double> tSums(tNumSums[tCall], 1.0 + tCall);
+        std::vector<double> tMaxes = { static_cast<double>(tMyRank), -static_cast<double>(tMyRank) };
+        tReductionOperations.reduce(tSums, tMaxes);
+        for(size_t tIndex = 0; tIndex < tSums.size(); tIndex++)
+        {
+            EXPECT_NEAR(tNumRanks * (1.0 + tCall), tSums[tIndex], tTolerance);
+        }
+        EXPECT_NEAR(static_cast<double>(tNumRanks - 1), tMaxes[0], tTolerance);
+        EXPECT_NEAR(0.0, tMaxes[1], tTolerance);
+    }
+}
+
+TEST(PlatoTest, OptimalityCriteriaDataMng_CollectivesPerIteration)
+{
+    // ********* Allocate Distributed Optimization Data Templates *********
+    std::shared_ptr<Plato::DataFactory<double>> tFactory = std::make_shared<Plato::DataFactory<double>>();
+    const size_t tNumDual = 1;
+    const size_t tNumVectors = 3;
+    const size_t tNumControls = 1000;
+    tFactory->allocateDual(tNumDual);
+    Plato::DistributedVector<double> tControlTemplate(MPI_COMM_WORLD, tNumControls);
+    tFactory->allocateControl(tControlTemplate, tNumVectors);
+    Plato::DistributedReductionOperations<double> tReductions(MPI_COMM_WORLD);
+    tFactory->allocateControlReductionOperations(tReductions);
+
+    Plato::OptimalityCriteriaDataMng<double> tDataMng(tFactory);
+    std::shared_ptr<Plato::MultiVector<double>> tControl = tFactory->control().create();
+    std::shared_ptr<Plato::MultiVector<double>> tGradient = tFactory->control().create();
+    for(size_t tVectorIndex = 0; tVectorIndex < tNumVectors; tVectorIndex++)
+    {
+        for(size_t tIndex = 0; tIndex < tNumControls; tIndex++)
+        {
+            (*tControl)(tVectorIndex, tIndex) = 1e-3 * (tIndex + tVectorIndex);
+            (*tGradient)(tVectorIndex, tIndex) = 1e-2;
+        }
+    }
+    tDataMng.setPreviousControl(*tControl);
+    (*tControl)(tNumVectors - 1, 0) += 0.5;
+    tDataMng.setCurrentControl(*tControl);
+    tDataMng.setObjectiveGradient(*tGradient);
+
+    // ********* Separate Stopping Measures: One Collective Each *********
+    PlatoTestCollectives::start();
+    tDataMng.computeNormObjectiveGradient();
+    tDataMng.computeControlStagnationMeasure();
+    const int tNumSeparateCollectives = PlatoTestCollectives::stop();
+    const double tNorm = tDataMng.getNormObjectiveGradient();
+    const double tStagnation = tDataMng.getControlStagnationMeasure();
+
+    // ********* Fused Stopping Measures: One Collective Per Iteration *********
+    PlatoTestCollectives::start();
+    tDataMng.computeNormObjectiveGradientAndControlStagnation();
+    const int tNumFusedCollectives = PlatoTestCollectives::stop();
+
+    int tNumRanks = 0;
+    MPI_Comm_size(MPI_COMM_WORLD, &tNumRanks);
+    const double tTolerance = 1e-12;
+    EXPECT_NEAR(1e-2 * std::sqrt(static_cast<double>(tNumRanks * tNumVectors * tNumControls)), tNorm, tTolerance);
+    EXPECT_NEAR(0.5, tStagnation, tTolerance);
+    EXPECT_NEAR(tNorm, tDataMng.getNormObjectiveGradient(), tTolerance);
+    EXPECT_NEAR(tStagnation, tDataMng.getControlStagnationMeasure(), tTolerance);
+
+    // before deferred reductions: one collective per vector and measure, i.e. 2 * tNumVectors
+    EXPECT_EQ(2, tNumSeparateCollectives);
+    EXPECT_EQ(1, tNumFusedCollectives);
+}
+
+}
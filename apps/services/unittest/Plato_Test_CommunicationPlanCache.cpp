@@ -0,0 +1,73 @@
+/*
+ * Plato_Test_CommunicationPlanCache.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <gtest/gtest.h>
+
+#include <mpi.h>
+
+#include <string>
+#include <vector>
+
+#include "Plato_Communication.hpp"
+#include "Plato_SharedDataInfo.hpp"
+#include "Plato_CommunicationPlanCache.hpp"
+
+namespace PlatoTest
+{
+
+TEST(PlatoTest, CommunicationPlanCache_Reuse)
+{
+    int tMyRank = -1;
+    MPI_Comm_rank(MPI_COMM_WORLD, &tMyRank);
+
+    Plato::CommunicationData tCommData;
+    tCommData.mLocalComm = MPI_COMM_SELF;
+    tCommData.mInterComm = MPI_COMM_WORLD;
+    tCommData.mLocalCommName = "PlatoMain";
+    const int tNumLocalNodes = 4;
+    auto tLayout = Plato::data::layout_t::SCALAR_FIELD;
+    for(int tIndex = 0; tIndex < tNumLocalNodes; tIndex++)
+    {
+        tCommData.mMyOwnedGlobalIDs[tLayout].push_back(tNumLocalNodes * tMyRank + tIndex + 1);
+    }
+
+    Plato::CommunicationPlanCache tCache;
+    tCache.validate(tCommData);
+
+    auto tSendAndRecv = Plato::communication::broadcast_t::SENDER_AND_RECEIVER;
+    std::vector<std::string> tProviders = {"PlatoMain"};
+    std::vector<std::string> tReceivers = {"PlatoMain"};
+    auto tTopology = tCache.get(tLayout, tProviders, tReceivers, tSendAndRecv, tCommData);
+    auto tControl = tCache.get(tLayout, tProviders, tReceivers, tSendAndRecv, tCommData);
+    EXPECT_EQ(tTopology.get(), tControl.get());
+
+    // provider order does not matter
+    std::vector<std::string> tTwoProviders = {"PlatoMain", "Analyze"};
+    std::vector<std::string> tTwoProvidersReversed = {"Analyze", "PlatoMain"};
+    auto tGradient = tCache.get(tLayout, tTwoProviders, tReceivers, tSendAndRecv, tCommData);
+    auto tGradientReversed = tCache.get(tLayout, tTwoProvidersReversed, tReceivers, tSendAndRecv, tCommData);
+    EXPECT_NE(tTopology.get(), tGradient.get());
+    EXPECT_EQ(tGradient.get(), tGradientReversed.get());
+
+    EXPECT_EQ(4, tCache.getNumRequests());
+    EXPECT_EQ(2, tCache.getNumBuilt());
+
+    // same distribution: plans survive validation
+    tCache.resetStatistics();
+    tCache.validate(tCommData);
+    auto tTopologyAfterUpdate = tCache.get(tLayout, tProviders, tReceivers, tSendAndRecv, tCommData);
+    EXPECT_EQ(tTopology.get(), tTopologyAfterUpdate.get());
+    EXPECT_EQ(0, tCache.getNumBuilt());
+
+    // new distribution: plans are rebuilt
+    tCommData.mMyOwnedGlobalIDs[tLayout].pop_back();
+    tCache.validate(tCommData);
+    auto tTopologyNewMesh = tCache.get(tLayout, tProviders, tReceivers, tSendAndRecv, tCommData);
+    EXPECT_NE(tTopology.get(), tTopologyNewMesh.get());
+    EXPECT_EQ(1, tCache.getNumBuilt());
+}
+
+}
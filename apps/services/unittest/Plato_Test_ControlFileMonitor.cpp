@@ -0,0 +1,82 @@
+/*
+ * Plato_Test_ControlFileMonitor.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <gtest/gtest.h>
+
+#include <mpi.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "Plato_ControlFileMonitor.hpp"
+
+namespace PlatoTest
+{
+
+namespace
+{
+void writeControlFile(const std::string & aFileName, const std::string & aTerminate)
+{
+    std::ofstream tFile(aFileName);
+    tFile << "<Terminate>" << aTerminate << "</Terminate>\n";
+}
+}
+
+TEST(PlatoTest, ControlFileMonitor_ParsesOnlyOnChange)
+{
+    int tMyRank = -1;
+    MPI_Comm_rank(MPI_COMM_WORLD, &tMyRank);
+    const std::string tFileName = "control_file_monitor_" + std::to_string(tMyRank) + ".xml";
+    std::remove(tFileName.c_str());
+
+    Plato::ControlFileMonitor tMonitor(tFileName, 0.0);
+
+    // no file: keep going
+    EXPECT_FALSE(tMonitor.terminateRequested());
+    EXPECT_EQ(0, tMonitor.getNumParses());
+
+    writeControlFile(tFileName, "false");
+    EXPECT_FALSE(tMonitor.terminateRequested());
+    EXPECT_FALSE(tMonitor.terminateRequested());
+    EXPECT_EQ(3, tMonitor.getNumChecks());
+    EXPECT_EQ(1, tMonitor.getNumParses());
+
+    writeControlFile(tFileName, "true");
+    EXPECT_TRUE(tMonitor.terminateRequested());
+    EXPECT_EQ(2, tMonitor.getNumParses());
+
+    std::remove(tFileName.c_str());
+    EXPECT_FALSE(tMonitor.terminateRequested());
+}
+
+TEST(PlatoTest, ControlFileMonitor_RateLimited)
+{
+    int tMyRank = -1;
+    MPI_Comm_rank(MPI_COMM_WORLD, &tMyRank);
+    const std::string tFileName = "control_file_monitor_rate_" + std::to_string(tMyRank) + ".xml";
+    writeControlFile(tFileName, "false");
+
+    // first request always checks, later ones reuse the answer within the interval
+    Plato::ControlFileMonitor tMonitor(tFileName, 3600.0);
+    EXPECT_FALSE(tMonitor.terminateRequested());
+
+    writeControlFile(tFileName, "true");
+    for(int tIndex = 0; tIndex < 100; tIndex++)
+    {
+        EXPECT_FALSE(tMonitor.terminateRequested());
+    }
+    EXPECT_EQ(1, tMonitor.getNumChecks());
+    EXPECT_EQ(1, tMonitor.getNumParses());
+
+    tMonitor.setPollInterval(0.0);
+    EXPECT_TRUE(tMonitor.terminateRequested());
+    EXPECT_EQ(2, tMonitor.getNumChecks());
+
+    std::remove(tFileName.c_str());
+}
+
+}
@@ -0,0 +1,85 @@
+/*
+ * Plato_Test_Diagnostics.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+#include <sstream>
+
+#include "Plato_Rosenbrock.hpp"
+#include "Plato_Diagnostics.hpp"
+#include "Plato_StandardMultiVector.hpp"
+
+namespace PlatoTest
+{
+
+namespace
+{
+class CountingRosenbrock : public Plato::Rosenbrock<double>
+{
+public:
+    double value(const Plato::MultiVector<double> & aControl)
+    {
+        mNumValueCalls++;
+        return (Plato::Rosenbrock<double>::value(aControl));
+    }
+
+    void values(const std::vector<std::shared_ptr<Plato::MultiVector<double>>> & aControls, std::vector<double> & aOutput)
+    {
+        mNumValuesCalls++;
+        mBatchSize = aControls.size();
+        Plato::Rosenbrock<double>::values(aControls, aOutput);
+    }
+
+    size_t mNumValueCalls = 0;
+    size_t mNumValuesCalls = 0;
+    size_t mBatchSize = 0;
+};
+}
+
+TEST(PlatoTest, Diagnostics_BatchedGradientCheck)
+{
+    const size_t tNumVectors = 1;
+    const size_t tNumControls = 2;
+    const int tInitialSuperscript = 1;
+    const int tFinalSuperscript = 6;
+    const size_t tNumSteps = tFinalSuperscript - tInitialSuperscript + 1;
+
+    // ********* SERIAL EVALUATIONS *********
+    CountingRosenbrock tSerialCriterion;
+    Plato::StandardMultiVector<double> tSerialControl(tNumVectors, tNumControls);
+    std::ostringstream tSerialMsg;
+    Plato::Diagnostics<double> tSerialDiagnostics;
+    tSerialDiagnostics.setInitialSuperscript(tInitialSuperscript);
+    tSerialDiagnostics.setFinalSuperscript(tFinalSuperscript);
+    tSerialDiagnostics.checkCriterionGradient(tSerialCriterion, tSerialControl, tSerialMsg);
+    EXPECT_EQ(1u + 4u * tNumSteps, tSerialCriterion.mNumValueCalls);
+    EXPECT_EQ(0u, tSerialCriterion.mNumValuesCalls);
+
+    // ********* BATCHED EVALUATIONS *********
+    CountingRosenbrock tBatchedCriterion;
+    Plato::StandardMultiVector<double> tBatchedControl(tNumVectors, tNumControls);
+    std::ostringstream tBatchedMsg;
+    Plato::Diagnostics<double> tBatchedDiagnostics;
+    tBatchedDiagnostics.setInitialSuperscript(tInitialSuperscript);
+    tBatchedDiagnostics.setFinalSuperscript(tFinalSuperscript);
+    tBatchedDiagnostics.setUseBatchedEvaluations(true);
+    tBatchedDiagnostics.checkCriterionGradient(tBatchedCriterion, tBatchedControl, tBatchedMsg);
+    EXPECT_EQ(1u, tBatchedCriterion.mNumValuesCalls);
+    EXPECT_EQ(4u * tNumSteps, tBatchedCriterion.mBatchSize);
+
+    // ********* SAME CONTROLS, SAME TABLE *********
+    EXPECT_TRUE(tSerialDiagnostics.didGradientTestPassed());
+    EXPECT_TRUE(tBatchedDiagnostics.didGradientTestPassed());
+    EXPECT_EQ(tSerialMsg.str(), tBatchedMsg.str());
+    for(size_t tIndex = 0; tIndex < tNumControls; tIndex++)
+    {
+        EXPECT_DOUBLE_EQ(tSerialControl(0, tIndex), tBatchedControl(0, tIndex));
+    }
+}
+
+}
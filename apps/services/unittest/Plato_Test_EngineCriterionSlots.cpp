@@ -0,0 +1,199 @@
+/*
+ * Plato_Test_EngineCriterionSlots.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+#include "Plato_InputData.hpp"
+#include "Plato_DataFactory.hpp"
+#include "Plato_EngineObjective.hpp"
+#include "Plato_EngineConstraint.hpp"
+#include "Plato_OptimizerFactory.hpp"
+#include "Plato_StandardMultiVector.hpp"
+#include "Plato_Test_MockInterface.hpp"
+#include "Plato_OptimizerEngineStageData.hpp"
+
+namespace PlatoTest
+{
+
+namespace
+{
+Plato::InputData makeSharedData(const std::string & aName, const std::string & aLayout)
+{
+    Plato::InputData tSharedData("SharedData");
+    tSharedData.add<std::string>("Name", aName);
+    tSharedData.add<std::string>("Type", "Scalar");
+    tSharedData.add<std::string>("Layout", aLayout);
+    return tSharedData;
+}
+
+/******************************************************************************//**
+ * \brief Interface input data with a value stage that pairs control i with value i
+**********************************************************************************/
+Plato::InputData makeInputData(const std::string & aStageName,
+                               const std::vector<std::string> & aInputs,
+                               const std::vector<std::string> & aOutputs,
+                               const std::string & aOutputLayout,
+                               bool aEvaluationSlots)
+{
+    Plato::InputData tInputData("Input Data");
+    Plato::InputData tStage("Stage");
+    tStage.add<std::string>("Name", aStageName);
+    tStage.add<std::string>("EvaluationSlots", aEvaluationSlots ? "true" : "false");
+    for(const std::string & tName : aInputs)
+    {
+        Plato::InputData tInput("Input");
+        tInput.add<std::string>("SharedDataName", tName);
+        tStage.add<Plato::InputData>("Input", tInput);
+        tInputData.add<Plato::InputData>("SharedData", makeSharedData(tName, "Nodal Field"));
+    }
+    for(const std::string & tName : aOutputs)
+    {
+        Plato::InputData tOutput("Output");
+        tOutput.add<std::string>("SharedDataName", tName);
+        tStage.add<Plato::InputData>("Output", tOutput);
+        tInputData.add<Plato::InputData>("SharedData", makeSharedData(tName, aOutputLayout));
+    }
+    tInputData.add<Plato::InputData>("Stage", tStage);
+    return tInputData;
+}
+
+std::vector<std::shared_ptr<Plato::MultiVector<double>>> makeControls(size_t aNumControls, size_t aLength)
+{
+    std::vector<std::shared_ptr<Plato::MultiVector<double>>> tControls;
+    for(size_t tIndex = 0; tIndex < aNumControls; tIndex++)
+    {
+        tControls.push_back(std::make_shared<Plato::StandardMultiVector<double>>(1, aLength, tIndex + 1.0));
+    }
+    return tControls;
+}
+}
+
+TEST(PlatoTest, EngineObjective_ValuesThroughEvaluationSlots)
+{
+    const size_t tLength = 3;
+    const std::string tStageName("Objective Value");
+    const std::vector<std::string> tInputs = {"Control", "Control 1", "Control 2"};
+    const std::vector<std::string> tOutputs = {"Objective", "Objective 1", "Objective 2"};
+    PlatoTest::MockInterface tInterface(makeInputData(tStageName, tInputs, tOutputs, "Global", true));
+    tInterface.addStage(tStageName, tInputs, tOutputs, tLength);
+
+    Plato::OptimizerEngineStageData tEngineData;
+    tEngineData.addControlName("Control");
+    tEngineData.setObjectiveValueStageName(tStageName);
+    tEngineData.setObjectiveValueOutputName("Objective");
+    Plato::DataFactory<double> tDataFactory;
+    tDataFactory.allocateControl(tLength);
+    Plato::EngineObjective<double> tObjective(tDataFactory, tEngineData, &tInterface, nullptr);
+
+    // ********* FOUR CONTROLS, THREE SLOTS: TWO STAGE CALLS *********
+    const size_t tNumControls = 4;
+    std::vector<double> tValues;
+    tObjective.values(makeControls(tNumControls, tLength), tValues);
+    ASSERT_EQ(2u, tInterface.getNumStageCalls(tStageName));
+    ASSERT_EQ(tNumControls, tValues.size());
+    const double tTolerance = 1e-12;
+    for(size_t tIndex = 0; tIndex < tNumControls; tIndex++)
+    {
+        EXPECT_NEAR(tLength * (tIndex + 1.0), tValues[tIndex], tTolerance);
+    }
+
+    // ********* THE UNUSED SLOTS OF THE LAST ROUND KEEP THE PREVIOUS ROUND'S CONTROLS *********
+    const std::vector<std::vector<double>> & tLastRoundInputs = tInterface.getStageCallInputs(tStageName, 1);
+    EXPECT_NEAR(4.0, tLastRoundInputs[0][0], tTolerance);
+    EXPECT_NEAR(2.0, tLastRoundInputs[1][0], tTolerance);
+    EXPECT_NEAR(3.0, tLastRoundInputs[2][0], tTolerance);
+}
+
+TEST(PlatoTest, EngineConstraint_ValuesThroughEvaluationSlots)
+{
+    const size_t tLength = 2;
+    const std::string tStageName("Volume");
+    const std::vector<std::string> tInputs = {"Control", "Control 1"};
+    const std::vector<std::string> tOutputs = {"Volume Value", "Volume Value 1"};
+    PlatoTest::MockInterface tInterface(makeInputData(tStageName, tInputs, tOutputs, "Global", true));
+    tInterface.addStage(tStageName, tInputs, tOutputs, tLength);
+
+    Plato::OptimizerEngineStageData tEngineData;
+    tEngineData.addControlName("Control");
+    tEngineData.addConstraintValueName("Volume Value");
+    tEngineData.addConstraintValueStageName(tStageName);
+    tEngineData.addConstraintReferenceValue("Volume Value", 2.0);
+    tEngineData.addConstraintNormalizedTargetValue("Volume Value", 0.5);
+    Plato::DataFactory<double> tDataFactory;
+    tDataFactory.allocateControl(tLength);
+    const size_t tConstraintID = 0;
+    Plato::EngineConstraint<double> tConstraint(tConstraintID, tDataFactory, tEngineData, &tInterface);
+
+    const size_t tNumControls = 3;
+    std::vector<double> tValues;
+    tConstraint.values(makeControls(tNumControls, tLength), tValues);
+    ASSERT_EQ(2u, tInterface.getNumStageCalls(tStageName));
+    ASSERT_EQ(tNumControls, tValues.size());
+    const double tTolerance = 1e-12;
+    for(size_t tIndex = 0; tIndex < tNumControls; tIndex++)
+    {
+        const double tGold = (tLength * (tIndex + 1.0)) / 2.0 - 0.5;
+        EXPECT_NEAR(tGold, tValues[tIndex], tTolerance);
+    }
+}
+
+TEST(PlatoTest, EngineObjective_ValuesWithoutEvaluationSlots)
+{
+    // ********* STAGES ONLY HAVE EVALUATION SLOTS IF THEY ASK FOR THEM *********
+    const size_t tLength = 3;
+    const std::string tStageName("Objective Value");
+    const std::vector<std::string> tInputs = {"Control"};
+    const std::vector<std::string> tOutputs = {"Objective"};
+    PlatoTest::MockInterface tInterface(makeInputData(tStageName, tInputs, tOutputs, "Global", false));
+    tInterface.addStage(tStageName, tInputs, tOutputs, tLength);
+
+    Plato::OptimizerEngineStageData tEngineData;
+    tEngineData.addControlName("Control");
+    tEngineData.setObjectiveValueStageName(tStageName);
+    tEngineData.setObjectiveValueOutputName("Objective");
+    Plato::DataFactory<double> tDataFactory;
+    tDataFactory.allocateControl(tLength);
+    Plato::EngineObjective<double> tObjective(tDataFactory, tEngineData, &tInterface, nullptr);
+
+    const size_t tNumControls = 3;
+    std::vector<double> tValues;
+    tObjective.values(makeControls(tNumControls, tLength), tValues);
+    ASSERT_EQ(tNumControls, tInterface.getNumStageCalls(tStageName));
+    const double tTolerance = 1e-12;
+    for(size_t tIndex = 0; tIndex < tNumControls; tIndex++)
+    {
+        EXPECT_NEAR(tLength * (tIndex + 1.0), tValues[tIndex], tTolerance);
+    }
+}
+
+TEST(PlatoTest, EngineObjective_EvaluationSlotsRequireScalarOutputs)
+{
+    const size_t tLength = 3;
+    const std::string tStageName("Objective Value");
+    const std::vector<std::string> tInputs = {"Control", "Control 1"};
+    const std::vector<std::string> tOutputs = {"Objective", "Objective 1"};
+    PlatoTest::MockInterface tInterface(makeInputData(tStageName, tInputs, tOutputs, "Nodal Field", true));
+    tInterface.addStage(tStageName, tInputs, tOutputs, tLength);
+
+    Plato::OptimizerEngineStageData tEngineData;
+    tEngineData.addControlName("Control");
+    tEngineData.setObjectiveValueStageName(tStageName);
+    tEngineData.setObjectiveValueOutputName("Objective");
+    Plato::DataFactory<double> tDataFactory;
+    tDataFactory.allocateControl(tLength);
+    Plato::EngineObjective<double> tObjective(tDataFactory, tEngineData, &tInterface, nullptr);
+
+    std::vector<double> tValues;
+    EXPECT_THROW(tObjective.values(makeControls(2, tLength), tValues), std::runtime_error);
+    EXPECT_EQ(0u, tInterface.getNumStageCalls(tStageName));
+}
+
+}
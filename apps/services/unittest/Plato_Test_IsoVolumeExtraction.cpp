@@ -0,0 +1,297 @@
+/*
+ * Plato_Test_IsoVolumeExtraction.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "IVEMeshAPI.hpp"
+#include "IsoVolumeExtractionTool.hpp"
+
+namespace PlatoTest
+{
+
+/******************************************************************************//**
+ * @brief In-memory structured hex mesh for exercising the iso-volume extraction
+ *        without an exodus mesh. Node handles start at one, element handles follow
+ *        the nodes, and new nodes and tris are appended to the mesh.
+**********************************************************************************/
+class StructuredHexMeshAPI : public IVEMeshAPI
+{
+public:
+    StructuredHexMeshAPI(int aNumElemsPerSide, double aRadius) :
+            mNumElemsPerSide(aNumElemsPerSide),
+            mNumNodesPerSide(aNumElemsPerSide + 1),
+            mNumOriginalNodes(mNumNodesPerSide * mNumNodesPerSide * mNumNodesPerSide),
+            mNewNodeId(1)
+    {
+        // density is one inside a sphere and decays linearly to zero outside of it
+        double tSpacing = 1.0 / mNumElemsPerSide;
+        for(int k = 0; k < mNumNodesPerSide; k++)
+        {
+            for(int j = 0; j < mNumNodesPerSide; j++)
+            {
+                for(int i = 0; i < mNumNodesPerSide; i++)
+                {
+                    IsoVector tPoint(i * tSpacing, j * tSpacing, k * tSpacing);
+                    mCoordinates.push_back(tPoint);
+                    double tDistance = (tPoint - IsoVector(0.5, 0.5, 0.5)).length();
+                    mValues.push_back(std::max(0.0, std::min(1.0, 1.0 - (tDistance - aRadius) * 4.0)));
+                }
+            }
+        }
+    }
+
+    std::vector<IVEHandle> elements() const
+    {
+        std::vector<IVEHandle> tElements;
+        int tNumElems = mNumElemsPerSide * mNumElemsPerSide * mNumElemsPerSide;
+        for(int tElem = 0; tElem < tNumElems; tElem++)
+        {
+            tElements.push_back(mNumOriginalNodes + 1 + tElem);
+        }
+        return tElements;
+    }
+
+    const std::vector<IsoVector>& coordinates() const
+    {
+        return mCoordinates;
+    }
+
+    const std::vector<IVEHandle>& triNodes() const
+    {
+        return mTriNodes;
+    }
+
+    void transfer_output_fields(IVEHandle n1, IVEHandle n2, IVEHandle new_node, double mu, IVEMeshAPI *output_mesh_api) {}
+    void copy_node_output_fields(IVEHandle n1, IVEHandle new_node, IVEMeshAPI *output_mesh_api) {}
+    void copy_element_output_fields(IVEHandle e1, IVEHandle e2, IVEMeshAPI *output_mesh_api) {}
+    IVEHandle new_node(IsoVector &coordinates)
+    {
+        mCoordinates.push_back(coordinates);
+        return mCoordinates.size();
+    }
+    void get_fixed_block_nodes(std::vector<IVEHandle> &fixed_block_nodes) {}
+    IVEHandle get_new_node_id()
+    {
+        return mNewNodeId++;
+    }
+    IVEHandle new_tri(IVEHandle n1, IVEHandle n2, IVEHandle n3, bool is_fixed, IVEHandle source_elem)
+    {
+        mTriNodes.push_back(n1);
+        mTriNodes.push_back(n2);
+        mTriNodes.push_back(n3);
+        return mTriNodes.size() / 3;
+    }
+    int element_nodes(IVEHandle elem, IVEHandle nodes[8]) const
+    {
+        hex_nodes(elem, nodes);
+        return 8;
+    }
+    void hex_nodes(IVEHandle hex, IVEHandle nodes[8]) const
+    {
+        int i, j, k;
+        elementIJK(hex, i, j, k);
+        nodes[0] = node(i, j, k);
+        nodes[1] = node(i + 1, j, k);
+        nodes[2] = node(i + 1, j + 1, k);
+        nodes[3] = node(i, j + 1, k);
+        nodes[4] = node(i, j, k + 1);
+        nodes[5] = node(i + 1, j, k + 1);
+        nodes[6] = node(i + 1, j + 1, k + 1);
+        nodes[7] = node(i, j + 1, k + 1);
+    }
+    void tet_nodes(IVEHandle tet, IVEHandle nodes[4]) const {}
+    void hex_quad_nodes(IVEHandle hex, int index, IVEHandle nodes[4]) const
+    {
+        const int tFaceNodes[6][4] = {{0, 1, 5, 4}, {1, 2, 6, 5}, {2, 3, 7, 6}, {0, 4, 7, 3}, {0, 3, 2, 1}, {4, 5, 6, 7}};
+        IVEHandle tHexNodes[8];
+        hex_nodes(hex, tHexNodes);
+        for(int tNode = 0; tNode < 4; tNode++)
+        {
+            nodes[tNode] = tHexNodes[tFaceNodes[index][tNode]];
+        }
+    }
+    IVEHandle get_connected_hex(IVEHandle hex, IVEHandle n1, IVEHandle n2, IVEHandle n3, IVEHandle n4) const
+    {
+        // the face lies on the low or high side of this element in exactly one direction
+        int i, j, k;
+        elementIJK(hex, i, j, k);
+        int tFaceSum[3] = {0, 0, 0};
+        IVEHandle tFaceNodes[4] = {n1, n2, n3, n4};
+        for(int tNode = 0; tNode < 4; tNode++)
+        {
+            int tIndex = tFaceNodes[tNode] - 1;
+            tFaceSum[0] += tIndex % mNumNodesPerSide;
+            tFaceSum[1] += (tIndex / mNumNodesPerSide) % mNumNodesPerSide;
+            tFaceSum[2] += tIndex / (mNumNodesPerSide * mNumNodesPerSide);
+        }
+        int tNeighbor[3] = {i, j, k};
+        for(int tDim = 0; tDim < 3; tDim++)
+        {
+            if(tFaceSum[tDim] == 4 * tNeighbor[tDim])
+            {
+                tNeighbor[tDim]--;
+                break;
+            }
+            if(tFaceSum[tDim] == 4 * (tNeighbor[tDim] + 1))
+            {
+                tNeighbor[tDim]++;
+                break;
+            }
+        }
+        for(int tDim = 0; tDim < 3; tDim++)
+        {
+            if(tNeighbor[tDim] < 0 || tNeighbor[tDim] >= mNumElemsPerSide)
+            {
+                return 0;
+            }
+        }
+        return mNumOriginalNodes + 1 + tNeighbor[0] + mNumElemsPerSide * (tNeighbor[1] + mNumElemsPerSide * tNeighbor[2]);
+    }
+    IVEHandle get_connected_tet(IVEHandle tet, IVEHandle n1, IVEHandle n2, IVEHandle n3) const
+    {
+        return 0;
+    }
+    IsoVector node_coordinates(IVEHandle node) const
+    {
+        return mCoordinates[node - 1];
+    }
+    double get_nodal_iso_field_variable(IVEHandle node) const
+    {
+        return mValues[node - 1];
+    }
+    void store_tri_to_tet_map_entry(const IVEHandle &tri, const IVEHandle &tet) {}
+    void store_tet_to_tri_map_entry(const IVEHandle &tet, const IVEHandle &tri) {}
+    void get_shared_boundary_nodes(std::set<IVEHandle> &shared_boundary_nodes) {}
+    void get_attached_elements(const std::set<IVEHandle> &nodes, std::vector<IVEHandle> &attached_elements) {}
+    void batch_create_edge_boundary_nodes(std::vector<BoundaryNodeInfo> &boundary_info, IVEMeshAPI *existing_mesh) {}
+    void batch_create_duplicate_nodes(std::vector<DuplicateNodeInfo> &dup_node_infos, IVEMeshAPI *existing_mesh) {}
+    void print_boundary_node_info(std::vector<BoundaryNodeInfo> &bni) {}
+    void reserve_new_node_ids(uint64_t num_requested) {}
+    void reserve_new_tri_ids(uint64_t num_requested) {}
+    void calculate_average_edge_length_and_bbox(const std::vector<IVEHandle> &elem_list,
+                                                double &minx, double &miny, double &minz,
+                                                double &maxx, double &maxy, double &maxz, double &ave_length)
+    {
+        minx = miny = minz = 0.0;
+        maxx = maxy = maxz = 1.0;
+        ave_length = 1.0 / mNumElemsPerSide;
+    }
+    void set_min_node_id(BoundaryNodeInfo &bni, const IVEHandle &n)
+    {
+        bni.min_node = n;
+    }
+    void set_max_node_id(BoundaryNodeInfo &bni, const IVEHandle &n)
+    {
+        bni.max_node = n;
+    }
+    void set_existing_node_id(DuplicateNodeInfo &dni, const IVEHandle &n)
+    {
+        dni.existing_node_local_id = n;
+    }
+
+private:
+    IVEHandle node(int i, int j, int k) const
+    {
+        return 1 + i + mNumNodesPerSide * (j + mNumNodesPerSide * k);
+    }
+    void elementIJK(IVEHandle aElem, int &i, int &j, int &k) const
+    {
+        int tIndex = aElem - mNumOriginalNodes - 1;
+        i = tIndex % mNumElemsPerSide;
+        j = (tIndex / mNumElemsPerSide) % mNumElemsPerSide;
+        k = tIndex / (mNumElemsPerSide * mNumElemsPerSide);
+    }
+
+    int mNumElemsPerSide;
+    int mNumNodesPerSide;
+    int mNumOriginalNodes;
+    IVEHandle mNewNodeId;
+    std::vector<IsoVector> mCoordinates;
+    std::vector<double> mValues;
+    std::vector<IVEHandle> mTriNodes;
+};
+
+double extract_from_structured_hex_mesh(int aNumThreads, StructuredHexMeshAPI &aMesh, size_t &aNumFixedTris, size_t &aNumOptimizedTris)
+{
+    std::vector<IVEHandle> tFixedTris, tOptimizedTris;
+    IsoVolumeExtractionTool tTool;
+    tTool.num_threads(aNumThreads);
+
+    std::chrono::steady_clock::time_point tStart = std::chrono::steady_clock::now();
+    tTool.build_iso_volume_tris_from_hexes(aMesh.elements(), 0.5, 1e-5, false, tFixedTris, tOptimizedTris, &aMesh, &aMesh);
+    std::chrono::steady_clock::time_point tStop = std::chrono::steady_clock::now();
+
+    aNumFixedTris = tFixedTris.size();
+    aNumOptimizedTris = tOptimizedTris.size();
+    return std::chrono::duration<double>(tStop - tStart).count();
+}
+
+TEST(PlatoTest, IsoVolumeExtraction_MeshEdgeTable)
+{
+    MeshEdgeTable tTable;
+    EXPECT_EQ(nullptr, tTable.find(3, 7));
+
+    // enough edges to grow the table several times
+    const IVEHandle tNumNodes = 500;
+    for(IVEHandle tNode = 1; tNode < tNumNodes; tNode++)
+    {
+        tTable.insert(tNode + 1, tNode, 1000 + tNode);
+    }
+    EXPECT_EQ(tNumNodes - 1, tTable.size());
+
+    for(IVEHandle tNode = 1; tNode < tNumNodes; tNode++)
+    {
+        MeshEdge* tEdge = tTable.find(tNode, tNode + 1);
+        ASSERT_NE(nullptr, tEdge);
+        EXPECT_EQ(tNode, tEdge->min_id_node);
+        EXPECT_EQ(tNode + 1, tEdge->max_id_node);
+        EXPECT_EQ(1000 + tNode, tEdge->mid_node);
+        EXPECT_EQ(tEdge, tTable.find(tNode + 1, tNode));
+    }
+    EXPECT_EQ(nullptr, tTable.find(1, 3));
+
+    // the first mid node inserted for an edge is kept
+    tTable.insert(1, 2, 42);
+    EXPECT_EQ(tNumNodes - 1, tTable.size());
+    EXPECT_EQ(1001u, tTable.find(2, 1)->mid_node);
+}
+
+TEST(PlatoTest, IsoVolumeExtraction_ThreadedSweepIsDeterministic)
+{
+    for(int tNumElemsPerSide : {8, 24, 48})
+    {
+        StructuredHexMeshAPI tSerialMesh(tNumElemsPerSide, 0.3);
+        size_t tNumSerialFixed = 0, tNumSerialOptimized = 0;
+        double tSerialTime = extract_from_structured_hex_mesh(1, tSerialMesh, tNumSerialFixed, tNumSerialOptimized);
+        EXPECT_GT(tNumSerialOptimized, 0u);
+
+        StructuredHexMeshAPI tThreadedMesh(tNumElemsPerSide, 0.3);
+        size_t tNumThreadedFixed = 0, tNumThreadedOptimized = 0;
+        double tThreadedTime = extract_from_structured_hex_mesh(4, tThreadedMesh, tNumThreadedFixed, tNumThreadedOptimized);
+
+        // same nodes and tris in the same order
+        EXPECT_EQ(tNumSerialFixed, tNumThreadedFixed);
+        EXPECT_EQ(tNumSerialOptimized, tNumThreadedOptimized);
+        ASSERT_EQ(tSerialMesh.coordinates().size(), tThreadedMesh.coordinates().size());
+        for(size_t tNode = 0; tNode < tSerialMesh.coordinates().size(); tNode++)
+        {
+            EXPECT_EQ(tSerialMesh.coordinates()[tNode].x(), tThreadedMesh.coordinates()[tNode].x());
+            EXPECT_EQ(tSerialMesh.coordinates()[tNode].y(), tThreadedMesh.coordinates()[tNode].y());
+            EXPECT_EQ(tSerialMesh.coordinates()[tNode].z(), tThreadedMesh.coordinates()[tNode].z());
+        }
+        EXPECT_EQ(tSerialMesh.triNodes(), tThreadedMesh.triNodes());
+
+        std::cout << "Iso-volume extraction from " << tNumElemsPerSide * tNumElemsPerSide * tNumElemsPerSide
+                  << " hexes: 1 thread " << tSerialTime << "s, 4 threads " << tThreadedTime << "s" << std::endl;
+    }
+}
+
+}
@@ -57,6 +57,7 @@
 #include "Plato_StandardVector.hpp"
 #include "Plato_DistributedVector.hpp"
 #include "Plato_StandardMultiVector.hpp"
+#include "Plato_DeferredReductions.hpp"
 #include "Plato_DistributedReductionOperations.hpp"
 #include "Plato_StandardVectorReductionOperations.hpp"
 
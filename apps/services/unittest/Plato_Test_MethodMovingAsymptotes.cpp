@@ -48,6 +48,8 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+
 #include "Plato_Radius.hpp"
 #include "Plato_Circle.hpp"
 #include "Plato_Rosenbrock.hpp"
@@ -67,6 +69,7 @@
 
 #include "Plato_MethodMovingAsymptotesParser.hpp"
 #include "Plato_MethodMovingAsymptotesInterface.hpp"
+#include "Plato_MethodMovingAsymptotesDualSolver.hpp"
 
 #include "Plato_UnitTestUtils.hpp"
 
@@ -172,6 +175,7 @@ TEST(PlatoTest, MethodMovingAsymptotes_Parser)
 
     // ********* TEST: OPTIONS NODE NOT DEFINE -> USE DEFAULT PARAMETERS *********
     EXPECT_FALSE(tInputsOne.mPrintMMADiagnostics);
+    EXPECT_FALSE(tInputsOne.mUseDualForMMASubproblem);
     EXPECT_EQ(0u, tInputsOne.mUpdateFrequency);
     EXPECT_EQ(500u, tInputsOne.mMaxNumSolverIter);
     EXPECT_EQ(1u, tInputsOne.mNumControlVectors);
@@ -236,6 +240,7 @@ TEST(PlatoTest, MethodMovingAsymptotes_Parser)
     tOptions.add<std::string>("ControlStagnationTolerance", "1e-5");
     tOptions.add<std::string>("ObjectiveStagnationTolerance", "1e-4");
     tOptions.add<std::string>("ConstraintNormalizationMultipliers", "2");
+    tOptions.add<std::string>("UseDualForMMASubproblem", "true");
     Plato::InputData tOptimizerNodeOne("OptimizerNode");
     tOptimizerNodeOne.add<Plato::InputData>("Options", tOptions);
 
@@ -243,6 +248,7 @@ TEST(PlatoTest, MethodMovingAsymptotes_Parser)
 
     EXPECT_FALSE(tInputsOne.mPrintMMADiagnostics);
     EXPECT_FALSE(tInputsOne.mPrintAugLagSubProbDiagnostics);
+    EXPECT_TRUE(tInputsOne.mUseDualForMMASubproblem);
     EXPECT_EQ(5u, tInputsOne.mUpdateFrequency);
     EXPECT_EQ(100u, tInputsOne.mMaxNumSolverIter);
     EXPECT_EQ(2u, tInputsOne.mNumControlVectors);
@@ -303,6 +309,28 @@ TEST(PlatoTest, MethodMovingAsymptotes_Parser)
     EXPECT_NEAR(3.0, tInputsTwo.mConstraintNormalizationMultipliers[1], tTolerance);
 }
 
+TEST(PlatoTest, MethodMovingAsymptotes_ParserDualWithGPUAlgebra)
+{
+    Plato::MethodMovingAsymptotesParser<double> tParser;
+    Plato::AlgorithmInputsMMA<double> tInputs;
+
+    // the dual subproblem solver works on host data
+    Plato::InputData tOptions("Options");
+    tOptions.add<std::string>("Algebra", "GPU");
+    tOptions.add<std::string>("UseDualForMMASubproblem", "true");
+    Plato::InputData tOptimizerNode("OptimizerNode");
+    tOptimizerNode.add<Plato::InputData>("Options", tOptions);
+    EXPECT_THROW(tParser.parse(tOptimizerNode, tInputs), Plato::ParsingException);
+
+    // the augmented Lagrangian subproblem solver is still available with GPU algebra
+    Plato::InputData tOptionsTwo("Options");
+    tOptionsTwo.add<std::string>("Algebra", "GPU");
+    Plato::InputData tOptimizerNodeTwo("OptimizerNode");
+    tOptimizerNodeTwo.add<Plato::InputData>("Options", tOptionsTwo);
+    EXPECT_NO_THROW(tParser.parse(tOptimizerNodeTwo, tInputs));
+    EXPECT_FALSE(tInputs.mUseDualForMMASubproblem);
+}
+
 TEST(PlatoTest, MethodMovingAsymptotes_PrintDiagnosticsOneConstraints)
 {
     Plato::CommWrapper tComm(MPI_COMM_WORLD);
@@ -737,6 +765,114 @@ TEST(PlatoTest, MethodMovingAsymptotesOperations_updateConstraintApproximationFu
     PlatoTest::checkMultiVectorData(tDataMng.getConstraintAppxFunctionQ(tContraintIndex), tGold);
 }
 
+TEST(PlatoTest, MethodMovingAsymptotesDualSolver_solve)
+{
+    const size_t tNumControls = 5;
+    const size_t tNumConstraints = 2;
+    std::shared_ptr<Plato::DataFactory<double>> tDataFactory = std::make_shared<Plato::DataFactory<double>>();
+    tDataFactory->allocateDual(tNumConstraints);
+    tDataFactory->allocateControl(tNumControls);
+    Plato::MethodMovingAsymptotesDataMng<double> tDataMng(tDataFactory);
+
+    // OBJECTIVE WANTS TO MOVE ALL CONTROLS BUT THE THIRD ONE UP
+    Plato::StandardMultiVector<double> tData(1 /* number of vectors */, tNumControls);
+    std::vector<double> tObjectiveGradient = {-1.0, -0.5, 0.25, -2.0, -1.0};
+    for(size_t tIndex = 0; tIndex < tNumControls; tIndex++)
+    {
+        tData(0, tIndex) = tObjectiveGradient[tIndex];
+    }
+    tDataMng.setCurrentObjectiveValue(1.0);
+    tDataMng.setCurrentObjectiveGradient(tData);
+
+    // FIRST CONSTRAINT IS ACTIVE, SECOND CONSTRAINT IS INACTIVE
+    Plato::fill(1.0, tData);
+    tDataMng.setCurrentConstraintValue(0, 0.0);
+    tDataMng.setConstraintNormalization(0, 1.0);
+    tDataMng.setCurrentConstraintGradient(0, tData);
+    for(size_t tIndex = 0; tIndex < tNumControls; tIndex++)
+    {
+        tData(0, tIndex) = 0.1 * static_cast<double>(tIndex + 1);
+    }
+    tDataMng.setCurrentConstraintValue(1, -0.5);
+    tDataMng.setConstraintNormalization(1, 2.0);
+    tDataMng.setCurrentConstraintGradient(1, tData);
+
+    Plato::fill(0.5, tData);
+    tDataMng.setLowerAsymptotes(tData);
+    Plato::fill(1.1, tData);
+    tDataMng.setUpperAsymptotes(tData);
+    Plato::fill(0.8, tData);
+    tDataMng.setCurrentControls(tData);
+    Plato::fill(0.25, tData);
+    tDataMng.setControlLowerBounds(tData);
+    Plato::fill(1., tData);
+    tDataMng.setControlUpperBounds(tData);
+
+    Plato::MethodMovingAsymptotesOperations<double> tOperations(tDataFactory);
+    tOperations.initialize(tDataMng);
+    tOperations.updateObjectiveApproximationFunctionData(tDataMng);
+    tOperations.updateConstraintApproximationFunctionsData(tDataMng);
+    tOperations.updateSubProblemBounds(tDataMng);
+
+    // SOLVE MMA SUBPROBLEM
+    Plato::MethodMovingAsymptotesDualSolver<double> tSolver(tDataFactory);
+    tSolver.setFeasibilityTolerance(1e-12);
+    tSolver.solve(tDataMng);
+    Plato::StandardMultiVector<double> tSolution(1 /* number of vectors */, tNumControls);
+    tSolver.getSolution(tSolution);
+    EXPECT_LT(tSolver.getDualResidual(), 1e-12);
+    EXPECT_GT(tSolver.getNumIterations(), 0u);
+    EXPECT_GT(tSolver.getLagrangeMultiplier(0), 0.0);
+    EXPECT_NEAR(0.0, tSolver.getLagrangeMultiplier(1), 1e-12);
+
+    // CHECK KARUSH-KUHN-TUCKER CONDITIONS OF THE MMA SUBPROBLEM
+    Plato::ApproximationFunctionData<double> tMMAData(tDataFactory);
+    Plato::update(1.0, tDataMng.getCurrentControls(), 0.0, *tMMAData.mCurrentControls);
+    Plato::update(1.0, tDataMng.getLowerAsymptotes(), 0.0, *tMMAData.mLowerAsymptotes);
+    Plato::update(1.0, tDataMng.getUpperAsymptotes(), 0.0, *tMMAData.mUpperAsymptotes);
+    Plato::update(1.0, tDataMng.getObjFuncAppxFunctionP(), 0.0, *tMMAData.mAppxFunctionP);
+    Plato::update(1.0, tDataMng.getObjFuncAppxFunctionQ(), 0.0, *tMMAData.mAppxFunctionQ);
+    Plato::MethodMovingAsymptotesCriterion<double> tObjAppxFunc(tDataFactory);
+    tObjAppxFunc.update(tMMAData);
+    Plato::StandardMultiVector<double> tLagrangianGradient(1 /* number of vectors */, tNumControls);
+    tObjAppxFunc.gradient(tSolution, tLagrangianGradient);
+
+    const double tTolerance = 1e-8;
+    Plato::StandardMultiVector<double> tConstraintGradient(1 /* number of vectors */, tNumControls);
+    for(size_t tIndex = 0; tIndex < tNumConstraints; tIndex++)
+    {
+        tMMAData.mCurrentNormalizedCriterionValue = tDataMng.getCurrentConstraintValue(tIndex) / tDataMng.getConstraintNormalization(tIndex);
+        Plato::update(1.0, tDataMng.getConstraintAppxFunctionP(tIndex), 0.0, *tMMAData.mAppxFunctionP);
+        Plato::update(1.0, tDataMng.getConstraintAppxFunctionQ(tIndex), 0.0, *tMMAData.mAppxFunctionQ);
+        Plato::MethodMovingAsymptotesCriterion<double> tConstrAppxFunc(tDataFactory);
+        tConstrAppxFunc.update(tMMAData);
+        const double tConstraintValue = tConstrAppxFunc.value(tSolution);
+        const double tMultiplier = tSolver.getLagrangeMultiplier(tIndex);
+        EXPECT_LT(tConstraintValue, tTolerance);
+        EXPECT_NEAR(0.0, tMultiplier * tConstraintValue, tTolerance);
+        tConstrAppxFunc.gradient(tSolution, tConstraintGradient);
+        Plato::update(tMultiplier, tConstraintGradient, 1.0, tLagrangianGradient);
+    }
+
+    const Plato::MultiVector<double> & tLowerBounds = tDataMng.getSubProblemControlLowerBounds();
+    const Plato::MultiVector<double> & tUpperBounds = tDataMng.getSubProblemControlUpperBounds();
+    for(size_t tIndex = 0; tIndex < tNumControls; tIndex++)
+    {
+        // projected gradient of the Lagrangian vanishes at the subproblem solution
+        const double tValue = tSolution(0, tIndex);
+        ASSERT_GE(tValue, tLowerBounds(0, tIndex));
+        ASSERT_LE(tValue, tUpperBounds(0, tIndex));
+        double tProjectedGradient = tLagrangianGradient(0, tIndex);
+        if(tValue <= tLowerBounds(0, tIndex)) { tProjectedGradient = std::min(tProjectedGradient, 0.0); }
+        if(tValue >= tUpperBounds(0, tIndex)) { tProjectedGradient = std::max(tProjectedGradient, 0.0); }
+        EXPECT_NEAR(0.0, tProjectedGradient, tTolerance);
+    }
+
+    // WARM START FROM THE PREVIOUS MULTIPLIERS CONVERGES IMMEDIATELY
+    tSolver.solve(tDataMng);
+    EXPECT_EQ(0u, tSolver.getNumIterations());
+}
+
 #ifdef ENABLE_IPOPT_FOR_MMA_SUBPROBLEM
 TEST(PlatoTest, PERF_MethodMovingAsymptotes_5Bars)
 {
@@ -1034,4 +1170,227 @@ TEST(PlatoTest, MethodMovingAsymptotes_CircleRadius)
     std::cout << tOutputs.mStopCriterion.c_str() << "\n" << std::flush;
 }
 
+TEST(PlatoTest, MethodMovingAsymptotes_RosenbrockRadius_Dual)
+{
+    // ********* SET OBJECTIVE AND COSNTRAINT *********
+    std::shared_ptr<Plato::Rosenbrock<double>> tObjective = std::make_shared<Plato::Rosenbrock<double>>();
+    std::shared_ptr<Plato::CriterionList<double>> tConstraintList = std::make_shared<Plato::CriterionList<double>>();
+    std::shared_ptr<Plato::Radius<double>> tConstraint = std::make_shared<Plato::Radius<double>>();
+    tConstraintList->add(tConstraint);
+
+    // ********* SOLVE OPTIMIZATION PROBLEM *********
+    const size_t tNumVectors = 1;
+    const size_t tNumControls = 2;
+    const size_t tNumConstraints = 1;
+    Plato::AlgorithmInputsMMA<double> tInputs;
+    //tInputs.mPrintMMADiagnostics = true;
+    tInputs.mUseDualForMMASubproblem = true;
+    tInputs.mMoveLimit = 0.1;
+    tInputs.mLowerBounds = std::make_shared<Plato::StandardMultiVector<double>>(tNumVectors, tNumControls, 0.0 /* values */);
+    tInputs.mUpperBounds = std::make_shared<Plato::StandardMultiVector<double>>(tNumVectors, tNumControls, 2.0 /* values */);
+    tInputs.mInitialGuess = std::make_shared<Plato::StandardMultiVector<double>>(tNumVectors, tNumControls, 1.0 /* values */);
+    tInputs.mConstraintNormalizationParams = std::make_shared<Plato::StandardVector<double>>(tNumConstraints, 2.0 /* values */);
+    Plato::AlgorithmOutputsMMA<double> tOutputs;
+    Plato::solve_mma<double, size_t>(tObjective, tConstraintList, tInputs, tOutputs);
+
+    // ********* TEST SOLUTION *********
+    const double tTolerance = 1e-4;
+    EXPECT_NEAR(0.0456748, tOutputs.mObjFuncValue, tTolerance);
+    EXPECT_TRUE(std::abs((*tOutputs.mConstraints)[0]) < tTolerance);
+    Plato::StandardMultiVector<double> tGold(tNumVectors, tNumControls);
+    tGold(0,0) = 0.7864153996; tGold(0,1) = 0.6176982996;
+    PlatoTest::checkMultiVectorData(tGold, *tOutputs.mSolution);
+
+    // ********* PRINT SOLUTION *********
+    std::cout << "NUMBER OF ITERATIONS = " << tOutputs.mNumSolverIter << "\n" << std::flush;
+    std::cout << "BEST OBJECTIVE VALUE = " << tOutputs.mObjFuncValue << "\n" << std::flush;
+    std::cout << "BEST CONSTRAINT VALUE = " << (*tOutputs.mConstraints)[0] << "\n" << std::flush;
+    std::cout << "SOLUTION\n" << std::flush;
+    PlatoTest::printMultiVector(*tOutputs.mSolution);
+    std::cout << tOutputs.mStopCriterion.c_str() << "\n" << std::flush;
+}
+
+TEST(PlatoTest, MethodMovingAsymptotes_GoldsteinPriceShiftedEllipse_Dual)
+{
+    // ********* SET OBJECTIVE AND COSNTRAINT *********
+    std::shared_ptr<Plato::GoldsteinPrice<double>> tObjective = std::make_shared<Plato::GoldsteinPrice<double>>();
+    std::shared_ptr<Plato::ShiftedEllipse<double>> tConstraint = std::make_shared<Plato::ShiftedEllipse<double>>();
+    tConstraint->specify(0., 1., .5, 1.5);
+    std::shared_ptr<Plato::CriterionList<double>> tConstraintList = std::make_shared<Plato::CriterionList<double>>();
+    tConstraintList->add(tConstraint);
+
+    // ********* SOLVE OPTIMIZATION PROBLEM *********
+    const size_t tNumVectors = 1;
+    const size_t tNumControls = 2;
+    const size_t tNumConstraints = 1;
+    Plato::AlgorithmInputsMMA<double> tInputs;
+    //tInputs.mPrintMMADiagnostics = true;
+    tInputs.mUseDualForMMASubproblem = true;
+    tInputs.mLowerBounds = std::make_shared<Plato::StandardMultiVector<double>>(tNumVectors, tNumControls, -3.0 /* values */);
+    tInputs.mUpperBounds = std::make_shared<Plato::StandardMultiVector<double>>(tNumVectors, tNumControls, 0.0 /* values */);
+    tInputs.mInitialGuess = std::make_shared<Plato::StandardMultiVector<double>>(tNumVectors, tNumControls, -0.4 /* values */);
+    tInputs.mConstraintNormalizationParams = std::make_shared<Plato::StandardVector<double>>(tNumConstraints, 2 /* values */);
+    Plato::AlgorithmOutputsMMA<double> tOutputs;
+    Plato::solve_mma<double, size_t>(tObjective, tConstraintList, tInputs, tOutputs);
+
+    // ********* TEST SOLUTION *********
+    // exact subproblem solutions follow the descent path into the local minimum next to the initial guess
+    const double tTolerance = 1e-4;
+    ASSERT_NEAR(30, tOutputs.mObjFuncValue, tTolerance);
+    ASSERT_TRUE((*tOutputs.mConstraints)[0] < 0.0);
+    Plato::StandardMultiVector<double> tGold(tNumVectors, tNumControls);
+    tGold(0,0) = -0.6; tGold(0,1) = -0.4;
+    PlatoTest::checkMultiVectorData(tGold, *tOutputs.mSolution, tTolerance);
+
+    // ********* PRINT SOLUTION *********
+    std::cout << "NUMBER OF ITERATIONS = " << tOutputs.mNumSolverIter << "\n" << std::flush;
+    std::cout << "BEST OBJECTIVE VALUE = " << tOutputs.mObjFuncValue << "\n" << std::flush;
+    std::cout << "BEST CONSTRAINT VALUE = " << (*tOutputs.mConstraints)[0] << "\n" << std::flush;
+    std::cout << "SOLUTION\n" << std::flush;
+    PlatoTest::printMultiVector(*tOutputs.mSolution);
+    std::cout << tOutputs.mStopCriterion.c_str() << "\n" << std::flush;
+}
+
+TEST(PlatoTest, MethodMovingAsymptotes_CircleRadius_Dual)
+{
+    // ********* SET OBJECTIVE AND COSNTRAINT *********
+    std::shared_ptr<Plato::Circle<double>> tObjective = std::make_shared<Plato::Circle<double>>();
+    std::shared_ptr<Plato::Radius<double>> tConstraint = std::make_shared<Plato::Radius<double>>();
+    std::shared_ptr<Plato::CriterionList<double>> tConstraintList = std::make_shared<Plato::CriterionList<double>>();
+    tConstraintList->add(tConstraint);
+
+    // ********* SOLVE OPTIMIZATION PROBLEM *********
+    const size_t tNumVectors = 1;
+    const size_t tNumControls = 2;
+    const size_t tNumConstraints = 1;
+    Plato::AlgorithmInputsMMA<double> tInputs;
+    //tInputs.mPrintMMADiagnostics = true;
+    tInputs.mUseDualForMMASubproblem = true;
+    tInputs.mLowerBounds = std::make_shared<Plato::StandardMultiVector<double>>(tNumVectors, tNumControls, 0.0 /* values */);
+    tInputs.mUpperBounds = std::make_shared<Plato::StandardMultiVector<double>>(tNumVectors, tNumControls, 2.0 /* values */);
+    tInputs.mInitialGuess = std::make_shared<Plato::StandardMultiVector<double>>(tNumVectors, tNumControls, 0.5 /* values */);
+    tInputs.mConstraintNormalizationParams = std::make_shared<Plato::StandardVector<double>>(tNumConstraints, 0.5 /* values */);
+    Plato::AlgorithmOutputsMMA<double> tOutputs;
+    Plato::solve_mma<double, size_t>(tObjective, tConstraintList, tInputs, tOutputs);
+
+    // ********* TEST SOLUTION *********
+    const double tTolerance = 1e-4;
+    ASSERT_NEAR(2.678, tOutputs.mObjFuncValue, tTolerance);
+    ASSERT_TRUE(std::abs((*tOutputs.mConstraints)[0]) < tTolerance);
+    Plato::StandardMultiVector<double> tGold(tNumVectors, tNumControls);
+    tGold(0,0) =  0.3115704953; tGold(0,1) = 0.9502230404;
+    PlatoTest::checkMultiVectorData(tGold, *tOutputs.mSolution, tTolerance);
+
+    // ********* PRINT SOLUTION *********
+    std::cout << "NUMBER OF ITERATIONS = " << tOutputs.mNumSolverIter << "\n" << std::flush;
+    std::cout << "BEST OBJECTIVE VALUE = " << tOutputs.mObjFuncValue << "\n" << std::flush;
+    std::cout << "BEST CONSTRAINT VALUE = " << (*tOutputs.mConstraints)[0] << "\n" << std::flush;
+    std::cout << "SOLUTION\n" << std::flush;
+    PlatoTest::printMultiVector(*tOutputs.mSolution);
+    std::cout << tOutputs.mStopCriterion.c_str() << "\n" << std::flush;
+}
+
+TEST(PlatoTest, PERF_MethodMovingAsymptotes_DualVersusKSAL)
+{
+    // ********* SOLVE PROBLEM WITH KSAL AND DUAL SUBPROBLEM SOLVERS *********
+    auto tSolve = [](const std::string & aName,
+                     const std::shared_ptr<Plato::Criterion<double>> & aObjective,
+                     const std::shared_ptr<Plato::CriterionList<double>> & aConstraints,
+                     Plato::AlgorithmInputsMMA<double> & aInputs)
+    {
+        std::vector<double> tObjectiveValues;
+        for(const bool tUseDual : {false, true})
+        {
+            aInputs.mUseDualForMMASubproblem = tUseDual;
+            Plato::AlgorithmOutputsMMA<double> tOutputs;
+            std::chrono::steady_clock::time_point tStart = std::chrono::steady_clock::now();
+            Plato::solve_mma<double, size_t>(aObjective, aConstraints, aInputs, tOutputs);
+            const double tTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - tStart).count();
+            tObjectiveValues.push_back(tOutputs.mObjFuncValue);
+            std::cout << aName << (tUseDual ? ": DUAL" : ": KSAL") << ", ITERATIONS = " << tOutputs.mNumSolverIter
+                      << ", OBJECTIVE = " << tOutputs.mObjFuncValue << ", CONSTRAINT = " << (*tOutputs.mConstraints)[0]
+                      << ", TIME = " << tTime << " sec\n" << std::flush;
+        }
+        return (tObjectiveValues);
+    };
+
+    const size_t tNumVectors = 1;
+    const size_t tNumConstraints = 1;
+
+    // ********* ROSENBROCK WITH RADIUS CONSTRAINT *********
+    {
+        std::shared_ptr<Plato::CriterionList<double>> tConstraintList = std::make_shared<Plato::CriterionList<double>>();
+        tConstraintList->add(std::make_shared<Plato::Radius<double>>());
+        const size_t tNumControls = 2;
+        Plato::AlgorithmInputsMMA<double> tInputs;
+        tInputs.mMoveLimit = 0.1;
+        tInputs.mLowerBounds = std::make_shared<Plato::StandardMultiVector<double>>(tNumVectors, tNumControls, 0.0 /* values */);
+        tInputs.mUpperBounds = std::make_shared<Plato::StandardMultiVector<double>>(tNumVectors, tNumControls, 2.0 /* values */);
+        tInputs.mInitialGuess = std::make_shared<Plato::StandardMultiVector<double>>(tNumVectors, tNumControls, 1.0 /* values */);
+        tInputs.mConstraintNormalizationParams = std::make_shared<Plato::StandardVector<double>>(tNumConstraints, 2.0 /* values */);
+        std::vector<double> tValues = tSolve("ROSENBROCK", std::make_shared<Plato::Rosenbrock<double>>(), tConstraintList, tInputs);
+        EXPECT_NEAR(tValues[0], tValues[1], 1e-4);
+    }
+
+    // ********* CIRCLE WITH RADIUS CONSTRAINT *********
+    {
+        std::shared_ptr<Plato::CriterionList<double>> tConstraintList = std::make_shared<Plato::CriterionList<double>>();
+        tConstraintList->add(std::make_shared<Plato::Radius<double>>());
+        const size_t tNumControls = 2;
+        Plato::AlgorithmInputsMMA<double> tInputs;
+        tInputs.mLowerBounds = std::make_shared<Plato::StandardMultiVector<double>>(tNumVectors, tNumControls, 0.0 /* values */);
+        tInputs.mUpperBounds = std::make_shared<Plato::StandardMultiVector<double>>(tNumVectors, tNumControls, 2.0 /* values */);
+        tInputs.mInitialGuess = std::make_shared<Plato::StandardMultiVector<double>>(tNumVectors, tNumControls, 0.5 /* values */);
+        tInputs.mConstraintNormalizationParams = std::make_shared<Plato::StandardVector<double>>(tNumConstraints, 0.5 /* values */);
+        std::vector<double> tValues = tSolve("CIRCLE", std::make_shared<Plato::Circle<double>>(), tConstraintList, tInputs);
+        EXPECT_NEAR(tValues[0], tValues[1], 1e-4);
+    }
+
+    // ********* FIVE BARS *********
+    {
+        std::shared_ptr<Plato::CriterionList<double>> tConstraintList = std::make_shared<Plato::CriterionList<double>>();
+        tConstraintList->add(std::make_shared<Plato::CcsaTestInequality<double>>());
+        const size_t tNumControls = 5;
+        Plato::AlgorithmInputsMMA<double> tInputs;
+        tInputs.mLowerBounds = std::make_shared<Plato::StandardMultiVector<double>>(tNumVectors, tNumControls, 1.0 /* values */);
+        tInputs.mUpperBounds = std::make_shared<Plato::StandardMultiVector<double>>(tNumVectors, tNumControls, 10.0 /* values */);
+        tInputs.mInitialGuess = std::make_shared<Plato::StandardMultiVector<double>>(tNumVectors, tNumControls, 5.0 /* values */);
+        tInputs.mConstraintNormalizationParams = std::make_shared<Plato::StandardVector<double>>(tNumConstraints, 1.0 /* values */);
+        std::vector<double> tValues = tSolve("FIVE BARS", std::make_shared<Plato::CcsaTestObjective<double>>(), tConstraintList, tInputs);
+        EXPECT_NEAR(1.3399563684500915, tValues[1], 1e-4);
+    }
+
+    // ********* STRUCTURAL TOPOLOGY OPTIMIZATION PROXY: COMPLIANCE AND VOLUME *********
+    {
+        const double tPoissonRatio = 0.3;
+        const double tElasticModulus = 1;
+        const int tNumElementsXdirection = 30;
+        const int tNumElementsYdirection = 10;
+        std::shared_ptr<Plato::StructuralTopologyOptimization> tPDE =
+                std::make_shared<Plato::StructuralTopologyOptimization>(tPoissonRatio, tElasticModulus, tNumElementsXdirection, tNumElementsYdirection);
+
+        const int tGlobalNumDofs = tPDE->getGlobalNumDofs();
+        Epetra_SerialDenseVector tForce(tGlobalNumDofs);
+        const int tDOFsIndex = 1;
+        tForce[tDOFsIndex] = -1;
+        tPDE->setForceVector(tForce);
+
+        std::vector<double> tDofs = {0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 681};
+        Epetra_SerialDenseVector tFixedDOFs(Epetra_DataAccess::Copy, tDofs.data(), tDofs.size());
+        tPDE->setFixedDOFs(tFixedDOFs);
+
+        std::shared_ptr<Plato::CriterionList<double>> tConstraintList = std::make_shared<Plato::CriterionList<double>>();
+        tConstraintList->add(std::make_shared<Plato::ProxyVolume<double>>(tPDE));
+        const size_t tNumControls = tPDE->getNumDesignVariables();
+        Plato::AlgorithmInputsMMA<double> tInputs;
+        tInputs.mMaxNumSolverIter = 50;
+        tInputs.mLowerBounds = std::make_shared<Plato::EpetraSerialDenseMultiVector<double>>(tNumVectors, tNumControls, 1e-2 /* values */);
+        tInputs.mUpperBounds = std::make_shared<Plato::EpetraSerialDenseMultiVector<double>>(tNumVectors, tNumControls, 1.0 /* values */);
+        tInputs.mInitialGuess = std::make_shared<Plato::EpetraSerialDenseMultiVector<double>>(tNumVectors, tNumControls, tPDE->getVolumeFraction());
+        tInputs.mConstraintNormalizationParams = std::make_shared<Plato::StandardVector<double>>(tNumConstraints, 1.0 /* values */);
+        std::vector<double> tValues = tSolve("STRUCTURAL PROXY", std::make_shared<Plato::ProxyCompliance<double>>(tPDE), tConstraintList, tInputs);
+        EXPECT_NEAR(tValues[0], tValues[1], 1e-2 * tValues[0]);
+    }
+}
+
 }
@@ -0,0 +1,113 @@
+/*
+ * Plato_Test_MockInterface.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+#include <cassert>
+
+#include "Plato_Interface.hpp"
+
+namespace PlatoTest
+{
+
+/******************************************************************************//**
+ * \brief Interface test double. Stage calls do not run performers; each stage added
+ * with addStage sets its i-th output to the sum of the entries of its i-th input.
+ * The interface records the number of calls and the inputs of each call per stage.
+**********************************************************************************/
+class MockInterface : public Plato::Interface
+{
+public:
+    explicit MockInterface(const Plato::InputData & aInputData = Plato::InputData("Input Data")) :
+            Plato::Interface(aInputData),
+            mStages()
+    {
+    }
+
+    virtual ~MockInterface()
+    {
+    }
+
+    /******************************************************************************//**
+     * \brief Add stage, its i-th input pairs with its i-th output
+     * \param [in] aStageName stage name
+     * \param [in] aInputs input shared data names
+     * \param [in] aOutputs output shared data names
+     * \param [in] aInputLength number of entries of each input
+    **********************************************************************************/
+    void addStage(const std::string & aStageName,
+                  const std::vector<std::string> & aInputs,
+                  const std::vector<std::string> & aOutputs,
+                  size_t aInputLength)
+    {
+        assert(aInputs.size() == aOutputs.size());
+        MockStage & tStage = mStages[aStageName];
+        tStage.mInputs = aInputs;
+        tStage.mOutputs = aOutputs;
+        tStage.mInputLength = aInputLength;
+    }
+
+    size_t getNumStageCalls(const std::string & aStageName) const
+    {
+        auto tIterator = mStages.find(aStageName);
+        return tIterator == mStages.end() ? 0u : tIterator->second.mCalls.size();
+    }
+
+    /******************************************************************************//**
+     * \brief Return the inputs of a stage call
+     * \param [in] aStageName stage name
+     * \param [in] aCallIndex stage call index
+     * \return inputs of the call, one vector per input
+    **********************************************************************************/
+    const std::vector<std::vector<double>> & getStageCallInputs(const std::string & aStageName, size_t aCallIndex) const
+    {
+        return mStages.at(aStageName).mCalls.at(aCallIndex);
+    }
+
+    void compute(const std::vector<std::string> & aStageNames, Teuchos::ParameterList & aArguments) override
+    {
+        for(const std::string & tStageName : aStageNames)
+        {
+            auto tIterator = mStages.find(tStageName);
+            if(tIterator == mStages.end())
+            {
+                continue;
+            }
+
+            MockStage & tStage = tIterator->second;
+            std::vector<std::vector<double>> tCallInputs;
+            for(size_t tIndex = 0; tIndex < tStage.mInputs.size(); tIndex++)
+            {
+                const double* tInput = aArguments.get<double*>(tStage.mInputs[tIndex]);
+                tCallInputs.push_back(std::vector<double>(tInput, tInput + tStage.mInputLength));
+
+                double tSum = 0;
+                for(double tValue : tCallInputs.back())
+                {
+                    tSum += tValue;
+                }
+                *aArguments.get<double*>(tStage.mOutputs[tIndex]) = tSum;
+            }
+            tStage.mCalls.push_back(tCallInputs);
+        }
+    }
+
+private:
+    struct MockStage
+    {
+        std::vector<std::string> mInputs;
+        std::vector<std::string> mOutputs;
+        size_t mInputLength = 0;
+        std::vector<std::vector<std::vector<double>>> mCalls;
+    };
+
+    std::map<std::string, MockStage> mStages;
+};
+
+}
@@ -51,6 +51,7 @@
 #include "Plato_UnitTestUtils.hpp"
 
 #include "Plato_DataFactory.hpp"
+#include "Plato_DistributedVector.hpp"
 #include "Plato_CriterionList.hpp"
 #include "Plato_OptimalityCriteria.hpp"
 #include "Plato_StandardMultiVector.hpp"
@@ -60,6 +61,7 @@
 #include "Plato_NonlinearProgrammingSubProblemOC.hpp"
 #include "Plato_SingleConstraintSubProblemTypeLP.hpp"
 #include "Plato_StandardVectorReductionOperations.hpp"
+#include "Plato_DistributedReductionOperations.hpp"
 #include "Plato_OptimalityCriteriaTestObjectiveOne.hpp"
 #include "Plato_OptimalityCriteriaTestObjectiveTwo.hpp"
 #include "Plato_OptimalityCriteriaTestInequalityOne.hpp"
@@ -0,0 +1,74 @@
+/*
+ * Plato_Test_ParameterDataBuilder.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+#include "Plato_InputData.hpp"
+#include "Plato_Exceptions.hpp"
+#include "PSL_ParameterData.hpp"
+#include "PSL_ParameterDataEnums.hpp"
+#include "PSL_InterfaceToEngine_ParameterDataBuilder.hpp"
+
+namespace PlatoTest
+{
+
+namespace
+{
+Plato::InputData makeFilterInputData(const std::string & aSpatialSearcher, const std::string & aNumThreads)
+{
+    Plato::InputData tFilter("Filter");
+    if(aSpatialSearcher.empty() == false)
+    {
+        tFilter.add<std::string>("SpatialSearcher", aSpatialSearcher);
+    }
+    if(aNumThreads.empty() == false)
+    {
+        tFilter.add<std::string>("NumThreads", aNumThreads);
+    }
+    Plato::InputData tInputData("Input Data");
+    tInputData.add<Plato::InputData>("Filter", tFilter);
+    return tInputData;
+}
+
+std::unique_ptr<PlatoSubproblemLibrary::ParameterData> build(const Plato::InputData & aInputData)
+{
+    Plato::InterfaceToEngine_ParameterDataBuilder tBuilder(aInputData);
+    return std::unique_ptr<PlatoSubproblemLibrary::ParameterData>(tBuilder.build());
+}
+}
+
+TEST(PlatoTest, ParameterDataBuilder_SpatialSearcherAndNumThreads)
+{
+    auto tData = build(makeFilterInputData("HashedGrid", "4"));
+    EXPECT_EQ(PlatoSubproblemLibrary::spatial_searcher_t::hashed_grid_fixed_radius_nearest_neighbors, tData->get_spatial_searcher());
+    ASSERT_TRUE(tData->didUserInput_num_threads());
+    EXPECT_EQ(4, tData->get_num_threads());
+
+    tData = build(makeFilterInputData("radixgrid", ""));
+    EXPECT_EQ(PlatoSubproblemLibrary::spatial_searcher_t::radix_grid_fixed_radius_nearest_neighbors, tData->get_spatial_searcher());
+    EXPECT_FALSE(tData->didUserInput_num_threads());
+}
+
+TEST(PlatoTest, ParameterDataBuilder_FilterDefaults)
+{
+    auto tData = build(makeFilterInputData("", ""));
+    EXPECT_EQ(PlatoSubproblemLibrary::spatial_searcher_t::recommended, tData->get_spatial_searcher());
+    EXPECT_FALSE(tData->didUserInput_num_threads());
+
+    tData = build(Plato::InputData("Input Data"));
+    EXPECT_EQ(PlatoSubproblemLibrary::spatial_searcher_t::recommended, tData->get_spatial_searcher());
+}
+
+TEST(PlatoTest, ParameterDataBuilder_InvalidFilterOptions)
+{
+    EXPECT_THROW(build(makeFilterInputData("Octree", "")), Plato::ParsingException);
+    EXPECT_THROW(build(makeFilterInputData("", "0")), Plato::ParsingException);
+}
+
+}
@@ -60,8 +60,10 @@
 #include "Plato_ParticleSwarmInterfaceBCPSO.hpp"
 #include "Plato_ParticleSwarmInterfaceALPSO.hpp"
 #include "Plato_ParticleSwarmParser.hpp"
+#include "Plato_GradFreeEngineCriterion.hpp"
 
 #include "Plato_UnitTestUtils.hpp"
+#include "Plato_Test_MockInterface.hpp"
 #include <Plato_FreeFunctions.hpp>
 
 namespace ParticleSwarmTest
@@ -606,6 +608,58 @@ TEST(PlatoTest, read_restart_data_value_error)
     }
 }
 
+TEST(PlatoTest, write_read_restart_field)
+{
+    int tMyRank = 0;
+    int tMySize = 0;
+    MPI_Comm_rank(MPI_COMM_WORLD, &tMyRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &tMySize);
+
+    // ****** EACH RANK OWNS THREE NODES, PASSED IN DESCENDING ORDER ******
+    const int tNumOwned = 3;
+    std::vector<long long> tOwnedIds;
+    std::vector<double> tOwnedValues;
+    for(int tIndex = tNumOwned - 1; tIndex >= 0; tIndex--)
+    {
+        const long long tGlobalId = tMyRank * tNumOwned + tIndex + 1;
+        tOwnedIds.push_back(tGlobalId);
+        tOwnedValues.push_back(0.5 * tGlobalId);
+    }
+    const std::string tFileName("MyRestartField.plato");
+    Plato::write_restart_field(MPI_COMM_WORLD, tFileName, "control", 7, tOwnedIds, tOwnedValues);
+    MPI_Barrier(MPI_COMM_WORLD);
+    ASSERT_TRUE(Plato::is_native_restart_file(tFileName));
+
+    // ****** READ BACK WITH A DIFFERENT DECOMPOSITION: EVERY RANK READS EVERY NODE ******
+    std::vector<long long> tAllIds;
+    for(long long tGlobalId = tMySize * tNumOwned; tGlobalId >= 1; tGlobalId--)
+    {
+        tAllIds.push_back(tGlobalId);
+    }
+    std::vector<double> tValues;
+    const int tIteration = Plato::read_restart_field(MPI_COMM_WORLD, tFileName, "control", tAllIds, tValues);
+    ASSERT_EQ(7, tIteration);
+    ASSERT_EQ(tAllIds.size(), tValues.size());
+    const double tTolerance = 1e-14;
+    for(size_t tIndex = 0; tIndex < tAllIds.size(); tIndex++)
+    {
+        ASSERT_NEAR(0.5 * tAllIds[tIndex], tValues[tIndex], tTolerance);
+    }
+
+    // ****** ERROR - FIELD NAME DOES NOT MATCH ******
+    ASSERT_THROW(Plato::read_restart_field(MPI_COMM_WORLD, tFileName, "topology", tAllIds, tValues), std::runtime_error);
+
+    // ****** ERROR - GLOBAL ID IS NOT IN FILE ******
+    std::vector<long long> tMissingIds = {tMySize * tNumOwned + 1};
+    ASSERT_THROW(Plato::read_restart_field(MPI_COMM_WORLD, tFileName, "control", tMissingIds, tValues), std::runtime_error);
+
+    MPI_Barrier(MPI_COMM_WORLD);
+    if(tMyRank == 0)
+    {
+        Plato::system("rm -f MyRestartField.plato");
+    }
+}
+
 TEST(PlatoTest, IsParticleUnique)
 {
     // SET DATA MANAGER
@@ -2192,4 +2246,50 @@ TEST(PlatoTest, PSO_SolveALPSO_CircleObj_RadiusEqConstr)
     }
 }
 
+TEST(PlatoTest, GradFreeEngineCriterion_StageCallsPerRound)
+{
+    // ********* TWO EVALUATION SLOTS, FIVE PARTICLES *********
+    const size_t tNumControls = 3;
+    const size_t tNumParticles = 5;
+    const std::string tStageName("Objective");
+    const std::vector<std::string> tInputs = {"Particle 0", "Particle 1"};
+    const std::vector<std::string> tOutputs = {"Objective Value 0", "Objective Value 1"};
+    Plato::StageInputDataMng tStageDataMng;
+    tStageDataMng.add(tStageName, tInputs, tOutputs);
+
+    PlatoTest::MockInterface tInterface;
+    tInterface.addStage(tStageName, tInputs, tOutputs, tNumControls);
+    Plato::GradFreeEngineCriterion<double> tCriterion(tNumControls, tNumParticles, tStageDataMng, &tInterface);
+    ASSERT_EQ(2u, tCriterion.getNumSlots());
+
+    Plato::StandardMultiVector<double> tParticles(tNumParticles, tNumControls);
+    for(size_t tParticle = 0; tParticle < tNumParticles; tParticle++)
+    {
+        tParticles[tParticle].fill(tParticle + 1);
+    }
+    Plato::StandardVector<double> tValues(tNumParticles);
+    tCriterion.value(tParticles, tValues);
+
+    // ********* ONE STAGE CALL PER ROUND OF TWO PARTICLES *********
+    ASSERT_EQ(3u, tInterface.getNumStageCalls(tStageName));
+    const double tTolerance = 1e-12;
+    for(size_t tParticle = 0; tParticle < tNumParticles; tParticle++)
+    {
+        EXPECT_NEAR(tNumControls * (tParticle + 1.0), tValues[tParticle], tTolerance);
+    }
+
+    // ********* THE UNUSED SLOT OF THE LAST ROUND KEEPS THE PREVIOUS ROUND'S PARTICLE *********
+    const std::vector<std::vector<double>> & tLastRoundInputs = tInterface.getStageCallInputs(tStageName, 2);
+    EXPECT_NEAR(5.0, tLastRoundInputs[0][0], tTolerance);
+    EXPECT_NEAR(4.0, tLastRoundInputs[1][0], tTolerance);
+}
+
+TEST(PlatoTest, GradFreeEngineCriterion_StageWithoutInputs)
+{
+    Plato::StageInputDataMng tStageDataMng;
+    tStageDataMng.add("Objective", std::vector<std::string>(), std::vector<std::string>());
+    PlatoTest::MockInterface tInterface;
+    EXPECT_THROW((Plato::GradFreeEngineCriterion<double>(3, 5, tStageDataMng, &tInterface)), std::runtime_error);
+}
+
 } // ParticleSwarmTest
@@ -6,6 +6,8 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <cstdio>
 #include <memory>
 #include <iterator>
 #include <algorithm>
@@ -28,6 +30,7 @@
 // Plato includes
 #include "Plato_DakotaDriver.hpp"
 #include "Plato_DakotaDataMap.hpp"
+#include "Plato_DakotaEvaluationCache.hpp"
 #include "lightmp.hpp"
 #include "Plato_Macros.hpp"
 #include "Plato_Parser.hpp"
@@ -964,5 +967,84 @@ TEST(PlatoTest, DakotaDataMap_constructor_error_checking)
     EXPECT_THROW(Plato::DakotaDataMap tDataMap(tInputData),std::runtime_error);;
 }
 
+
+TEST(PlatoTest, DakotaEvaluationCache_find)
+{
+    Plato::DakotaEvaluationCache tCache("", 1e-10);
+
+    Plato::dakota::EvaluationRecord tRecord;
+    tRecord.mContinuousVars = {0.5, -1.25};
+    tRecord.mDiscreteIntegerVars = {3};
+    tRecord.mActiveSet = {1, 0};
+    tRecord.mValues = {2.0, 0.0};
+    tRecord.mGradients.resize(2);
+
+    Plato::dakota::EvaluationRecord tResult;
+    EXPECT_FALSE(tCache.find(tRecord, tResult));
+    tCache.insert(tRecord);
+    EXPECT_TRUE(tCache.find(tRecord, tResult));
+    EXPECT_DOUBLE_EQ(2.0, tResult.mValues[0]);
+
+    // within tolerance
+    auto tQuery = tRecord;
+    tQuery.mContinuousVars[0] += 1e-12;
+    EXPECT_TRUE(tCache.find(tQuery, tResult));
+
+    // outside tolerance
+    tQuery.mContinuousVars[0] += 1e-6;
+    EXPECT_FALSE(tCache.find(tQuery, tResult));
+
+    // different discrete variables
+    tQuery = tRecord;
+    tQuery.mDiscreteIntegerVars = {4};
+    EXPECT_FALSE(tCache.find(tQuery, tResult));
+
+    // gradient not evaluated yet
+    tQuery = tRecord;
+    tQuery.mActiveSet = {3, 0};
+    EXPECT_FALSE(tCache.find(tQuery, tResult));
+
+    // gradient evaluation is merged into the existing record
+    tQuery.mGradients[0] = {1.0, 0.1};
+    tCache.insert(tQuery);
+    EXPECT_EQ(1u, tCache.size());
+    EXPECT_TRUE(tCache.find(tQuery, tResult));
+    EXPECT_DOUBLE_EQ(2.0, tResult.mValues[0]);
+    ASSERT_EQ(2u, tResult.mGradients[0].size());
+    EXPECT_DOUBLE_EQ(0.1, tResult.mGradients[0][1]);
+}
+
+TEST(PlatoTest, DakotaEvaluationCache_restart)
+{
+    std::string tFileName("dakota_evaluation_cache_test.txt");
+    std::remove(tFileName.c_str());
+
+    Plato::dakota::EvaluationRecord tRecord;
+    tRecord.mContinuousVars = {0.1, 0.2};
+    tRecord.mDiscreteRealVars = {1.5};
+    tRecord.mActiveSet = {3};
+    tRecord.mValues = {-4.0};
+    tRecord.mGradients = {{0.3, 1.0/3.0}};
+    {
+        Plato::DakotaEvaluationCache tCache(tFileName);
+        tCache.insert(tRecord);
+    }
+
+    Plato::DakotaEvaluationCache tRestartedCache(tFileName);
+    EXPECT_EQ(1u, tRestartedCache.size());
+
+    Plato::dakota::EvaluationRecord tResult;
+    EXPECT_TRUE(tRestartedCache.find(tRecord, tResult));
+    EXPECT_EQ(-4.0, tResult.mValues[0]);
+    ASSERT_EQ(2u, tResult.mGradients[0].size());
+    EXPECT_EQ(1.0/3.0, tResult.mGradients[0][1]);
+
+    // zero tolerance only matches identical values
+    auto tQuery = tRecord;
+    tQuery.mContinuousVars[1] = std::nextafter(0.2, 1.0);
+    EXPECT_FALSE(tRestartedCache.find(tQuery, tResult));
+
+    std::remove(tFileName.c_str());
+}
 }
 // TestPlatoDakotaInterfack
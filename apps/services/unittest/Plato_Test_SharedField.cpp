@@ -0,0 +1,330 @@
+/*
+ * Plato_Test_SharedField.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <gtest/gtest.h>
+
+#include <mpi.h>
+
+#include <vector>
+#include <sstream>
+
+#include <boost/archive/xml_oarchive.hpp>
+#include <boost/archive/xml_iarchive.hpp>
+
+#include "Plato_Stage.hpp"
+#include "Plato_Operation.hpp"
+#include "Plato_Performer.hpp"
+#include "Plato_Application.hpp"
+#include "Plato_SharedField.hpp"
+#include "Plato_SingleOperation.hpp"
+#include "Plato_Communication.hpp"
+#include "Plato_SharedDataInfo.hpp"
+#include "Plato_StageInputDataMng.hpp"
+#include "Plato_OperationInputDataMng.hpp"
+#include "Plato_Test_MockInterface.hpp"
+
+namespace PlatoTest
+{
+
+namespace
+{
+Plato::CommunicationData makeFieldCommunicationData(int aNumLocalNodes)
+{
+    int tMyRank = -1;
+    MPI_Comm_rank(MPI_COMM_WORLD, &tMyRank);
+
+    Plato::CommunicationData tCommData;
+    tCommData.mLocalComm = MPI_COMM_SELF;
+    tCommData.mInterComm = MPI_COMM_WORLD;
+    tCommData.mLocalCommName = "PlatoMain";
+    auto tLayout = Plato::data::layout_t::SCALAR_FIELD;
+    for(int tIndex = 0; tIndex < aNumLocalNodes; tIndex++)
+    {
+        tCommData.mMyOwnedGlobalIDs[tLayout].push_back(aNumLocalNodes * tMyRank + tIndex + 1);
+    }
+    return tCommData;
+}
+
+Plato::StageInputDataMng makeStageInputData(const std::string & aStageName, const std::string & aInputName)
+{
+    Plato::StageInputDataMng tStageInputData;
+    tStageInputData.add(aStageName, {aInputName}, {});
+    return tStageInputData;
+}
+
+/******************************************************************************//**
+ * \brief Operation without performer that takes one input shared data
+**********************************************************************************/
+class InputOperation : public Plato::Operation
+{
+public:
+    InputOperation(const std::string & aInputName, const std::vector<Plato::SharedData*> & aSharedData)
+    {
+        this->addArgument(aInputName, aInputName, aSharedData, m_inputData);
+    }
+
+    void update(const Plato::OperationInputDataMng & aOperationDataMng,
+                const std::shared_ptr<Plato::Performer> aPerformer,
+                const std::vector<Plato::SharedData*>& aSharedData) override
+    {
+    }
+};
+
+/******************************************************************************//**
+ * \brief Application that counts its computes
+**********************************************************************************/
+class CountingApplication : public Plato::Application
+{
+public:
+    void finalize() override {}
+    void initialize() override {}
+    void compute(const std::string & aOperationName) override { mNumComputes++; }
+    void exportData(const std::string & aArgumentName, Plato::SharedData & aExportData) override {}
+    void importData(const std::string & aArgumentName, const Plato::SharedData & aImportData) override {}
+    void exportDataMap(const Plato::data::layout_t & aDataLayout, std::vector<int> & aMyOwnedGlobalIDs) override {}
+
+    int mNumComputes = 0;
+};
+
+Plato::OperationInputDataMng makeOperationInputData(const std::string & aSkipUnchangedInputs)
+{
+    Plato::OperationInputDataMng tOperationData;
+    tOperationData.addInputs("Slot", "Compute Value", {"Topology"}, {"Topology"});
+    tOperationData.add<Plato::InputData>("Parameters", Plato::InputData("Parameters"));
+    tOperationData.set<std::string>("SkipUnchangedInputs", aSkipUnchangedInputs);
+    return tOperationData;
+}
+}
+
+TEST(PlatoTest, SharedField_SkipUnchangedTransmit)
+{
+    const int tNumLocalNodes = 5;
+    Plato::CommunicationData tCommData = makeFieldCommunicationData(tNumLocalNodes);
+    Plato::SharedField tTopology("Topology", Plato::communication::broadcast_t::SENDER_AND_RECEIVER,
+                                 tCommData, Plato::data::layout_t::SCALAR_FIELD);
+
+    // two stages that take the same topology
+    std::vector<Plato::SharedData*> tSharedData = {&tTopology};
+    Plato::Stage tVolumeStage(makeStageInputData("Compute Volume", "Topology"), nullptr, tSharedData);
+    Plato::Stage tObjectiveStage(makeStageInputData("Compute Objective", "Topology"), nullptr, tSharedData);
+
+    PlatoTest::MockInterface tInterface;
+    Plato::TransmissionStatistics & tStatistics = Plato::SharedData::getTransmissionStatistics();
+    const long long tNumBytes = tNumLocalNodes * sizeof(double);
+
+    std::vector<double> tControl(tNumLocalNodes, 0.5);
+    tInterface.exportData(tControl.data(), &tTopology);
+    Plato::TransmissionStatistics tStart = tStatistics;
+    tVolumeStage.begin();
+    tVolumeStage.end();
+    EXPECT_EQ(tNumBytes, tStatistics.mBytesMoved - tStart.mBytesMoved);
+
+    // the second stage exports the same values, so its transmit sends nothing
+    tInterface.exportData(tControl.data(), &tTopology);
+    tStart = tStatistics;
+    tObjectiveStage.begin();
+    tObjectiveStage.end();
+    EXPECT_EQ(0, tStatistics.mBytesMoved - tStart.mBytesMoved);
+    EXPECT_EQ(tNumBytes, tStatistics.mBytesSkipped - tStart.mBytesSkipped);
+    EXPECT_EQ(1u, tTopology.getImportedVersion());
+
+    std::vector<double> tResult(tNumLocalNodes, 0.0);
+    tInterface.importData(tResult.data(), &tTopology);
+    for(int tIndex = 0; tIndex < tNumLocalNodes; tIndex++)
+    {
+        EXPECT_DOUBLE_EQ(0.5, tResult[tIndex]);
+    }
+
+    // a new value on any rank makes every rank transfer
+    int tMyRank = -1;
+    MPI_Comm_rank(MPI_COMM_WORLD, &tMyRank);
+    if(tMyRank == 0)
+    {
+        tControl[0] = 0.75;
+    }
+    tInterface.exportData(tControl.data(), &tTopology);
+    tStart = tStatistics;
+    tVolumeStage.begin();
+    tVolumeStage.end();
+    EXPECT_EQ(tNumBytes, tStatistics.mBytesMoved - tStart.mBytesMoved);
+    EXPECT_EQ(2u, tTopology.getImportedVersion());
+    tInterface.importData(tResult.data(), &tTopology);
+    EXPECT_DOUBLE_EQ(tMyRank == 0 ? 0.75 : 0.5, tResult[0]);
+}
+
+TEST(PlatoTest, SharedField_SkipUnchangedOperationInputs)
+{
+    const int tNumLocalNodes = 3;
+    Plato::CommunicationData tCommData = makeFieldCommunicationData(tNumLocalNodes);
+    Plato::SharedField tTopology("Topology", Plato::communication::broadcast_t::SENDER_AND_RECEIVER,
+                                 tCommData, Plato::data::layout_t::SCALAR_FIELD);
+    std::vector<Plato::SharedData*> tSharedData = {&tTopology};
+    Plato::Stage tStage(makeStageInputData("Compute Volume", "Topology"), nullptr, tSharedData);
+    InputOperation tVolumeOperation("Topology", tSharedData);
+    InputOperation tGradientOperation("Topology", tSharedData);
+
+    std::vector<double> tControl(tNumLocalNodes, 0.5);
+    PlatoTest::MockInterface tInterface;
+    tInterface.exportData(tControl.data(), &tTopology);
+
+    // the stage imports the topology once, the operations reading it import nothing
+    Plato::TransmissionStatistics & tStatistics = Plato::SharedData::getTransmissionStatistics();
+    Plato::TransmissionStatistics tStart = tStatistics;
+    tStage.begin();
+    tVolumeOperation.sendInput();
+    tGradientOperation.sendInput();
+    tStage.end();
+    EXPECT_EQ(1, tStatistics.mNumMoved - tStart.mNumMoved);
+    EXPECT_EQ(2, tStatistics.mNumSkipped - tStart.mNumSkipped);
+    EXPECT_EQ(1u, tTopology.getImportedVersion());
+}
+
+TEST(PlatoTest, Operation_SkipUnchangedInputs)
+{
+    const int tNumLocalNodes = 3;
+    Plato::CommunicationData tCommData = makeFieldCommunicationData(tNumLocalNodes);
+    Plato::SharedField tTopology("Topology", Plato::communication::broadcast_t::SENDER_AND_RECEIVER,
+                                 tCommData, Plato::data::layout_t::SCALAR_FIELD);
+    std::vector<Plato::SharedData*> tSharedData = {&tTopology};
+    Plato::Stage tStage(makeStageInputData("Compute Value", "Topology"), nullptr, tSharedData);
+
+    CountingApplication tSkippingApp;
+    auto tSkippingPerformer = std::make_shared<Plato::Performer>("Slot", 0);
+    tSkippingPerformer->setApplication(&tSkippingApp);
+    Plato::SingleOperation tSkippingOperation(makeOperationInputData("true"), tSkippingPerformer, tSharedData);
+
+    CountingApplication tApp;
+    auto tPerformer = std::make_shared<Plato::Performer>("Slot", 0);
+    tPerformer->setApplication(&tApp);
+    Plato::SingleOperation tOperation(makeOperationInputData("false"), tPerformer, tSharedData);
+
+    std::vector<double> tControl(tNumLocalNodes, 0.5);
+    PlatoTest::MockInterface tInterface;
+    for(int tRound = 0; tRound < 2; tRound++)
+    {
+        // the second round exports the same control, like a slot left unused in the final round
+        tInterface.exportData(tControl.data(), &tTopology);
+        tStage.begin();
+        tSkippingOperation.compute();
+        tOperation.compute();
+        tStage.end();
+    }
+    EXPECT_EQ(1, tSkippingApp.mNumComputes);
+    EXPECT_EQ(2, tApp.mNumComputes);
+
+    // a new control on any rank is computed
+    int tMyRank = -1;
+    MPI_Comm_rank(MPI_COMM_WORLD, &tMyRank);
+    if(tMyRank == 0)
+    {
+        tControl[0] = 0.75;
+    }
+    tInterface.exportData(tControl.data(), &tTopology);
+    tStage.begin();
+    tSkippingOperation.compute();
+    tStage.end();
+    EXPECT_EQ(2, tSkippingApp.mNumComputes);
+}
+
+TEST(PlatoTest, SharedField_BorrowedSendBufferIsTransmitted)
+{
+    const int tNumLocalNodes = 4;
+    Plato::CommunicationData tCommData = makeFieldCommunicationData(tNumLocalNodes);
+    Plato::SharedField tTopology("Topology", Plato::communication::broadcast_t::SENDER_AND_RECEIVER,
+                                 tCommData, Plato::data::layout_t::SCALAR_FIELD);
+    std::vector<Plato::SharedData*> tSharedData = {&tTopology};
+    Plato::Stage tStage(makeStageInputData("Compute Volume", "Topology"), nullptr, tSharedData);
+
+    std::vector<double> tControl(tNumLocalNodes, 0.5);
+    PlatoTest::MockInterface tInterface;
+    tInterface.exportData(tControl.data(), &tTopology);
+    tStage.begin();
+    tStage.end();
+    EXPECT_EQ(1u, tTopology.getImportedVersion());
+
+    // writes through a borrowed buffer are transmitted without any further call
+    double* tSendBuffer = tTopology.getSendBuffer();
+    ASSERT_TRUE(tSendBuffer != nullptr);
+    for(int tIndex = 0; tIndex < tNumLocalNodes; tIndex++)
+    {
+        tSendBuffer[tIndex] = 0.25;
+    }
+    tStage.begin();
+    tStage.end();
+    EXPECT_EQ(2u, tTopology.getImportedVersion());
+
+    std::vector<double> tResult(tNumLocalNodes, 0.0);
+    tInterface.importData(tResult.data(), &tTopology);
+    for(int tIndex = 0; tIndex < tNumLocalNodes; tIndex++)
+    {
+        EXPECT_DOUBLE_EQ(0.25, tResult[tIndex]);
+    }
+}
+
+TEST(PlatoTest, Stage_SerializedBatchTransmission)
+{
+    const int tNumLocalNodes = 3;
+    Plato::CommunicationData tCommData = makeFieldCommunicationData(tNumLocalNodes);
+    Plato::SharedField tTopology("Topology", Plato::communication::broadcast_t::SENDER_AND_RECEIVER,
+                                 tCommData, Plato::data::layout_t::SCALAR_FIELD);
+    Plato::SharedField tDensity("Density", Plato::communication::broadcast_t::SENDER_AND_RECEIVER,
+                                tCommData, Plato::data::layout_t::SCALAR_FIELD);
+    std::vector<Plato::SharedData*> tSharedData = {&tTopology, &tDensity};
+
+    Plato::StageInputDataMng tStageInputData;
+    tStageInputData.add("Compute Volume", {"Topology", "Density"}, {});
+    tStageInputData.set<std::string>("BatchTransmission", "true");
+    Plato::Stage tStage(tStageInputData, nullptr, tSharedData);
+
+    // archive the shared data with the stage, so the loaded stage uses the loaded fields
+    std::stringstream tArchive;
+    {
+        boost::archive::xml_oarchive tOutputArchive(tArchive);
+        tOutputArchive << boost::serialization::make_nvp("SharedData", tSharedData);
+        tOutputArchive << boost::serialization::make_nvp("Stage", tStage);
+    }
+    std::vector<Plato::SharedData*> tLoadedSharedData;
+    Plato::Stage tLoadedStage;
+    {
+        boost::archive::xml_iarchive tInputArchive(tArchive);
+        tInputArchive >> boost::serialization::make_nvp("SharedData", tLoadedSharedData);
+        tInputArchive >> boost::serialization::make_nvp("Stage", tLoadedStage);
+    }
+    ASSERT_EQ(2u, tLoadedSharedData.size());
+    for(Plato::SharedData* tLoadedData : tLoadedSharedData)
+    {
+        tLoadedData->initializeMPI(tCommData);
+    }
+
+    // the loaded stage still transmits its inputs as a batch
+    PlatoTest::MockInterface tInterface;
+    std::vector<double> tTopologyValues(tNumLocalNodes, 0.5);
+    std::vector<double> tDensityValues(tNumLocalNodes, 0.25);
+    tInterface.exportData(tTopologyValues.data(), tLoadedSharedData[0]);
+    tInterface.exportData(tDensityValues.data(), tLoadedSharedData[1]);
+    tLoadedStage.begin();
+    tLoadedStage.waitForData({"Topology", "Density"});
+    tLoadedStage.end();
+
+    std::vector<double> tResult(tNumLocalNodes, 0.0);
+    tInterface.importData(tResult.data(), tLoadedSharedData[0]);
+    for(int tIndex = 0; tIndex < tNumLocalNodes; tIndex++)
+    {
+        EXPECT_DOUBLE_EQ(0.5, tResult[tIndex]);
+    }
+    tInterface.importData(tResult.data(), tLoadedSharedData[1]);
+    for(int tIndex = 0; tIndex < tNumLocalNodes; tIndex++)
+    {
+        EXPECT_DOUBLE_EQ(0.25, tResult[tIndex]);
+    }
+
+    for(Plato::SharedData* tLoadedData : tLoadedSharedData)
+    {
+        delete tLoadedData;
+    }
+}
+
+}
@@ -0,0 +1,234 @@
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+//
+// *************************************************************************
+//@HEADER
+*/
+
+/*
+ * Plato_Test_SolidElementKernels.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "solid_element_kernels.hpp"
+
+namespace PlatoTest
+{
+
+/******************************************************************************//**
+ * \brief Isotropic elasticity tensor in Voigt notation (xx, yy, zz, yz, xz, xy)
+**********************************************************************************/
+inline void buildIsotropicTensor(double aYoungsModulus, double aPoissonRatio, double aC[6][6])
+{
+    const double tScale = aYoungsModulus / ((1.0 + aPoissonRatio) * (1.0 - 2.0 * aPoissonRatio));
+    for(int tRow = 0; tRow < 6; tRow++)
+    {
+        for(int tColumn = 0; tColumn < 6; tColumn++)
+        {
+            aC[tRow][tColumn] = 0.0;
+        }
+    }
+    for(int tRow = 0; tRow < 3; tRow++)
+    {
+        for(int tColumn = 0; tColumn < 3; tColumn++)
+        {
+            aC[tRow][tColumn] = tScale * (tRow == tColumn ? 1.0 - aPoissonRatio : aPoissonRatio);
+        }
+        aC[tRow + 3][tRow + 3] = tScale * (1.0 - 2.0 * aPoissonRatio) / 2.0;
+    }
+}
+
+/******************************************************************************//**
+ * \brief Check symmetry and that the six rigid body modes produce no force
+**********************************************************************************/
+template<int NumNodes>
+void checkRigidBodyModes(const double aNodes[NumNodes][3], const double aK[3 * NumNodes][3 * NumNodes])
+{
+    const int tNumDofs = 3 * NumNodes;
+    const double tTolerance = 1e-10;
+    for(int tRow = 0; tRow < tNumDofs; tRow++)
+    {
+        for(int tColumn = 0; tColumn < tNumDofs; tColumn++)
+        {
+            EXPECT_NEAR(aK[tRow][tColumn], aK[tColumn][tRow], tTolerance);
+        }
+    }
+
+    for(int tMode = 0; tMode < 6; tMode++)
+    {
+        std::vector<double> tDisplacement(tNumDofs, 0.0);
+        for(int tNode = 0; tNode < NumNodes; tNode++)
+        {
+            if(tMode < 3)
+            {
+                tDisplacement[3 * tNode + tMode] = 1.0;
+            }
+            else
+            {
+                // rotation about axis (tMode - 3): u = e x X
+                const int tAxis = tMode - 3;
+                const int tFirst = (tAxis + 1) % 3;
+                const int tSecond = (tAxis + 2) % 3;
+                tDisplacement[3 * tNode + tFirst] = -aNodes[tNode][tSecond];
+                tDisplacement[3 * tNode + tSecond] = aNodes[tNode][tFirst];
+            }
+        }
+        for(int tRow = 0; tRow < tNumDofs; tRow++)
+        {
+            double tForce = 0.0;
+            for(int tColumn = 0; tColumn < tNumDofs; tColumn++)
+            {
+                tForce += aK[tRow][tColumn] * tDisplacement[tColumn];
+            }
+            EXPECT_NEAR(0.0, tForce, tTolerance);
+        }
+    }
+}
+
+TEST(PlatoTest, SolidElementKernel_Hex8)
+{
+    typedef SolidElementKernel<8> Kernel;
+
+    // 2 x 1 x 0.5 box, node ordering of the reference hex
+    const double tRefNodes[8][3] = {{-1,-1,-1},{1,-1,-1},{1,1,-1},{-1,1,-1},{-1,-1,1},{1,-1,1},{1,1,1},{-1,1,1}};
+    double tNodes[8][3];
+    for(int tNode = 0; tNode < 8; tNode++)
+    {
+        tNodes[tNode][0] = 1.0 + tRefNodes[tNode][0];
+        tNodes[tNode][1] = 0.5 * (1.0 + tRefNodes[tNode][1]);
+        tNodes[tNode][2] = 0.25 * (1.0 + tRefNodes[tNode][2]);
+    }
+
+    double tC[6][6];
+    PlatoTest::buildIsotropicTensor(1.0, 0.3, tC);
+
+    double tK[Kernel::NumDofs][Kernel::NumDofs] = {{0.0}};
+    double tVolume = 0.0;
+    const double tGauss = 1.0 / std::sqrt(3.0);
+    for(int tPoint = 0; tPoint < 8; tPoint++)
+    {
+        const double tXi[3] = {tGauss * tRefNodes[tPoint][0], tGauss * tRefNodes[tPoint][1], tGauss * tRefNodes[tPoint][2]};
+
+        // trilinear shape function gradients at the Gauss point
+        double tRefGrads[8][3];
+        for(int tNode = 0; tNode < 8; tNode++)
+        {
+            const double* tN = tRefNodes[tNode];
+            tRefGrads[tNode][0] = 0.125 * tN[0] * (1.0 + tN[1] * tXi[1]) * (1.0 + tN[2] * tXi[2]);
+            tRefGrads[tNode][1] = 0.125 * tN[1] * (1.0 + tN[0] * tXi[0]) * (1.0 + tN[2] * tXi[2]);
+            tRefGrads[tNode][2] = 0.125 * tN[2] * (1.0 + tN[0] * tXi[0]) * (1.0 + tN[1] * tXi[1]);
+        }
+
+        double tGrads[8][3];
+        double tB[Kernel::VoigtSize][Kernel::NumDofs];
+        const double tDetJ = Kernel::computeGradients(tNodes, tRefGrads, tGrads);
+        Kernel::computeB(tGrads, tB);
+        Kernel::addBtCB(tC, tB, tDetJ, tK);
+        tVolume += tDetJ;
+
+        // physical gradients of a partition of unity sum to zero, and reproduce x
+        for(int tDim = 0; tDim < 3; tDim++)
+        {
+            double tSum = 0.0;
+            double tLinear = 0.0;
+            for(int tNode = 0; tNode < 8; tNode++)
+            {
+                tSum += tGrads[tNode][tDim];
+                tLinear += tGrads[tNode][tDim] * tNodes[tNode][tDim];
+            }
+            EXPECT_NEAR(0.0, tSum, 1e-12);
+            EXPECT_NEAR(1.0, tLinear, 1e-12);
+        }
+    }
+    EXPECT_NEAR(2.0 * 1.0 * 0.5, tVolume, 1e-12);
+
+    PlatoTest::checkRigidBodyModes<8>(tNodes, tK);
+
+    // uniaxial stretch in x: u_x = x gives the reaction E_eff * area on the x = 2 face
+    double tReaction = 0.0;
+    for(int tRow = 0; tRow < 8; tRow++)
+    {
+        if(tNodes[tRow][0] > 1.5)
+        {
+            for(int tColumn = 0; tColumn < 8; tColumn++)
+            {
+                tReaction += tK[3 * tRow][3 * tColumn] * tNodes[tColumn][0];
+            }
+        }
+    }
+    EXPECT_NEAR(tC[0][0] * 1.0 * 0.5, tReaction, 1e-10);
+}
+
+TEST(PlatoTest, SolidElementKernel_Tet4)
+{
+    typedef SolidElementKernel<4> Kernel;
+
+    const double tNodes[4][3] = {{0,0,0},{2,0,0},{0,3,0},{0,0,4}};
+    const double tRefGrads[4][3] = {{-1,-1,-1},{1,0,0},{0,1,0},{0,0,1}};
+
+    double tC[6][6];
+    PlatoTest::buildIsotropicTensor(10.0, 0.25, tC);
+
+    double tGrads[4][3];
+    double tB[Kernel::VoigtSize][Kernel::NumDofs];
+    const double tDetJ = Kernel::computeGradients(tNodes, tRefGrads, tGrads);
+    EXPECT_NEAR(24.0, tDetJ, 1e-12);
+
+    const double tGold[4][3] = {{-0.5, -1.0/3.0, -0.25},{0.5, 0, 0},{0, 1.0/3.0, 0},{0, 0, 0.25}};
+    for(int tNode = 0; tNode < 4; tNode++)
+    {
+        for(int tDim = 0; tDim < 3; tDim++)
+        {
+            EXPECT_NEAR(tGold[tNode][tDim], tGrads[tNode][tDim], 1e-12);
+        }
+    }
+
+    double tK[Kernel::NumDofs][Kernel::NumDofs] = {{0.0}};
+    Kernel::computeB(tGrads, tB);
+    Kernel::addBtCB(tC, tB, tDetJ / 6.0, tK);
+
+    PlatoTest::checkRigidBodyModes<4>(tNodes, tK);
+}
+
+}
@@ -288,6 +288,32 @@ TEST(PlatoTimersTree, expectedGracefulFailureBeginPartitionOutOfBounds)
     EXPECT_EQ(this_tree.unit_testing_get_timers().size(), num_timers * (rank==0));
 }
 
+TEST(PlatoTimersTree, addCount)
+{
+    // allocate problem
+    const size_t num_keys = 2u;
+    const size_t num_timers = num_keys + 1u;
+    // define MPI
+    MPI_Comm comm = MPI_COMM_WORLD;
+    // define Tree
+    TimersTree this_tree(comm, num_keys);
+
+    std::vector<size_t> expected_counts(num_timers, 0u);
+    checkVectorIfRankZero(comm, this_tree.unit_testing_get_counts(), expected_counts);
+
+    // counts accumulate per partition
+    this_tree.add_count(1, 12u);
+    this_tree.add_count(1, 7u);
+    this_tree.add_count(0, 3u);
+    expected_counts[1] = 19u;
+    expected_counts[0] = 3u;
+    checkVectorIfRankZero(comm, this_tree.unit_testing_get_counts(), expected_counts);
+
+    // out of bound partition
+    EXPECT_EQ(this_tree.add_count(num_timers, 1u), false);
+    checkVectorIfRankZero(comm, this_tree.unit_testing_get_counts(), expected_counts);
+}
+
 template<typename t>
 void checkVectorIfRankZero(MPI_Comm& comm, const std::vector<t>& A, const std::vector<t>& B)
 {
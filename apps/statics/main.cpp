@@ -46,6 +46,7 @@
 #include <Plato_Interface.hpp>
 #include <Plato_PenaltyModel.hpp>
 #include <Plato_SharedData.hpp>
+#include <Plato_TimersTree.hpp>
 #include <Plato_Console.hpp>
 
 #ifndef NDEBUG
@@ -61,7 +62,7 @@ public:
     virtual ~LocalApp();
 
     void initialize();
-    void finalize() {};
+    void finalize();
     void compute(const std::string & aOperationName);
     void importData(const std::string & aArgumentName, const Plato::SharedData & aImportData);
     void exportData(const std::string & aArgumentName, Plato::SharedData & aExportData);
@@ -83,6 +84,7 @@ private:
     Plato::InputData m_inputData;
 
     Plato::PenaltyModel* m_penaltyModel;
+    Plato::TimersTree* m_timersTree;
 
     std::map<std::string, DistributedVector*> m_fieldMap;
     std::map<std::string, std::vector<double>*> m_valueMap;
@@ -284,6 +286,8 @@ void LocalApp::initialize()
 
     // build system
     m_statics = new SolidStatics(*m_sysGraph_3D, *m_lightmp);
+    m_timersTree = new Plato::TimersTree(WorldComm.getComm());
+    m_statics->setTimersTree(m_timersTree);
 
     m_lightmp->finalizeSetup();
 
@@ -316,6 +320,16 @@ void LocalApp::initialize()
     m_valueMap[name] = newValue;
 }
 
+/******************************************************************************/
+void LocalApp::finalize()
+/******************************************************************************/
+{
+    if(m_timersTree)
+    {
+        m_timersTree->print_results();
+    }
+}
+
 /******************************************************************************/
 void LocalApp::throwParsingException(std::string aArgumentName, const std::map<std::string, std::vector<double>*>& aValueMap)
 /******************************************************************************/
@@ -421,6 +435,8 @@ LocalApp::~LocalApp()
         delete m_statics;
     if(m_penaltyModel)
         delete m_penaltyModel;
+    if(m_timersTree)
+        delete m_timersTree;
 }
 
 /******************************************************************************/
@@ -434,6 +450,7 @@ LocalApp::LocalApp(int aArgc, char **aArgv) :
         m_stiffnessMatrix(NULL),
         m_inputData("Input Data"),
         m_penaltyModel(NULL),
+        m_timersTree(NULL),
         m_fieldMap(),
         m_valueMap(),
         m_firstTime(true),
@@ -43,7 +43,11 @@
 // PlatoSubproblemLibraryVersion(3): a stand-alone library for the kernel filter for plato.
 #include "PSL_Abstract_FixedRadiusNearestNeighborsSearcher.hpp"
 
+#include "PSL_PointCloud.hpp"
+#include "PSL_Point.hpp"
+
 #include <cstddef>
+#include <vector>
 
 namespace PlatoSubproblemLibrary
 {
@@ -51,7 +55,8 @@ namespace PlatoSubproblemLibrary
 namespace AbstractInterface
 {
 
-FixedRadiusNearestNeighborsSearcher::FixedRadiusNearestNeighborsSearcher()
+FixedRadiusNearestNeighborsSearcher::FixedRadiusNearestNeighborsSearcher() :
+        m_num_threads(1u)
 {
 
 }
@@ -61,6 +66,39 @@ FixedRadiusNearestNeighborsSearcher::~FixedRadiusNearestNeighborsSearcher()
 
 }
 
+void FixedRadiusNearestNeighborsSearcher::get_neighbors_of_points(PlatoSubproblemLibrary::PointCloud* query_points,
+                                                                  size_t query_begin,
+                                                                  size_t query_end,
+                                                                  size_t max_num_neighbors,
+                                                                  std::vector<size_t>& offsets,
+                                                                  std::vector<size_t>& neighbors)
+{
+    const size_t num_queries = query_end - query_begin;
+    std::vector<size_t> neighbors_buffer(max_num_neighbors);
+    size_t num_neighbors = 0u;
+
+    offsets.assign(num_queries + 1u, 0u);
+    neighbors.clear();
+    for(size_t query_index = 0u; query_index < num_queries; query_index++)
+    {
+        num_neighbors = 0u;
+        Point query_point = query_points->get_point(query_begin + query_index);
+        get_neighbors(&query_point, neighbors_buffer, num_neighbors);
+        neighbors.insert(neighbors.end(), neighbors_buffer.begin(), neighbors_buffer.begin() + num_neighbors);
+        offsets[query_index + 1u] = neighbors.size();
+    }
+}
+
+void FixedRadiusNearestNeighborsSearcher::set_num_threads(size_t num_threads)
+{
+    m_num_threads = (num_threads == 0u ? 1u : num_threads);
+}
+
+size_t FixedRadiusNearestNeighborsSearcher::get_num_threads() const
+{
+    return m_num_threads;
+}
+
 }
 
 }
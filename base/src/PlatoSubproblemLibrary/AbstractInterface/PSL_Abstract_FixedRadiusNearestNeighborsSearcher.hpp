@@ -64,8 +64,21 @@ public:
     virtual void build(PlatoSubproblemLibrary::PointCloud* answer_points, double radius) = 0;
     // find neighbors within radius
     virtual void get_neighbors(PlatoSubproblemLibrary::Point* query_point, std::vector<size_t>& neighbors_buffer, size_t& num_neighbors) = 0;
+    // find neighbors of query points [query_begin, query_end);
+    // neighbors of query query_begin+i are neighbors[offsets[i]] to neighbors[offsets[i+1]-1]
+    virtual void get_neighbors_of_points(PlatoSubproblemLibrary::PointCloud* query_points,
+                                         size_t query_begin,
+                                         size_t query_end,
+                                         size_t max_num_neighbors,
+                                         std::vector<size_t>& offsets,
+                                         std::vector<size_t>& neighbors);
+
+    // threads used by batch queries; searchers without threaded queries ignore it
+    void set_num_threads(size_t num_threads);
+    size_t get_num_threads() const;
 
 protected:
+    size_t m_num_threads;
 
 };
 
@@ -228,10 +228,10 @@ void MpiWrapper::send_point_cloud(size_t target_rank, PlatoSubproblemLibrary::Po
 
     // send points
     for(size_t point_index = 0u; point_index < num_points; point_index++) {
-        Point* point = points->get_point(point_index);
+        Point point = points->get_point(point_index);
         std::vector<double> point_data;
-        point->get_data(point_data);
-        this->send(target_rank, (int)point->get_index());
+        point.get_data(point_data);
+        this->send(target_rank, (int)point.get_index());
         this->send(target_rank, (int)point_data.size());
         this->send(target_rank, point_data);
     }
@@ -82,6 +82,11 @@ public:
     void receive(size_t source_rank, float& recv_data);
     void receive(size_t source_rank, double& recv_data);
 
+    // non-blocking point-to-point; buffers must stay alive and untouched until wait_all returns
+    virtual void isend(size_t target_rank, std::vector<double>& send_vector) = 0;
+    virtual void ireceive(size_t source_rank, std::vector<double>& recv_vector) = 0;
+    virtual void wait_all() = 0;
+
     virtual void all_gather(std::vector<int>& local_portion, std::vector<int>& global_portion) = 0;
     virtual void all_gather(std::vector<float>& local_portion, std::vector<float>& global_portion) = 0;
     virtual void all_gather(std::vector<double>& local_portion, std::vector<double>& global_portion) = 0;
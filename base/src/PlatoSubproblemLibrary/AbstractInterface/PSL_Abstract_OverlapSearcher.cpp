@@ -74,10 +74,14 @@ void OverlapSearcher::build(PlatoSubproblemLibrary::PointCloud* answer_points, d
 
     // build boxes
     const size_t num_points = answer_points->get_num_points();
+    const double* coordinates = answer_points->get_coordinates();
     std::vector<AxisAlignedBoundingBox> answer_boxes(num_points);
     for(size_t index = 0u; index < num_points; index++)
     {
-        answer_boxes[index].set(answer_points->get_point(index));
+        answer_boxes[index] = AxisAlignedBoundingBox(coordinates[3u * index + 0u],
+                                                     coordinates[3u * index + 1u],
+                                                     coordinates[3u * index + 2u],
+                                                     answer_points->get_index(index));
     }
 
     // build searcher from boxes
@@ -202,8 +202,7 @@ void ByNarrowShare_PointGhostingAgent::share_points_with_processor_send(size_t o
     for(size_t results_index = 0u; results_index < num_results; results_index++)
     {
         const size_t point_index = local_point_results[results_index];
-        Point* local_point = local_kernel_points->get_point(point_index);
-        neighbored_local_kernel_points.push_back(*local_point);
+        neighbored_local_kernel_points.push_back(local_kernel_points->get_point(point_index));
     }
 
     // send
@@ -71,7 +71,8 @@ ByRow_MatrixAssemblyAgent::ByRow_MatrixAssemblyAgent(AbstractAuthority* authorit
                                                      ParameterData* input_data) :
         Abstract_MatrixAssemblyAgent(matrix_assembly_agent_t::by_row, authority),
         m_input_data(input_data),
-        m_support_distance(-1.)
+        m_support_distance(-1.),
+        m_rows_per_batch(4096u)
 {
 }
 
@@ -96,6 +97,10 @@ void ByRow_MatrixAssemblyAgent::build(Abstract_BoundedSupportFunction* bounded_s
     m_support_distance = bounded_support_function->get_support();
     m_searcher = build_fixed_radius_nearest_neighbors_searcher(m_input_data->get_spatial_searcher(), m_authority);
     assert(m_searcher);
+    if(m_input_data->didUserInput_num_threads())
+    {
+        m_searcher->set_num_threads(m_input_data->get_num_threads());
+    }
 
     // allocate
     const size_t mpi_size = m_authority->mpi_wrapper->get_size();
@@ -133,35 +138,41 @@ void ByRow_MatrixAssemblyAgent::build_local(Abstract_BoundedSupportFunction* bou
     // prepare for building local kernel matrix
     const size_t num_repeats = m_authority->sparse_builder->get_number_of_passes_over_all_nonzero_entries();
     const size_t num_points = kernel_points->get_num_points();
-    std::vector<size_t> neighbors_buffer(num_points);
-    size_t num_neighbors = 0u;
+    const double* coordinates = kernel_points->get_coordinates();
+
+    // neighbor lists are held for one batch of rows at a time; a single batch is searched once for all passes
+    const size_t num_batches = (num_points + m_rows_per_batch - 1u) / m_rows_per_batch;
+    std::vector<size_t> neighbors_offsets;
+    std::vector<size_t> neighbors;
 
     // build local sparse matrix
     m_authority->sparse_builder->begin_build(num_points, num_points);
     for(size_t repeat = 0u; repeat < num_repeats; repeat++)
     {
-        for(size_t point1_index = 0; point1_index < num_points; point1_index++)
+        for(size_t batch = 0u; batch < num_batches; batch++)
         {
-            Point* point1 = kernel_points->get_point(point1_index);
-
-            // determine which points are within the radius of point1
-            num_neighbors = 0;
-            m_searcher->get_neighbors(point1, neighbors_buffer, num_neighbors);
-
-            // this sort is not necessary but promotes more sequential access
-            std::sort(&neighbors_buffer[0], &neighbors_buffer[num_neighbors]);
-
-            // for each neighbor found, calculate the distance weight
-            for(size_t neighbor_index = 0; neighbor_index < num_neighbors; neighbor_index++)
+            const size_t batch_begin = batch * m_rows_per_batch;
+            const size_t batch_end = std::min(num_points, batch_begin + m_rows_per_batch);
+            if(num_batches > 1u || repeat == 0u)
             {
-                const size_t point2_index = neighbors_buffer[neighbor_index];
-                Point* point2 = kernel_points->get_point(point2_index);
+                get_sorted_neighbors(kernel_points, batch_begin, batch_end, num_points, neighbors_offsets, neighbors);
+            }
 
-                // if weight positive, store
-                const double weight = bounded_support_function->evaluate(point1, point2);
-                if(weight > 0)
+            for(size_t point1_index = batch_begin; point1_index < batch_end; point1_index++)
+            {
+                // for each neighbor found, calculate the distance weight
+                const size_t batch_index = point1_index - batch_begin;
+                for(size_t neighbor_index = neighbors_offsets[batch_index]; neighbor_index < neighbors_offsets[batch_index + 1u]; neighbor_index++)
                 {
-                    m_authority->sparse_builder->specify_nonzero(point1_index, point2_index, weight);
+                    const size_t point2_index = neighbors[neighbor_index];
+
+                    // if weight positive, store
+                    const double weight = bounded_support_function->evaluate(&coordinates[3u * point1_index],
+                                                                             &coordinates[3u * point2_index]);
+                    if(weight > 0)
+                    {
+                        m_authority->sparse_builder->specify_nonzero(point1_index, point2_index, weight);
+                    }
                 }
             }
         }
@@ -193,38 +204,51 @@ void ByRow_MatrixAssemblyAgent::compute_nonlocal_matrix_for_above_processor(Abst
 
         // prepare for building sparse matrix
         const size_t num_repeats = m_authority->sparse_builder->get_number_of_passes_over_all_nonzero_entries();
-        std::vector<size_t> neighbors_buffer(num_local_points);
-        size_t num_neighbors = 0u;
+        const double* local_coordinates = local_kernel_points->get_coordinates();
+        const double* nonlocal_coordinates = nonlocal_kernel_points[upper_proc_id]->get_coordinates();
+
+        // neighbor lists are held for one batch of nonlocal points at a time
+        const size_t num_batches = (num_nonLocal_within_radius + m_rows_per_batch - 1u) / m_rows_per_batch;
+        std::vector<size_t> neighbors_offsets;
+        std::vector<size_t> neighbors;
 
         // build sparse matrix
         m_authority->sparse_builder->begin_build(num_rows, num_columns);
         for(size_t repeat = 0u; repeat < num_repeats; repeat++)
         {
-            for(size_t nonlocal_index = 0; nonlocal_index < num_nonLocal_within_radius; nonlocal_index++)
+            for(size_t batch = 0u; batch < num_batches; batch++)
             {
-                Point* nonlocal_point = nonlocal_kernel_points[upper_proc_id]->get_point(nonlocal_index);
-
-                // determine which points are within the radius of point1
-                num_neighbors = 0;
-                m_searcher->get_neighbors(nonlocal_point, neighbors_buffer, num_neighbors);
-
-                // this sort is not necessary but promotes more sequential access
-                std::sort(&neighbors_buffer[0], &neighbors_buffer[num_neighbors]);
+                const size_t batch_begin = batch * m_rows_per_batch;
+                const size_t batch_end = std::min(num_nonLocal_within_radius, batch_begin + m_rows_per_batch);
+                if(num_batches > 1u || repeat == 0u)
+                {
+                    get_sorted_neighbors(nonlocal_kernel_points[upper_proc_id],
+                                         batch_begin,
+                                         batch_end,
+                                         num_local_points,
+                                         neighbors_offsets,
+                                         neighbors);
+                }
 
-                // for each neighbor found, calculate the distance weight
-                for(size_t neighbor_index = 0; neighbor_index < num_neighbors; neighbor_index++)
+                for(size_t nonlocal_index = batch_begin; nonlocal_index < batch_end; nonlocal_index++)
                 {
-                    const size_t local_neighbor = neighbors_buffer[neighbor_index];
-                    Point* local_point = local_kernel_points->get_point(local_neighbor);
+                    const size_t column = nonlocal_kernel_points[upper_proc_id]->get_index(nonlocal_index);
 
-                    // if weight positive, store
-                    const double weight = bounded_support_function->evaluate(local_point, nonlocal_point);
-                    if(weight > 0)
+                    // for each neighbor found, calculate the distance weight
+                    const size_t batch_index = nonlocal_index - batch_begin;
+                    for(size_t neighbor_index = neighbors_offsets[batch_index]; neighbor_index < neighbors_offsets[batch_index + 1u]; neighbor_index++)
                     {
-                        const size_t row = local_point->get_index();
-                        const size_t column = nonlocal_point->get_index();
+                        const size_t local_neighbor = neighbors[neighbor_index];
+
+                        // if weight positive, store
+                        const double weight = bounded_support_function->evaluate(&local_coordinates[3u * local_neighbor],
+                                                                                 &nonlocal_coordinates[3u * nonlocal_index]);
+                        if(weight > 0)
+                        {
+                            const size_t row = local_kernel_points->get_index(local_neighbor);
 
-                        m_authority->sparse_builder->specify_nonzero(row, column, weight);
+                            m_authority->sparse_builder->specify_nonzero(row, column, weight);
+                        }
                     }
                 }
             }
@@ -243,6 +267,22 @@ void ByRow_MatrixAssemblyAgent::compute_nonlocal_matrix_for_above_processor(Abst
     }
 }
 
+void ByRow_MatrixAssemblyAgent::get_sorted_neighbors(PointCloud* query_points,
+                                                     size_t query_begin,
+                                                     size_t query_end,
+                                                     size_t max_num_neighbors,
+                                                     std::vector<size_t>& neighbors_offsets,
+                                                     std::vector<size_t>& neighbors)
+{
+    m_searcher->get_neighbors_of_points(query_points, query_begin, query_end, max_num_neighbors, neighbors_offsets, neighbors);
+    const size_t num_queries = query_end - query_begin;
+    for(size_t query_index = 0u; query_index < num_queries; query_index++)
+    {
+        // this sort is not necessary but promotes more sequential access
+        std::sort(neighbors.begin() + neighbors_offsets[query_index], neighbors.begin() + neighbors_offsets[query_index + 1u]);
+    }
+}
+
 void ByRow_MatrixAssemblyAgent::send_block_row_to_above_processor(const std::vector<size_t>& processor_neighbors_above,
                                                                   std::vector<AbstractInterface::SparseMatrix*>& parallel_block_row_kernel_matrices)
 {
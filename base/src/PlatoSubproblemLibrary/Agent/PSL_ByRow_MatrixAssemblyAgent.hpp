@@ -92,6 +92,13 @@ protected:
                                                      PointCloud* local_kernel_points,
                                                      std::vector<AbstractInterface::SparseMatrix*>& parallel_block_row_kernel_matrices,
                                                      const std::vector<int>& num_points_per_processor);
+    // neighbors of query points [query_begin, query_end), each sorted
+    void get_sorted_neighbors(PointCloud* query_points,
+                              size_t query_begin,
+                              size_t query_end,
+                              size_t max_num_neighbors,
+                              std::vector<size_t>& neighbors_offsets,
+                              std::vector<size_t>& neighbors);
     void send_block_row_to_above_processor(const std::vector<size_t>& processor_neighbors_above,
                                            std::vector<AbstractInterface::SparseMatrix*>& parallel_block_row_kernel_matrices);
     void recv_block_row_from_below_processor(const std::vector<size_t>& processor_neighbors_below,
@@ -100,6 +107,8 @@ protected:
     ParameterData* m_input_data;
     AbstractInterface::FixedRadiusNearestNeighborsSearcher* m_searcher;
     double m_support_distance;
+    // rows whose neighbor lists are held at once
+    size_t m_rows_per_batch;
 
 };
 
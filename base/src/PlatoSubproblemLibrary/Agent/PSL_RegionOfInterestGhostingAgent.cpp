@@ -215,8 +215,7 @@ PointCloud* RegionOfInterestGhostingAgent::share(double spatial_tolerance,
                 {
                     if(to_send[local_index] && is_local_point_of_interest[local_index])
                     {
-                        Point* local_point = globally_indexed_local_nodes->get_point(local_index);
-                        points_to_send.push_back(*local_point);
+                        points_to_send.push_back(globally_indexed_local_nodes->get_point(local_index));
                     }
                 }
 
@@ -252,8 +251,7 @@ PointCloud* RegionOfInterestGhostingAgent::share(double spatial_tolerance,
     {
         if(transfer_local[local_index] && is_local_point_of_interest[local_index])
         {
-            Point* local_point = globally_indexed_local_nodes->get_point(local_index);
-            global_points_of_interest->push_back(*local_point);
+            global_points_of_interest->push_back(globally_indexed_local_nodes->get_point(local_index));
         }
     }
 
@@ -43,6 +43,10 @@
 // PlatoSubproblemLibraryVersion(7): a stand-alone library for the kernel filter for plato.
 #include "PSL_Abstract_BoundedSupportFunction.hpp"
 
+#include "PSL_Point.hpp"
+
+#include <vector>
+
 namespace PlatoSubproblemLibrary
 {
 
@@ -54,4 +58,11 @@ Abstract_BoundedSupportFunction::~Abstract_BoundedSupportFunction()
 {
 }
 
+double Abstract_BoundedSupportFunction::evaluate(const double* center, const double* other)
+{
+    Point center_point(0u, std::vector<double>(center, center + 3u));
+    Point other_point(0u, std::vector<double>(other, other + 3u));
+    return evaluate(&center_point, &other_point);
+}
+
 }
@@ -61,6 +61,8 @@ public:
 
     virtual void build(double support, ParameterData* input_data) = 0;
     virtual double evaluate(Point* center, Point* other) = 0;
+    // evaluate on contiguous 3D coordinates; by default forwards to the Point overload
+    virtual double evaluate(const double* center, const double* other);
     virtual double get_support() = 0;
 
 protected:
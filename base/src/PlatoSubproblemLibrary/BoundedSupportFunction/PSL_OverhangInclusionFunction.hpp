@@ -62,6 +62,7 @@ public:
     virtual ~OverhangInclusionFunction();
 
     virtual void build(double support, ParameterData* input_data);
+    using Abstract_BoundedSupportFunction::evaluate;
     virtual double evaluate(Point* center, Point* other);
     virtual double get_support();
 
@@ -84,6 +84,20 @@ double PolynomialTentFunction::evaluate(Point* center, Point* other)
     return -1.;
 }
 
+double PolynomialTentFunction::evaluate(const double* center, const double* other)
+{
+    const double dx = center[0] - other[0];
+    const double dy = center[1] - other[1];
+    const double dz = center[2] - other[2];
+    const double result_squared = dx * dx + dy * dy + dz * dz;
+
+    if(result_squared < m_radius_squared)
+    {
+        return pow(m_radius - sqrt(result_squared), m_weighting_penalty);
+    }
+    return -1.;
+}
+
 double PolynomialTentFunction::get_support()
 {
     return m_radius;
@@ -63,6 +63,7 @@ public:
 
     virtual void build(double support, ParameterData* input_data);
     virtual double evaluate(Point* center, Point* other);
+    virtual double evaluate(const double* center, const double* other);
     virtual double get_support();
 
 protected:
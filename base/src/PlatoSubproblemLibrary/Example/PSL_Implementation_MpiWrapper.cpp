@@ -60,6 +60,27 @@ void receive(MPI_Comm& comm, size_t source_rank, std::vector<double>& receive_ve
     MPI_Recv(receive_vector.data(), size, MPI_DOUBLE, source_rank, 0, comm, &status);
 }
 
+// int MPI_Isend (const void* message, int count, MPI_Datatype datatype, int dest, int tag, MPI_Comm comm, MPI_Request* request);
+void isend(MPI_Comm& comm, size_t target_rank, std::vector<double>& send_vector, MPI_Request& request)
+{
+    const size_t size = send_vector.size();
+    MPI_Isend(send_vector.data(), size, MPI_DOUBLE, target_rank, 0, comm, &request);
+}
+
+// int MPI_Irecv (void* message, int count, MPI_Datatype datatype, int source, int tag, MPI_Comm comm, MPI_Request* request);
+void ireceive(MPI_Comm& comm, size_t source_rank, std::vector<double>& receive_vector, MPI_Request& request)
+{
+    const size_t size = receive_vector.size();
+    MPI_Irecv(receive_vector.data(), size, MPI_DOUBLE, source_rank, 0, comm, &request);
+}
+
+// int MPI_Waitall (int count, MPI_Request requests[], MPI_Status statuses[]);
+void wait_all(std::vector<MPI_Request>& requests)
+{
+    const size_t size = requests.size();
+    MPI_Waitall(size, requests.data(), MPI_STATUSES_IGNORE);
+}
+
 //int MPI_Allgather ( void *sendbuf, int sendcount, MPI_Datatype sendtype,
 //                    void *recvbuf, int recvcount, MPI_Datatype recvtype,
 //                    MPI_Comm comm );
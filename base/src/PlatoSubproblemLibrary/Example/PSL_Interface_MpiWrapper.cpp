@@ -97,6 +97,34 @@ void Interface_MpiWrapper::receive(size_t source_rank, std::vector<double>& send
     example::receive(*m_comm, source_rank, send_vector);
 }
 
+void Interface_MpiWrapper::isend(size_t target_rank, std::vector<double>& send_vector)
+{
+#ifdef PSL_INTERFACE_MPIWRAPPER_VERBOSE
+    std::stringstream stream;
+    stream << "isend::from,to,size,type:" << get_rank() << "," << target_rank << "," << send_vector.size() << ",double\n";
+    m_utilities->print(stream.str());
+#endif
+    m_requests.push_back(MPI_REQUEST_NULL);
+    example::isend(*m_comm, target_rank, send_vector, m_requests.back());
+}
+
+void Interface_MpiWrapper::ireceive(size_t source_rank, std::vector<double>& recv_vector)
+{
+#ifdef PSL_INTERFACE_MPIWRAPPER_VERBOSE
+    std::stringstream stream;
+    stream << "irecv::from,to,size,type:" << source_rank << "," << get_rank() << "," << recv_vector.size() << ",double\n";
+    m_utilities->print(stream.str());
+#endif
+    m_requests.push_back(MPI_REQUEST_NULL);
+    example::ireceive(*m_comm, source_rank, recv_vector, m_requests.back());
+}
+
+void Interface_MpiWrapper::wait_all()
+{
+    example::wait_all(m_requests);
+    m_requests.clear();
+}
+
 void Interface_MpiWrapper::all_gather(std::vector<int>& local_portion, std::vector<int>& global_portion)
 {
     example::all_gather(*m_comm, local_portion, global_portion);
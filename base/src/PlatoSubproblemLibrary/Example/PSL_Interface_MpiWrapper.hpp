@@ -35,6 +35,10 @@ public:
     virtual void receive(size_t source_rank, std::vector<float>& send_vector);
     virtual void receive(size_t source_rank, std::vector<double>& send_vector);
 
+    virtual void isend(size_t target_rank, std::vector<double>& send_vector);
+    virtual void ireceive(size_t source_rank, std::vector<double>& recv_vector);
+    virtual void wait_all();
+
     virtual void all_gather(std::vector<int>& local_portion, std::vector<int>& global_portion);
     virtual void all_gather(std::vector<float>& local_portion, std::vector<float>& global_portion);
     virtual void all_gather(std::vector<double>& local_portion, std::vector<double>& global_portion);
@@ -57,6 +61,7 @@ public:
 
 protected:
     MPI_Comm* m_comm;
+    std::vector<MPI_Request> m_requests;
 
 };
 
@@ -1,9 +1,155 @@
 #include <PSL_AMFilterUtilities.hpp>
 #include "PSL_Abstract_ParallelVector.hpp"
 
+#include <algorithm>
+#include <functional>
+#include <thread>
+
 namespace PlatoSubproblemLibrary
 {
 
+namespace
+{
+// below this many items per thread, spawning threads costs more than the sweep
+const size_t gMinItemsPerThread = 2048u;
+
+// split [0, aNumItems) into contiguous ranges and run each range on its own thread
+void forEachRange(const size_t& aNumItems, const size_t& aNumThreads, const std::function<void(size_t, size_t)>& aFunction)
+{
+    const size_t tNumThreads = std::max(size_t(1u), std::min(aNumThreads, aNumItems / gMinItemsPerThread));
+    if(tNumThreads == 1u)
+    {
+        aFunction(0u, aNumItems);
+        return;
+    }
+
+    const size_t tItemsPerThread = (aNumItems + tNumThreads - 1u) / tNumThreads;
+    std::vector<std::thread> tThreads;
+    for(size_t tThreadIndex = 0; tThreadIndex < tNumThreads; ++tThreadIndex)
+    {
+        const size_t tBegin = std::min(aNumItems, tThreadIndex * tItemsPerThread);
+        const size_t tEnd = std::min(aNumItems, tBegin + tItemsPerThread);
+        tThreads.push_back(std::thread(aFunction, tBegin, tEnd));
+    }
+    for(auto& tThread : tThreads)
+        tThread.join();
+}
+}
+
+void AMFilterUtilities::buildSupportStencils()
+{
+    // the stencil of (i,j,k) only depends on (i,j); keep the ordering of getSupportIndices so sums match smax exactly
+    auto tGridDimensions = mGridUtilities.getGridDimensions();
+    size_t tLayerSize = tGridDimensions[0]*tGridDimensions[1];
+
+    mSupportOffsets.assign(tLayerSize + 1u, 0u);
+    mSupportLayerIndices.clear();
+    mSupportInverseQNorm.assign(tLayerSize, 0.0);
+
+    if(tGridDimensions[2] < 2u)
+        return;
+
+    for(size_t j = 0; j < tGridDimensions[1]; ++j)
+    {
+        for(size_t i = 0; i < tGridDimensions[0]; ++i)
+        {
+            size_t tLayerIndex = mGridUtilities.getSerializedIndex(i,j,0);
+            for(auto tSupportIndex : mGridUtilities.getSupportIndices(i,j,1))
+            {
+                mSupportLayerIndices.push_back(mGridUtilities.getSerializedIndex(tSupportIndex));
+            }
+            mSupportOffsets[tLayerIndex + 1u] = mSupportLayerIndices.size();
+
+            size_t tNumSupports = mSupportOffsets[tLayerIndex + 1u] - mSupportOffsets[tLayerIndex];
+            double tQNorm = mPNorm + std::log(tNumSupports)/std::log(0.5);
+            mSupportInverseQNorm[tLayerIndex] = 1.0/tQNorm;
+        }
+    }
+}
+
+void AMFilterUtilities::buildTetNodeInterpolation()
+{
+    // locating the containing grid element only depends on the mesh and grid, so do it once
+    const std::vector<std::vector<double>>& tCoordinates = mTetUtilities.getCoordinates();
+    size_t tNumNodes = tCoordinates.size();
+
+    mTetNodeGridIndices.assign(8u*tNumNodes, 0u);
+    mTetNodeElementMinUVWCoords.assign(tNumNodes, Vector());
+    mTetNodeElementMaxUVWCoords.assign(tNumNodes, Vector());
+    mTetNodeUVWCoords.assign(tNumNodes, Vector());
+    mTetNodeIsLocated.assign(tNumNodes, false);
+
+    for(size_t tNodeIndex = 0; tNodeIndex < tNumNodes; ++tNodeIndex)
+    {
+        try
+        {
+            Vector tPoint(tCoordinates[tNodeIndex]);
+            std::vector<std::vector<size_t>> tContainingElementIndicies = mGridUtilities.getContainingGridElement(tPoint);
+
+            std::vector<Vector> tElementCoordinates;
+            for(size_t tHexNode = 0; tHexNode < 8u; ++tHexNode)
+            {
+                mTetNodeGridIndices[8u*tNodeIndex + tHexNode] = mGridUtilities.getSerializedIndex(tContainingElementIndicies[tHexNode]);
+                tElementCoordinates.push_back(mGridUtilities.computeGridPointUVWCoordinates(tContainingElementIndicies[tHexNode]));
+            }
+            computeBoundingBox(tElementCoordinates,mTetNodeElementMinUVWCoords[tNodeIndex],mTetNodeElementMaxUVWCoords[tNodeIndex]);
+            mTetNodeUVWCoords[tNodeIndex] = mGridUtilities.computePointUVWCoordinates(tPoint);
+            mTetNodeIsLocated[tNodeIndex] = true;
+        }
+        catch(const std::exception&)
+        {
+            // nodes outside the grid keep the original code path, which reports the error when the filter is applied
+            mTetNodeIsLocated[tNodeIndex] = false;
+        }
+    }
+}
+
+bool AMFilterUtilities::computeLayerPoweredDensity(const int& k,
+                                                   const std::vector<double>& aGridPrintableDensity,
+                                                   std::vector<double>& aLayerPoweredDensity) const
+{
+    auto tGridDimensions = mGridUtilities.getGridDimensions();
+    size_t tLayerSize = tGridDimensions[0]*tGridDimensions[1];
+    const double* tLayerDensity = aGridPrintableDensity.data() + k*tLayerSize;
+
+    aLayerPoweredDensity.resize(tLayerSize);
+    std::vector<char> tHasNegative(tLayerSize, 0);
+    forEachRange(tLayerSize, mNumThreads, [&](size_t aBegin, size_t aEnd)
+    {
+        for(size_t tIndex = aBegin; tIndex < aEnd; ++tIndex)
+        {
+            tHasNegative[tIndex] = tLayerDensity[tIndex] < 0;
+            aLayerPoweredDensity[tIndex] = std::pow(std::abs(tLayerDensity[tIndex]),mPNorm);
+        }
+    });
+
+    return std::find(tHasNegative.begin(), tHasNegative.end(), 1) == tHasNegative.end();
+}
+
+double AMFilterUtilities::computeSupportDensity(const size_t& aLayerIndex, const std::vector<double>& aLayerPoweredDensityBelow) const
+{
+    double tSum = 0;
+    for(size_t tStencilIndex = mSupportOffsets[aLayerIndex]; tStencilIndex < mSupportOffsets[aLayerIndex + 1u]; ++tStencilIndex)
+    {
+        tSum += aLayerPoweredDensityBelow[mSupportLayerIndices[tStencilIndex]];
+    }
+    return std::pow(tSum,mSupportInverseQNorm[aLayerIndex]);
+}
+
+double AMFilterUtilities::computeLocatedTetNodePrintableDensity(const int& aTetNodeIndex,
+                                                                const std::vector<double>& aGridPrintableDensity) const
+{
+    std::vector<double> tContainingElementDensities(8u);
+    for(size_t tHexNode = 0; tHexNode < 8u; ++tHexNode)
+    {
+        tContainingElementDensities[tHexNode] = aGridPrintableDensity[mTetNodeGridIndices[8u*aTetNodeIndex + tHexNode]];
+    }
+
+    RegularHex8 tHex(mTetNodeElementMinUVWCoords[aTetNodeIndex],mTetNodeElementMaxUVWCoords[aTetNodeIndex]);
+
+    return tHex.interpolateScalar(mTetNodeUVWCoords[aTetNodeIndex],tContainingElementDensities);
+}
+
 double AMFilterUtilities::computeGridPointBlueprintDensity(const int& i, const int& j, const int&k, AbstractInterface::ParallelVector* const aTetMeshBlueprintDensity) const
 {
 
@@ -74,29 +220,26 @@ void AMFilterUtilities::computeGridLayerSupportDensity(const int& k,
     if(aGridPrintableDensity.size() != tGridSize || aGridSupportDensity.size() != tGridSize)
         throw(std::domain_error("AMFilterUtilities::computeGridLayerSupportDensity: Density vectors do not match grid size"));
 
-    for(size_t i = 0; i < tGridDimensions[0]; ++i)
+    size_t tLayerSize = tGridDimensions[0]*tGridDimensions[1];
+    double* tLayerSupportDensity = aGridSupportDensity.data() + k*tLayerSize;
+
+    if(k == 0)
     {
-        for(size_t j = 0; j < tGridDimensions[1]; ++j)
-        {
-            if(k == 0)
-            {
-                aGridSupportDensity[mGridUtilities.getSerializedIndex(i,j,k)] = 1.0;
-            }
-            else
-            {
-                auto tSupportIndices = mGridUtilities.getSupportIndices(i,j,k);
-                std::vector<double> tSupportDensityBelow;
-                for(auto tSupportIndex : tSupportIndices)
-                {
-                    tSupportDensityBelow.push_back(aGridPrintableDensity[mGridUtilities.getSerializedIndex(tSupportIndex)]);
-                }
+        std::fill(tLayerSupportDensity, tLayerSupportDensity + tLayerSize, 1.0);
+        return;
+    }
 
-                double tVal = smax(tSupportDensityBelow,mPNorm);
+    std::vector<double> tLayerPoweredDensityBelow;
+    if(!computeLayerPoweredDensity(k-1,aGridPrintableDensity,tLayerPoweredDensityBelow))
+        throw(std::domain_error("AMFilterUtilities: Smooth max arguments must be positive"));
 
-                aGridSupportDensity[mGridUtilities.getSerializedIndex(i,j,k)] = tVal;
-            }
+    forEachRange(tLayerSize, mNumThreads, [&](size_t aBegin, size_t aEnd)
+    {
+        for(size_t tLayerIndex = aBegin; tLayerIndex < aEnd; ++tLayerIndex)
+        {
+            tLayerSupportDensity[tLayerIndex] = computeSupportDensity(tLayerIndex,tLayerPoweredDensityBelow);
         }
-    }
+    });
 }
 
 void AMFilterUtilities::computeGridLayerPrintableDensity(const int& k,
@@ -110,27 +253,51 @@ void AMFilterUtilities::computeGridLayerPrintableDensity(const int& k,
     if(aGridBlueprintDensity.size() != tGridSize || aGridPrintableDensity.size() != tGridSize || aGridSupportDensity.size() != tGridSize)
         throw(std::domain_error("AMFilterUtilities::computeGridLayerPrintableDensity: Density vectors do not match grid size"));
 
-    for(size_t i = 0; i < tGridDimensions[0]; ++i)
+    size_t tLayerBegin = k*tGridDimensions[0]*tGridDimensions[1];
+    size_t tLayerSize = tGridDimensions[0]*tGridDimensions[1];
+    forEachRange(tLayerSize, mNumThreads, [&](size_t aBegin, size_t aEnd)
     {
-        for(size_t j = 0; j < tGridDimensions[1]; ++j)
+        for(size_t tSerializedIndex = tLayerBegin + aBegin; tSerializedIndex < tLayerBegin + aEnd; ++tSerializedIndex)
         {
-            size_t tSerializedIndex = mGridUtilities.getSerializedIndex(i,j,k);
             aGridPrintableDensity[tSerializedIndex] = smin(aGridBlueprintDensity[tSerializedIndex],aGridSupportDensity[tSerializedIndex]);
         }
-    }
+    });
 }
 
 void AMFilterUtilities::computeGridPrintableDensity(const std::vector<double>& aGridBlueprintDensity, std::vector<double>& aGridPrintableDensity) const
 {
     auto tGridDimensions = mGridUtilities.getGridDimensions();
+    size_t tLayerSize = tGridDimensions[0]*tGridDimensions[1];
 
     aGridPrintableDensity.resize(tGridDimensions[0]*tGridDimensions[1]*tGridDimensions[2]);
-
-    std::vector<double> tGridSupportDensity(aGridPrintableDensity.size());
+    if(aGridBlueprintDensity.size() != aGridPrintableDensity.size())
+        throw(std::domain_error("AMFilterUtilities::computeGridPrintableDensity: Density vector does not match grid size"));
+
+    // one sweep per layer computes support and printable density, and the powers of the printable
+    // density that the layer above sums, so each grid value is raised to the P norm only once
+    std::vector<double> tLayerPoweredDensityBelow(tLayerSize);
+    std::vector<double> tLayerPoweredDensity(tLayerSize);
+    std::vector<char> tHasNegative(tLayerSize, 0);
     for(size_t k = 0; k < tGridDimensions[2]; ++k)
     {
-        computeGridLayerSupportDensity(k,aGridPrintableDensity,tGridSupportDensity);
-        computeGridLayerPrintableDensity(k,aGridBlueprintDensity,tGridSupportDensity,aGridPrintableDensity);
+        const double* tLayerBlueprintDensity = aGridBlueprintDensity.data() + k*tLayerSize;
+        double* tLayerPrintableDensity = aGridPrintableDensity.data() + k*tLayerSize;
+        forEachRange(tLayerSize, mNumThreads, [&](size_t aBegin, size_t aEnd)
+        {
+            for(size_t tLayerIndex = aBegin; tLayerIndex < aEnd; ++tLayerIndex)
+            {
+                double tSupportDensity = k == 0 ? 1.0 : computeSupportDensity(tLayerIndex,tLayerPoweredDensityBelow);
+                double tPrintableDensity = smin(tLayerBlueprintDensity[tLayerIndex],tSupportDensity);
+                tLayerPrintableDensity[tLayerIndex] = tPrintableDensity;
+                tHasNegative[tLayerIndex] = tPrintableDensity < 0;
+                tLayerPoweredDensity[tLayerIndex] = std::pow(std::abs(tPrintableDensity),mPNorm);
+            }
+        });
+
+        if(k + 1u < tGridDimensions[2] && std::find(tHasNegative.begin(), tHasNegative.end(), 1) != tHasNegative.end())
+            throw(std::domain_error("AMFilterUtilities: Smooth max arguments must be positive"));
+
+        std::swap(tLayerPoweredDensityBelow,tLayerPoweredDensity);
     }
 }
 
@@ -144,6 +311,9 @@ double AMFilterUtilities::computeTetNodePrintableDensity(const int& aTetNodeInde
     if(aGridPrintableDensity.size() != mGridPointCoordinates.size())
         throw(std::domain_error("AMFilterUtilities: Provided grid density vector does not match grid size"));
 
+    if(mTetNodeIsLocated[aTetNodeIndex])
+        return computeLocatedTetNodePrintableDensity(aTetNodeIndex,aGridPrintableDensity);
+
     std::vector<std::vector<size_t>> tContainingElementIndicies = mGridUtilities.getContainingGridElement(tCoordinates[aTetNodeIndex]);
 
     std::vector<double> tContainingElementDensities;
@@ -163,10 +333,23 @@ void AMFilterUtilities::computeTetMeshPrintableDensity(const std::vector<double>
     const std::vector<std::vector<double>>& tCoordinates = mTetUtilities.getCoordinates();
     if(aDensity->get_length() != tCoordinates.size())
         throw(std::domain_error("AMFilterUtilities: Tet mesh density vector does not match the mesh size"));
+    if(aGridPrintableDensity.size() != mGridPointCoordinates.size())
+        throw(std::domain_error("AMFilterUtilities: Provided grid density vector does not match grid size"));
+
+    size_t tNumNodes = aDensity->get_length();
+    std::vector<double> tNodeDensity(tNumNodes);
+    forEachRange(tNumNodes, mNumThreads, [&](size_t aBegin, size_t aEnd)
+    {
+        for(size_t i = aBegin; i < aEnd; ++i)
+        {
+            if(mTetNodeIsLocated[i])
+                tNodeDensity[i] = computeLocatedTetNodePrintableDensity(i, aGridPrintableDensity);
+        }
+    });
 
-    for(size_t i = 0; i < aDensity->get_length(); ++i)
+    for(size_t i = 0; i < tNumNodes; ++i)
     {
-        double tVal = computeTetNodePrintableDensity(i, aGridPrintableDensity);
+        double tVal = mTetNodeIsLocated[i] ? tNodeDensity[i] : computeTetNodePrintableDensity(i, aGridPrintableDensity);
         aDensity->set_value(i, tVal);
     }
 }
@@ -19,7 +19,8 @@ public:
                       double aPNorm)
                     :mTetUtilities(aTetUtilities),
                      mGridUtilities(aGridUtilities),
-                     mPNorm(aPNorm)
+                     mPNorm(aPNorm),
+                     mNumThreads(1u)
     {
         if(aPNorm < 1)
             throw(std::domain_error("AMFilterUtilities: P norm must be greater than 1"));
@@ -32,8 +33,14 @@ public:
         
         auto tGridDimensions = mGridUtilities.getGridDimensions();
         mGridPointCoordinates.resize(tGridDimensions[0]*tGridDimensions[1]*tGridDimensions[2]);
+
+        buildSupportStencils();
+        buildTetNodeInterpolation();
     }
 
+    void setNumThreads(const size_t& aNumThreads) {mNumThreads = (aNumThreads == 0u ? 1u : aNumThreads);}
+    size_t getNumThreads() const {return mNumThreads;}
+
     void computeGridBlueprintDensity(AbstractInterface::ParallelVector* const aTetMeshBlueprintDensity, std::vector<double>& aGridBlueprintDensity) const;
     double computeGridPointBlueprintDensity(const int& i, const int& j, const int&k, AbstractInterface::ParallelVector* const aTetMeshBlueprintDensity) const;
     double computeGridPointBlueprintDensity(const std::vector<int>& aIndex, AbstractInterface::ParallelVector* const aTetMeshBlueprintDensity) const;
@@ -54,12 +61,35 @@ public:
 
 private:
 
+    void buildSupportStencils();
+    void buildTetNodeInterpolation();
+    bool computeLayerPoweredDensity(const int& k,
+                                    const std::vector<double>& aGridPrintableDensity,
+                                    std::vector<double>& aLayerPoweredDensity) const;
+    double computeSupportDensity(const size_t& aLayerIndex, const std::vector<double>& aLayerPoweredDensityBelow) const;
+    double computeLocatedTetNodePrintableDensity(const int& aTetNodeIndex,
+                                                 const std::vector<double>& aGridPrintableDensity) const;
+
     const TetMeshUtilities& mTetUtilities;
     const OrthogonalGridUtilities& mGridUtilities;
     const double mPNorm;
+    size_t mNumThreads;
 
     std::vector<int> mContainingTetID;
     std::vector<Vector> mGridPointCoordinates;
+
+    // support stencil of in-layer index l = i + j*N_i lies in the layer below at mSupportLayerIndices[mSupportOffsets[l]] to [mSupportOffsets[l+1]-1]
+    std::vector<size_t> mSupportOffsets;
+    std::vector<size_t> mSupportLayerIndices;
+    std::vector<double> mSupportInverseQNorm;
+
+    // tet node n lies in the grid element with serialized node indices mTetNodeGridIndices[8n] to [8n+7]; the element
+    // bounds and the node in UVW coordinates are kept so interpolation matches OrthogonalGridUtilities::interpolateScalar
+    std::vector<size_t> mTetNodeGridIndices;
+    std::vector<Vector> mTetNodeElementMinUVWCoords;
+    std::vector<Vector> mTetNodeElementMaxUVWCoords;
+    std::vector<Vector> mTetNodeUVWCoords;
+    std::vector<bool> mTetNodeIsLocated;
 };
 
 double smax(const std::vector<double>& aArguments, const double& aPNorm);
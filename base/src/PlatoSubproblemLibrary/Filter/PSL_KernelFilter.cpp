@@ -59,6 +59,9 @@ KernelFilter::KernelFilter(AbstractAuthority* authority,
         m_local_kernel_matrix(),
         m_parallel_block_row_kernel_matrices(),
         m_parallel_block_column_kernel_matrices(),
+        m_transpose_plan(),
+        m_noTranspose_plan(),
+        m_matvec_input(),
         m_maintain_kernel_points(false),
         m_kernel_points()
 {
@@ -193,6 +196,10 @@ void KernelFilter::build()
                                             processor_neighbors_below,
                                             processor_neighbors_above);
 
+    // index lists and buffers of the parallel matvec never change after this point
+    build_exchange_plan(m_parallel_block_row_kernel_matrices, true, m_transpose_plan);
+    build_exchange_plan(m_parallel_block_column_kernel_matrices, false, m_noTranspose_plan);
+
     // clean up
     if(!m_maintain_kernel_points)
     {
@@ -228,13 +235,13 @@ bool KernelFilter::is_valid(AbstractInterface::ParallelVector* field)
         std::vector<double> initial_contracted_data(contracted_num_nodes, 0.);
         for(size_t cn = 0u; cn < contracted_num_nodes; cn++)
         {
-            initial_contracted_data[cn] = (*points->get_point(contracted_indexes[cn]))(d);
+            initial_contracted_data[cn] = points->get_coordinate(contracted_indexes[cn], d);
         }
         m_parallel_exchanger->get_expansion_to_parallel_vector(initial_contracted_data, field);
         for(size_t l = 0u; l < local_num_points; l++)
         {
             const double from_parallel_vector = field->get_value(l);
-            const double from_local_information = (*points->get_point(l))(d);
+            const double from_local_information = points->get_coordinate(l, d);
             if(fabs(from_parallel_vector - from_local_information) > data_tol)
             {
                 valid = false;
@@ -328,94 +335,93 @@ std::vector<double> KernelFilter::internal_parallel_matvec_apply(const std::vect
 
 void KernelFilter::parallel_matvec_apply_transpose(std::vector<double>& field)
 {
-    const size_t field_size = field.size();
-    const size_t mpi_rank = m_authority->mpi_wrapper->get_rank();
-    const size_t mpi_size = m_authority->mpi_wrapper->get_size();
-
-    // separate input and output
-    std::vector<double> input(field);
-    field.assign(field_size, 0.);
+    parallel_matvec_apply(field, m_parallel_block_row_kernel_matrices, true, m_transpose_plan);
+}
 
-    // local matrix vector product
-    m_local_kernel_matrix->matVec(input, field, true);
+void KernelFilter::parallel_matvec_apply_noTranspose(std::vector<double>& field)
+{
+    parallel_matvec_apply(field, m_parallel_block_column_kernel_matrices, false, m_noTranspose_plan);
+}
 
-    // parallel matrix vector product
-    for(size_t proc = 0; proc < mpi_size; proc++)
-    {
-        AbstractInterface::SparseMatrix* blockRowMatrix = m_parallel_block_row_kernel_matrices[proc];
-        if(blockRowMatrix)
+void KernelFilter::build_exchange_plan(const std::vector<AbstractInterface::SparseMatrix*>& block_matrices,
+                                       const bool transpose,
+                                       ExchangePlan& plan)
+{
+    plan.neighbors.clear();
+    plan.recv_offsets.assign(1u, 0u);
+    plan.recv_indexes.clear();
+    plan.send_buffers.clear();
+    plan.recv_buffers.clear();
+
+    // only processors sharing a non-empty block are exchanged with
+    const size_t num_blocks = block_matrices.size();
+    for(size_t proc = 0; proc < num_blocks; proc++)
+    {
+        AbstractInterface::SparseMatrix* blockMatrix = block_matrices[proc];
+        if(!blockMatrix)
         {
-            std::vector<double> data_to_send;
-            blockRowMatrix->matVecToReduced(input, data_to_send, true);
-
-            std::vector<size_t> reducedVector;
-            blockRowMatrix->getNonZeroSortedRows(reducedVector);
-            const size_t num_reduced = reducedVector.size();
-            std::vector<double> data_to_recv(num_reduced);
-
-            if(proc < mpi_rank)
-            {
-                m_authority->mpi_wrapper->send(proc, data_to_send);
-                m_authority->mpi_wrapper->receive(proc, data_to_recv);
-            }
-            else
-            {
-                m_authority->mpi_wrapper->receive(proc, data_to_recv);
-                m_authority->mpi_wrapper->send(proc, data_to_send);
-            }
+            continue;
+        }
+        plan.neighbors.push_back(proc);
 
-            for(size_t reduced_index = 0; reduced_index < num_reduced; reduced_index++)
-            {
-                const size_t local_id = reducedVector[reduced_index];
-                field[local_id] += data_to_recv[reduced_index];
-            }
+        // received values are accumulated at the non-zero rows (columns) of the block
+        std::vector<size_t> reducedVector;
+        size_t num_send = 0u;
+        if(transpose)
+        {
+            blockMatrix->getNonZeroSortedRows(reducedVector);
+            num_send = blockMatrix->getNumNonZeroSortedColumns();
         }
+        else
+        {
+            blockMatrix->getNonZeroSortedColumns(reducedVector);
+            num_send = blockMatrix->getNumNonZeroSortedRows();
+        }
+        plan.recv_indexes.insert(plan.recv_indexes.end(), reducedVector.begin(), reducedVector.end());
+        plan.recv_offsets.push_back(plan.recv_indexes.size());
+        plan.send_buffers.push_back(std::vector<double>(num_send, 0.));
+        plan.recv_buffers.push_back(std::vector<double>(reducedVector.size(), 0.));
     }
 }
 
-void KernelFilter::parallel_matvec_apply_noTranspose(std::vector<double>& field)
+void KernelFilter::parallel_matvec_apply(std::vector<double>& field,
+                                         const std::vector<AbstractInterface::SparseMatrix*>& block_matrices,
+                                         const bool transpose,
+                                         ExchangePlan& plan)
 {
-    const size_t field_size = field.size();
-    const size_t mpi_rank = m_authority->mpi_wrapper->get_rank();
-    const size_t mpi_size = m_authority->mpi_wrapper->get_size();
+    const size_t num_neighbors = plan.neighbors.size();
 
     // separate input and output
-    std::vector<double> input(field);
-    field.assign(field_size, 0.);
+    m_matvec_input.assign(field.begin(), field.end());
 
-    // local matrix vector product
-    m_local_kernel_matrix->matVec(input, field, false);
-
-    // parallel matrix vector product
-    for(size_t proc = 0; proc < mpi_size; proc++)
+    // post receives from neighbors
+    for(size_t neighbor = 0; neighbor < num_neighbors; neighbor++)
     {
-        AbstractInterface::SparseMatrix* blockColumnMatrix = m_parallel_block_column_kernel_matrices[proc];
-        if(blockColumnMatrix)
-        {
-            std::vector<double> data_to_send;
-            blockColumnMatrix->matVecToReduced(input, data_to_send, false);
+        m_authority->mpi_wrapper->ireceive(plan.neighbors[neighbor], plan.recv_buffers[neighbor]);
+    }
 
-            std::vector<size_t> reducedVector;
-            blockColumnMatrix->getNonZeroSortedColumns(reducedVector);
-            const size_t num_reduced = reducedVector.size();
-            std::vector<double> data_to_recv(num_reduced);
+    // post sends to neighbors
+    for(size_t neighbor = 0; neighbor < num_neighbors; neighbor++)
+    {
+        const size_t proc = plan.neighbors[neighbor];
+        block_matrices[proc]->matVecToReduced(m_matvec_input, plan.send_buffers[neighbor], transpose);
+        m_authority->mpi_wrapper->isend(proc, plan.send_buffers[neighbor]);
+    }
 
-            if(proc < mpi_rank)
-            {
-                m_authority->mpi_wrapper->send(proc, data_to_send);
-                m_authority->mpi_wrapper->receive(proc, data_to_recv);
-            }
-            else
-            {
-                m_authority->mpi_wrapper->receive(proc, data_to_recv);
-                m_authority->mpi_wrapper->send(proc, data_to_send);
-            }
+    // local matrix vector product, overlapped with communication
+    m_local_kernel_matrix->matVec(m_matvec_input, field, transpose);
 
-            for(size_t reduced_index = 0; reduced_index < num_reduced; reduced_index++)
-            {
-                const size_t local_id = reducedVector[reduced_index];
-                field[local_id] += data_to_recv[reduced_index];
-            }
+    // parallel matrix vector product
+    m_authority->mpi_wrapper->wait_all();
+    for(size_t neighbor = 0; neighbor < num_neighbors; neighbor++)
+    {
+        const std::vector<double>& data_to_recv = plan.recv_buffers[neighbor];
+        const size_t offset = plan.recv_offsets[neighbor];
+        const size_t num_reduced = plan.recv_offsets[neighbor + 1u] - offset;
+        for(size_t reduced_index = 0; reduced_index < num_reduced; reduced_index++)
+        {
+            const size_t local_id = plan.recv_indexes[offset + reduced_index];
+            field[local_id] += data_to_recv[reduced_index];
         }
     }
 }
@@ -87,6 +87,23 @@ private:
     void parallel_matvec_apply_transpose(std::vector<double>& field);
     void parallel_matvec_apply_noTranspose(std::vector<double>& field);
 
+    // persistent communication plan of the parallel matvec, fixed after build
+    struct ExchangePlan
+    {
+        std::vector<size_t> neighbors;
+        std::vector<size_t> recv_offsets;
+        std::vector<size_t> recv_indexes;
+        std::vector<std::vector<double> > send_buffers;
+        std::vector<std::vector<double> > recv_buffers;
+    };
+    void build_exchange_plan(const std::vector<AbstractInterface::SparseMatrix*>& block_matrices,
+                             const bool transpose,
+                             ExchangePlan& plan);
+    void parallel_matvec_apply(std::vector<double>& field,
+                               const std::vector<AbstractInterface::SparseMatrix*>& block_matrices,
+                               const bool transpose,
+                               ExchangePlan& plan);
+
     bool m_built;
     bool m_announce_radius;
 
@@ -120,6 +137,10 @@ private:
     AbstractInterface::SparseMatrix* m_local_kernel_matrix;
     std::vector<AbstractInterface::SparseMatrix*> m_parallel_block_row_kernel_matrices;
     std::vector<AbstractInterface::SparseMatrix*> m_parallel_block_column_kernel_matrices;
+    // exchange plans and work vector of the parallel matvec
+    ExchangePlan m_transpose_plan;
+    ExchangePlan m_noTranspose_plan;
+    std::vector<double> m_matvec_input;
 
     // kernel points for transfer
     bool m_maintain_kernel_points;
@@ -53,6 +53,8 @@ void KernelThenStructuredAMFilter::buildStructuredGrid(const std::vector<std::ve
     std::cout << "P Norm: " << tPNorm << std::endl;
 
     mAMFilterUtilities = std::unique_ptr<AMFilterUtilities>(new AMFilterUtilities( *(mTetUtilities.get()) , *(mGridUtilities.get()), tPNorm));
+    if(mInputData->didUserInput_num_threads())
+        mAMFilterUtilities->setNumThreads(mInputData->get_num_threads());
 
     mFilterBuilt = true;
 }
@@ -299,7 +299,7 @@ void OverhangFilter::compute_overhang_bias(PointCloud* kernel_points)
     {
         // get point data
         std::vector<double> this_point;
-        kernel_points->get_point(p)->get_data(this_point);
+        kernel_points->get_point(p).get_data(this_point);
         double this_inp = m_authority->dense_vector_operations->dot(build_direction, this_point);
         local_smallest_inner_product = std::min(local_smallest_inner_product, this_inp);
     }
@@ -315,7 +315,7 @@ void OverhangFilter::compute_overhang_bias(PointCloud* kernel_points)
     {
         // get point data
         std::vector<double> this_point;
-        kernel_points->get_point(p)->get_data(this_point);
+        kernel_points->get_point(p).get_data(this_point);
         double this_inp = m_authority->dense_vector_operations->dot(build_direction, this_point);
 
         // if global minimum, then on build plate, and thus bias on
@@ -6,22 +6,32 @@
 
 #include <vector>
 #include <cstddef>
+#include <algorithm>
+#include <stdexcept>
 
 namespace PlatoSubproblemLibrary
 {
 
 PointCloud::PointCloud()
-    : m_points() {
+    : m_indexes(),
+      m_coordinates(),
+      m_dimension(0u) {
 
 }
 
 PointCloud::PointCloud(PointCloud* other, const std::vector<size_t>& indexes_to_transfer)
-    : m_points(indexes_to_transfer.size())
+    : m_indexes(indexes_to_transfer.size()),
+      m_coordinates(3u * indexes_to_transfer.size()),
+      m_dimension(other->m_dimension)
 {
     const size_t num_indexes_to_transfer = indexes_to_transfer.size();
     for(size_t i = 0u; i < num_indexes_to_transfer; i++)
     {
-        m_points[i] = *other->get_point(indexes_to_transfer[i]);
+        const size_t other_index = indexes_to_transfer[i];
+        m_indexes[i] = other->m_indexes[other_index];
+        std::copy(other->m_coordinates.begin() + 3u * other_index,
+                  other->m_coordinates.begin() + 3u * (other_index + 1u),
+                  m_coordinates.begin() + 3u * i);
     }
 }
 
@@ -31,32 +41,57 @@ PointCloud::~PointCloud() {
 
 void PointCloud::resize(size_t num_points)
 {
-    m_points.resize(num_points);
+    m_indexes.resize(num_points, 0u);
+    m_coordinates.resize(3u * num_points, 0.);
 }
 
 void PointCloud::assign(std::vector<Point>& points)
 {
-    m_points.assign(points.begin(), points.end());
+    const size_t num_points = points.size();
+    m_indexes.resize(num_points);
+    m_coordinates.resize(3u * num_points);
+    for(size_t index = 0u; index < num_points; index++)
+    {
+        set_point(index, points[index]);
+    }
 }
 
 void PointCloud::assign(size_t index, const Point& point)
 {
-    m_points[index] = point;
+    set_point(index, point);
 }
 
 void PointCloud::push_back(const Point& point)
 {
-    m_points.push_back(point);
+    m_indexes.push_back(0u);
+    m_coordinates.resize(3u * m_indexes.size());
+    set_point(m_indexes.size() - 1u, point);
 }
 
 size_t PointCloud::get_num_points() const
 {
-    return m_points.size();
+    return m_indexes.size();
+}
+
+Point PointCloud::get_point(size_t index) const
+{
+    const std::vector<double> data(m_coordinates.begin() + 3u * index, m_coordinates.begin() + 3u * index + m_dimension);
+    return Point(m_indexes[index], data);
+}
+
+size_t PointCloud::get_index(size_t index) const
+{
+    return m_indexes[index];
+}
+
+const double* PointCloud::get_coordinates() const
+{
+    return m_coordinates.data();
 }
 
-Point* PointCloud::get_point(size_t index)
+double PointCloud::get_coordinate(size_t index, size_t dimension) const
 {
-    return &m_points[index];
+    return m_coordinates[3u * index + dimension];
 }
 
 AxisAlignedBoundingBox PointCloud::get_bound()
@@ -64,20 +99,41 @@ AxisAlignedBoundingBox PointCloud::get_bound()
     AxisAlignedBoundingBox result(0., 0., 0., 0u);
 
     // if no points, return origin
-    if(m_points.size() == 0u)
+    const size_t num_points = m_indexes.size();
+    if(num_points == 0u)
     {
         return result;
     }
 
     // build result to contain each point
-    result.set(&m_points[0]);
-    const size_t num_points = m_points.size();
+    result = AxisAlignedBoundingBox(m_coordinates[0u], m_coordinates[1u], m_coordinates[2u], m_indexes[0u]);
     for(size_t index = 1u; index < num_points; index++)
     {
-        result.grow_to_include(&m_points[index]);
+        const double* coordinates = &m_coordinates[3u * index];
+        result.set_x_min(std::min(float(coordinates[0u]), result.get_x_min()));
+        result.set_x_max(std::max(float(coordinates[0u]), result.get_x_max()));
+        result.set_y_min(std::min(float(coordinates[1u]), result.get_y_min()));
+        result.set_y_max(std::max(float(coordinates[1u]), result.get_y_max()));
+        result.set_z_min(std::min(float(coordinates[2u]), result.get_z_min()));
+        result.set_z_max(std::max(float(coordinates[2u]), result.get_z_max()));
     }
 
     return result;
 }
 
+void PointCloud::set_point(size_t index, const Point& point)
+{
+    const size_t dimension = point.dimension();
+    if(dimension > 3u)
+    {
+        throw(std::length_error("PointCloud: points must have at most 3 dimensions"));
+    }
+    m_dimension = std::max(m_dimension, dimension);
+    m_indexes[index] = point.get_index();
+    for(size_t d = 0u; d < 3u; d++)
+    {
+        m_coordinates[3u * index + d] = (d < dimension ? point(d) : 0.);
+    }
+}
+
 }
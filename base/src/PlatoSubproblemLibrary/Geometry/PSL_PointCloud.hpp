@@ -1,10 +1,15 @@
 // PlatoSubproblemLibraryVersion(3): a stand-alone library for the kernel filter for plato.
 #pragma once
 
-/* An ordered collection of points in an arbitrary dimension.
+/* An ordered collection of points of up to three dimensions.
  *
  * Point are accessed in this class by an indexing order in the cloud.
  * This ordering may not reflect the individual indexes of the points (be careful).
+ *
+ * Coordinates are stored in one contiguous array (x,y,z per point, in cloud order)
+ * next to the point indexes; no Point objects are kept. get_point builds a Point
+ * from this storage, so modify points through assign. Lower dimensional points
+ * are padded with zeros and returned with the cloud's dimension.
  */
 
 #include <vector>
@@ -26,12 +31,21 @@ public:
     void assign(size_t index, const Point& point);
     void push_back(const Point& point);
     size_t get_num_points() const;
-    Point* get_point(size_t index);
+    Point get_point(size_t index) const;
+    size_t get_index(size_t index) const;
+
+    // contiguous coordinates, entry 3*index+dimension
+    const double* get_coordinates() const;
+    double get_coordinate(size_t index, size_t dimension) const;
 
     AxisAlignedBoundingBox get_bound();
 
 protected:
-    std::vector<Point> m_points;
+    void set_point(size_t index, const Point& point);
+
+    std::vector<size_t> m_indexes;
+    std::vector<double> m_coordinates;
+    size_t m_dimension;
 
 };
 
@@ -84,6 +84,7 @@ public:
     PSL_PARAMETER_DATA_POD(tokens_t, double, build_direction_x)
     PSL_PARAMETER_DATA_POD(tokens_t, double, build_direction_y)
     PSL_PARAMETER_DATA_POD(tokens_t, double, build_direction_z)
+    PSL_PARAMETER_DATA_POD(tokens_t, int, num_threads)
 
     void defaults_for_classification();
     void defaults_for_feedForwardNeuralNetwork();
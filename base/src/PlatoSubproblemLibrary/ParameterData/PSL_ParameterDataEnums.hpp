@@ -78,6 +78,7 @@ enum tokens_t
     build_direction_x,
     build_direction_y,
     build_direction_z,
+    num_threads,
 };
 }
 namespace normalization_t {
@@ -109,6 +110,7 @@ enum spatial_searcher_t
     brute_force_fixed_radius_nearest_neighbors,
     radix_grid_fixed_radius_nearest_neighbors,
     brute_force_nearest_neighbor,
+    hashed_grid_fixed_radius_nearest_neighbors,
 };
 }
 namespace bounded_support_function_t {
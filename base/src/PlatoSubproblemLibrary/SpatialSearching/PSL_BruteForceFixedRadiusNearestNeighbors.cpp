@@ -37,12 +37,12 @@ void BruteForceFixedRadiusNearestNeighbors::get_neighbors(PlatoSubproblemLibrary
     const size_t num_answer_points = m_answer_points->get_num_points();
     for(size_t answer_index = 0u; answer_index < num_answer_points; answer_index++)
     {
-        PlatoSubproblemLibrary::Point* answer_point = m_answer_points->get_point(answer_index);
+        PlatoSubproblemLibrary::Point answer_point = m_answer_points->get_point(answer_index);
 
         // if within radius, add to results
-        if(query_point->distance(answer_point) <= m_radius)
+        if(query_point->distance(&answer_point) <= m_radius)
         {
-            neighbors_buffer[num_neighbors++] = answer_point->get_index();
+            neighbors_buffer[num_neighbors++] = answer_point.get_index();
         }
     }
 }
@@ -29,23 +29,23 @@ void BruteForceNearestNeighbor::build(PlatoSubproblemLibrary::PointCloud* answer
 // find nearest neighbor
 size_t BruteForceNearestNeighbor::get_neighbor(PlatoSubproblemLibrary::Point* query_point)
 {
-    Point* first_point = m_answer_points->get_point(0u);
-    double min_dist = query_point->distance(first_point);
-    size_t nearest_neighbor_index = first_point->get_index();
+    Point first_point = m_answer_points->get_point(0u);
+    double min_dist = query_point->distance(&first_point);
+    size_t nearest_neighbor_index = first_point.get_index();
 
     // for each answer point
     const size_t num_answer_points = m_answer_points->get_num_points();
     assert(num_answer_points > 0u);
     for(size_t answer_index = 1u; answer_index < num_answer_points; answer_index++)
     {
-        PlatoSubproblemLibrary::Point* answer_point = m_answer_points->get_point(answer_index);
+        PlatoSubproblemLibrary::Point answer_point = m_answer_points->get_point(answer_index);
 
         // if closest, update
-        double this_dist = query_point->distance(answer_point);
+        double this_dist = query_point->distance(&answer_point);
         if(this_dist <= min_dist)
         {
             min_dist = this_dist;
-            nearest_neighbor_index = answer_point->get_index();
+            nearest_neighbor_index = answer_point.get_index();
         }
     }
 
@@ -0,0 +1,255 @@
+// PlatoSubproblemLibraryVersion(8): a stand-alone library for the kernel filter for plato.
+#include "PSL_HashedGridFixedRadiusNearestNeighbors.hpp"
+
+#include "PSL_Point.hpp"
+#include "PSL_PointCloud.hpp"
+
+#include <cstddef>
+#include <vector>
+#include <thread>
+#include <functional>
+#include <cmath>
+#include <algorithm>
+
+namespace PlatoSubproblemLibrary
+{
+
+HashedGridFixedRadiusNearestNeighbors::HashedGridFixedRadiusNearestNeighbors() :
+        AbstractInterface::FixedRadiusNearestNeighborsSearcher(),
+        m_radius(-1.),
+        m_cell_size(1.),
+        m_min_x(0.),
+        m_min_y(0.),
+        m_min_z(0.),
+        m_bucket_mask(0u),
+        m_bucket_offsets(),
+        m_sorted_ids(),
+        m_sorted_coordinates()
+{
+}
+
+HashedGridFixedRadiusNearestNeighbors::~HashedGridFixedRadiusNearestNeighbors()
+{
+}
+
+// counting sort answer points by bucket
+void HashedGridFixedRadiusNearestNeighbors::build(PlatoSubproblemLibrary::PointCloud* answer_points, double radius)
+{
+    m_radius = radius;
+
+    const size_t num_points = answer_points->get_num_points();
+    const double* coordinates = answer_points->get_coordinates();
+
+    double max_x = 0.;
+    double max_y = 0.;
+    double max_z = 0.;
+    m_min_x = 0.;
+    m_min_y = 0.;
+    m_min_z = 0.;
+    if(num_points > 0u)
+    {
+        m_min_x = max_x = coordinates[0];
+        m_min_y = max_y = coordinates[1];
+        m_min_z = max_z = coordinates[2];
+    }
+    for(size_t point_index = 1u; point_index < num_points; point_index++)
+    {
+        m_min_x = std::min(m_min_x, coordinates[3u * point_index + 0u]);
+        max_x = std::max(max_x, coordinates[3u * point_index + 0u]);
+        m_min_y = std::min(m_min_y, coordinates[3u * point_index + 1u]);
+        max_y = std::max(max_y, coordinates[3u * point_index + 1u]);
+        m_min_z = std::min(m_min_z, coordinates[3u * point_index + 2u]);
+        max_z = std::max(max_z, coordinates[3u * point_index + 2u]);
+    }
+
+    // cells must be at least as wide as the radius; bound the cell index range for tiny radii
+    const double max_extent = std::max(max_x - m_min_x, std::max(max_y - m_min_y, max_z - m_min_z));
+    m_cell_size = std::max(m_radius, max_extent / double(1u << 20));
+    if(m_cell_size <= 0.)
+    {
+        m_cell_size = 1.;
+    }
+
+    // power of two buckets, at least one per point
+    size_t num_buckets = 1u;
+    while(num_buckets < num_points)
+    {
+        num_buckets *= 2u;
+    }
+    m_bucket_mask = num_buckets - 1u;
+
+    // count points per bucket
+    std::vector<size_t> point_buckets(num_points);
+    m_bucket_offsets.assign(num_buckets + 1u, 0u);
+    for(size_t point_index = 0u; point_index < num_points; point_index++)
+    {
+        const long long cell_x = (long long)std::floor((coordinates[3u * point_index + 0u] - m_min_x) / m_cell_size);
+        const long long cell_y = (long long)std::floor((coordinates[3u * point_index + 1u] - m_min_y) / m_cell_size);
+        const long long cell_z = (long long)std::floor((coordinates[3u * point_index + 2u] - m_min_z) / m_cell_size);
+        point_buckets[point_index] = get_bucket(cell_x, cell_y, cell_z);
+        m_bucket_offsets[point_buckets[point_index] + 1u]++;
+    }
+    for(size_t bucket = 0u; bucket < num_buckets; bucket++)
+    {
+        m_bucket_offsets[bucket + 1u] += m_bucket_offsets[bucket];
+    }
+
+    // scatter ids and coordinates into bucket order
+    std::vector<size_t> insert_position(m_bucket_offsets.begin(), m_bucket_offsets.end() - 1);
+    m_sorted_ids.resize(num_points);
+    m_sorted_coordinates.resize(3u * num_points);
+    for(size_t point_index = 0u; point_index < num_points; point_index++)
+    {
+        const size_t sorted_index = insert_position[point_buckets[point_index]]++;
+        m_sorted_ids[sorted_index] = answer_points->get_index(point_index);
+        m_sorted_coordinates[3u * sorted_index + 0u] = coordinates[3u * point_index + 0u];
+        m_sorted_coordinates[3u * sorted_index + 1u] = coordinates[3u * point_index + 1u];
+        m_sorted_coordinates[3u * sorted_index + 2u] = coordinates[3u * point_index + 2u];
+    }
+}
+
+// find neighbors of query point within radius
+void HashedGridFixedRadiusNearestNeighbors::get_neighbors(PlatoSubproblemLibrary::Point* query_point,
+                                                           std::vector<size_t>& neighbors_buffer,
+                                                           size_t& num_neighbors)
+{
+    // lower dimensional points are padded with zeros, as in PointCloud
+    const size_t dimension = std::min(query_point->dimension(), size_t(3u));
+    double query_coordinates[3] = {0., 0., 0.};
+    for(size_t d = 0u; d < dimension; d++)
+    {
+        query_coordinates[d] = (*query_point)(d);
+    }
+    query(query_coordinates, neighbors_buffer, num_neighbors);
+}
+
+// find neighbors of a range of query points; each thread answers a contiguous part of the range
+void HashedGridFixedRadiusNearestNeighbors::get_neighbors_of_points(PlatoSubproblemLibrary::PointCloud* query_points,
+                                                                     size_t query_begin,
+                                                                     size_t query_end,
+                                                                     size_t max_num_neighbors,
+                                                                     std::vector<size_t>& offsets,
+                                                                     std::vector<size_t>& neighbors)
+{
+    const size_t num_queries = query_end - query_begin;
+    const size_t num_threads = std::max(size_t(1u), std::min(m_num_threads, num_queries));
+    const size_t queries_per_thread = (num_queries + num_threads - 1u) / num_threads;
+
+    std::vector<size_t> num_neighbors_per_query(num_queries, 0u);
+    std::vector<std::vector<size_t> > thread_neighbors(num_threads);
+    if(num_threads == 1u)
+    {
+        query_range(query_points, query_begin, query_end, max_num_neighbors, num_neighbors_per_query.data(), thread_neighbors[0]);
+    }
+    else
+    {
+        std::vector<std::thread> threads;
+        for(size_t thread_index = 0u; thread_index < num_threads; thread_index++)
+        {
+            const size_t begin = std::min(num_queries, thread_index * queries_per_thread);
+            const size_t end = std::min(num_queries, begin + queries_per_thread);
+            threads.push_back(std::thread(&HashedGridFixedRadiusNearestNeighbors::query_range,
+                                          this,
+                                          query_points,
+                                          query_begin + begin,
+                                          query_begin + end,
+                                          max_num_neighbors,
+                                          num_neighbors_per_query.data() + begin,
+                                          std::ref(thread_neighbors[thread_index])));
+        }
+        for(size_t thread_index = 0u; thread_index < num_threads; thread_index++)
+        {
+            threads[thread_index].join();
+        }
+    }
+
+    // threads own contiguous query ranges, so concatenating in thread order keeps query order
+    offsets.assign(num_queries + 1u, 0u);
+    for(size_t query_index = 0u; query_index < num_queries; query_index++)
+    {
+        offsets[query_index + 1u] = offsets[query_index] + num_neighbors_per_query[query_index];
+    }
+    neighbors.resize(offsets[num_queries]);
+    size_t position = 0u;
+    for(size_t thread_index = 0u; thread_index < num_threads; thread_index++)
+    {
+        std::copy(thread_neighbors[thread_index].begin(), thread_neighbors[thread_index].end(), neighbors.begin() + position);
+        position += thread_neighbors[thread_index].size();
+    }
+}
+
+size_t HashedGridFixedRadiusNearestNeighbors::get_bucket(long long cell_x, long long cell_y, long long cell_z) const
+{
+    const size_t hash = (size_t(cell_x) * 73856093u) ^ (size_t(cell_y) * 19349663u) ^ (size_t(cell_z) * 83492791u);
+    return hash & m_bucket_mask;
+}
+
+void HashedGridFixedRadiusNearestNeighbors::query(const double* query_coordinates,
+                                                  std::vector<size_t>& neighbors_buffer,
+                                                  size_t& num_neighbors) const
+{
+    if(m_sorted_ids.empty())
+    {
+        return;
+    }
+
+    const double x = query_coordinates[0];
+    const double y = query_coordinates[1];
+    const double z = query_coordinates[2];
+    const long long cell_x = (long long)std::floor((x - m_min_x) / m_cell_size);
+    const long long cell_y = (long long)std::floor((y - m_min_y) / m_cell_size);
+    const long long cell_z = (long long)std::floor((z - m_min_z) / m_cell_size);
+
+    // distinct cells may share a bucket; scan each bucket once
+    size_t visited_buckets[27];
+    size_t num_visited = 0u;
+
+    const double radius_squared = m_radius * m_radius;
+    for(long long answer_x = cell_x - 1; answer_x <= cell_x + 1; answer_x++)
+    {
+        for(long long answer_y = cell_y - 1; answer_y <= cell_y + 1; answer_y++)
+        {
+            for(long long answer_z = cell_z - 1; answer_z <= cell_z + 1; answer_z++)
+            {
+                const size_t bucket = get_bucket(answer_x, answer_y, answer_z);
+                if(std::find(visited_buckets, visited_buckets + num_visited, bucket) != visited_buckets + num_visited)
+                {
+                    continue;
+                }
+                visited_buckets[num_visited++] = bucket;
+
+                const size_t bucket_end = m_bucket_offsets[bucket + 1u];
+                for(size_t sorted_index = m_bucket_offsets[bucket]; sorted_index < bucket_end; sorted_index++)
+                {
+                    const double dx = m_sorted_coordinates[3u * sorted_index + 0u] - x;
+                    const double dy = m_sorted_coordinates[3u * sorted_index + 1u] - y;
+                    const double dz = m_sorted_coordinates[3u * sorted_index + 2u] - z;
+                    if(dx * dx + dy * dy + dz * dz <= radius_squared)
+                    {
+                        neighbors_buffer[num_neighbors++] = m_sorted_ids[sorted_index];
+                    }
+                }
+            }
+        }
+    }
+}
+
+void HashedGridFixedRadiusNearestNeighbors::query_range(PlatoSubproblemLibrary::PointCloud* query_points,
+                                                        size_t begin,
+                                                        size_t end,
+                                                        size_t max_num_neighbors,
+                                                        size_t* num_neighbors_per_query,
+                                                        std::vector<size_t>& neighbors) const
+{
+    const double* query_coordinates = query_points->get_coordinates();
+    std::vector<size_t> neighbors_buffer(max_num_neighbors);
+    for(size_t query_index = begin; query_index < end; query_index++)
+    {
+        size_t num_neighbors = 0u;
+        query(&query_coordinates[3u * query_index], neighbors_buffer, num_neighbors);
+        neighbors.insert(neighbors.end(), neighbors_buffer.begin(), neighbors_buffer.begin() + num_neighbors);
+        num_neighbors_per_query[query_index - begin] = num_neighbors;
+    }
+}
+
+}
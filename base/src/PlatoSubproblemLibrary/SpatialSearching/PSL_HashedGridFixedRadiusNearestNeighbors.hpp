@@ -0,0 +1,59 @@
+// PlatoSubproblemLibraryVersion(8): a stand-alone library for the kernel filter for plato.
+#pragma once
+
+#include "PSL_Abstract_FixedRadiusNearestNeighborsSearcher.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace PlatoSubproblemLibrary
+{
+class PointCloud;
+class Point;
+
+// Cells of side at least radius are hashed into buckets; answer points are counting sorted by
+// bucket so that each bucket is a contiguous range of the sorted arrays.
+class HashedGridFixedRadiusNearestNeighbors : public AbstractInterface::FixedRadiusNearestNeighborsSearcher
+{
+public:
+    HashedGridFixedRadiusNearestNeighbors();
+    virtual ~HashedGridFixedRadiusNearestNeighbors();
+
+    // build searcher
+    virtual void build(PlatoSubproblemLibrary::PointCloud* answer_points, double radius);
+    // find neighbors within radius
+    virtual void get_neighbors(PlatoSubproblemLibrary::Point* query_point,
+                               std::vector<size_t>& neighbors_buffer,
+                               size_t& num_neighbors);
+    // find neighbors of a range of query points, split over threads
+    virtual void get_neighbors_of_points(PlatoSubproblemLibrary::PointCloud* query_points,
+                                         size_t query_begin,
+                                         size_t query_end,
+                                         size_t max_num_neighbors,
+                                         std::vector<size_t>& offsets,
+                                         std::vector<size_t>& neighbors);
+
+protected:
+    size_t get_bucket(long long cell_x, long long cell_y, long long cell_z) const;
+    void query(const double* query_coordinates, std::vector<size_t>& neighbors_buffer, size_t& num_neighbors) const;
+    void query_range(PlatoSubproblemLibrary::PointCloud* query_points,
+                     size_t begin,
+                     size_t end,
+                     size_t max_num_neighbors,
+                     size_t* num_neighbors_per_query,
+                     std::vector<size_t>& neighbors) const;
+
+    double m_radius;
+    double m_cell_size;
+    double m_min_x;
+    double m_min_y;
+    double m_min_z;
+    size_t m_bucket_mask;
+
+    // answer points of bucket b are m_sorted_ids[m_bucket_offsets[b]] to m_sorted_ids[m_bucket_offsets[b+1]-1]
+    std::vector<size_t> m_bucket_offsets;
+    std::vector<size_t> m_sorted_ids;
+    std::vector<double> m_sorted_coordinates;
+};
+
+}
@@ -40,7 +40,8 @@ protected:
     double m_radix_step_y;
     double m_radix_step_z;
 
-    std::map<std::pair<std::pair<size_t, size_t>, size_t>, std::vector<PlatoSubproblemLibrary::Point*> > m_radix_grid;
+    // cloud indexes of answer points per radix cell; coordinates are read from the cloud's contiguous store
+    std::map<std::pair<std::pair<size_t, size_t>, size_t>, std::vector<size_t> > m_radix_grid;
 };
 
 }
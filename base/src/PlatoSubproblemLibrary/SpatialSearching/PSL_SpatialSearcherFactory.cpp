@@ -8,6 +8,7 @@
 #include "PSL_BruteForceFixedRadiusNearestNeighbors.hpp"
 #include "PSL_Abstract_GlobalUtilities.hpp"
 #include "PSL_RadixGridFixedRadiusNearestNeighbors.hpp"
+#include "PSL_HashedGridFixedRadiusNearestNeighbors.hpp"
 #include "PSL_Abstract_NearestNeighborSearcher.hpp"
 #include "PSL_BruteForceNearestNeighbor.hpp"
 #include "PSL_AbstractAuthority.hpp"
@@ -44,6 +45,11 @@ AbstractInterface::FixedRadiusNearestNeighborsSearcher* build_fixed_radius_neare
             result = new RadixGridFixedRadiusNearestNeighbors;
             break;
         }
+        case spatial_searcher_t::hashed_grid_fixed_radius_nearest_neighbors:
+        {
+            result = new HashedGridFixedRadiusNearestNeighbors;
+            break;
+        }
         case spatial_searcher_t::brute_force_nearest_neighbor:
         case spatial_searcher_t::unset_spatial_searcher:
         default:
@@ -74,6 +80,7 @@ AbstractInterface::NearestNeighborSearcher* build_nearest_neighbor_searcher(spat
         case spatial_searcher_t::bounding_box_morton_hierarchy:
         case spatial_searcher_t::brute_force_fixed_radius_nearest_neighbors:
         case spatial_searcher_t::radix_grid_fixed_radius_nearest_neighbors:
+        case spatial_searcher_t::hashed_grid_fixed_radius_nearest_neighbors:
         case spatial_searcher_t::bounding_box_brute_force:
         case spatial_searcher_t::unset_spatial_searcher:
         default:
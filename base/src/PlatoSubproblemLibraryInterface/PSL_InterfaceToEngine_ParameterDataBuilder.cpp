@@ -1,13 +1,41 @@
 #include "PSL_InterfaceToEngine_ParameterDataBuilder.hpp"
 
+#include <memory>
+
 #include "PSL_ParameterDataEnums.hpp"
 #include "PSL_ParameterData.hpp"
 #include "Plato_InputData.hpp"
 #include "Plato_Parser.hpp"
+#include "Plato_Exceptions.hpp"
 
 namespace Plato
 {
 
+namespace
+{
+PlatoSubproblemLibrary::spatial_searcher_t::spatial_searcher_t parseSpatialSearcher(const std::string& aName)
+{
+    if(aName == "RECOMMENDED")
+    {
+        return PlatoSubproblemLibrary::spatial_searcher_t::recommended;
+    }
+    else if(aName == "BRUTEFORCE")
+    {
+        return PlatoSubproblemLibrary::spatial_searcher_t::brute_force_fixed_radius_nearest_neighbors;
+    }
+    else if(aName == "RADIXGRID")
+    {
+        return PlatoSubproblemLibrary::spatial_searcher_t::radix_grid_fixed_radius_nearest_neighbors;
+    }
+    else if(aName == "HASHEDGRID")
+    {
+        return PlatoSubproblemLibrary::spatial_searcher_t::hashed_grid_fixed_radius_nearest_neighbors;
+    }
+    throw Plato::ParsingException("Filter: unknown SpatialSearcher '" + aName
+                                  + "', expected Recommended, BruteForce, RadixGrid or HashedGrid.");
+}
+}
+
 InterfaceToEngine_ParameterDataBuilder::InterfaceToEngine_ParameterDataBuilder(InputData aInputData) :
         PlatoSubproblemLibrary::AbstractInterface::ParameterDataBuilder(),
         m_inputData(aInputData)
@@ -21,7 +49,8 @@ InterfaceToEngine_ParameterDataBuilder::~InterfaceToEngine_ParameterDataBuilder(
 PlatoSubproblemLibrary::ParameterData* InterfaceToEngine_ParameterDataBuilder::build()
 {
     // allocate result
-    PlatoSubproblemLibrary::ParameterData* result = new PlatoSubproblemLibrary::ParameterData;
+    // owned until returned, so parsing errors do not leak it
+    std::unique_ptr<PlatoSubproblemLibrary::ParameterData> result(new PlatoSubproblemLibrary::ParameterData);
 
     // get scale and/or absolute
     double absolute=-1.0;
@@ -30,6 +59,8 @@ PlatoSubproblemLibrary::ParameterData* InterfaceToEngine_ParameterDataBuilder::b
     double heaviside_min=-1.;
     double heaviside_update=-1.;
     double heaviside_max=-1;
+    PlatoSubproblemLibrary::spatial_searcher_t::spatial_searcher_t spatial_searcher =
+            PlatoSubproblemLibrary::spatial_searcher_t::recommended;
 
     if( m_inputData.size<Plato::InputData>("Filter") )
     {
@@ -82,6 +113,19 @@ PlatoSubproblemLibrary::ParameterData* InterfaceToEngine_ParameterDataBuilder::b
         {
             result->set_build_direction_z(Plato::Get::Double(tFilterNode, "BuildDirectionZ"));
         }
+        if(tFilterNode.size<std::string>("SpatialSearcher") > 0)
+        {
+            spatial_searcher = parseSpatialSearcher(Plato::Get::String(tFilterNode, "SpatialSearcher", true));
+        }
+        if(tFilterNode.size<std::string>("NumThreads") > 0)
+        {
+            const int num_threads = Plato::Get::Int(tFilterNode, "NumThreads");
+            if(num_threads < 1)
+            {
+                throw Plato::ParsingException("Filter: NumThreads must be a positive integer.");
+            }
+            result->set_num_threads(num_threads);
+        }
 
     }
 
@@ -144,7 +188,7 @@ PlatoSubproblemLibrary::ParameterData* InterfaceToEngine_ParameterDataBuilder::b
     }
 
     // defaults
-    result->set_spatial_searcher(PlatoSubproblemLibrary::spatial_searcher_t::spatial_searcher_t::recommended);
+    result->set_spatial_searcher(spatial_searcher);
     result->set_normalization(PlatoSubproblemLibrary::normalization_t::normalization_t::classical_row_normalization);
     result->set_reproduction(PlatoSubproblemLibrary::reproduction_level_t::reproduction_level_t::reproduce_constant);
     result->set_symmetry_plane_agent(PlatoSubproblemLibrary::symmetry_plane_agent_t::by_narrow_clone);
@@ -154,7 +198,7 @@ PlatoSubproblemLibrary::ParameterData* InterfaceToEngine_ParameterDataBuilder::b
     result->set_point_ghosting_agent(PlatoSubproblemLibrary::point_ghosting_agent_t::by_narrow_share);
     result->set_bounded_support_function(PlatoSubproblemLibrary::bounded_support_function_t::polynomial_tent_function);
 
-    return result;
+    return result.release();
 }
 
 }
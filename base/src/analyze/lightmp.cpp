@@ -705,7 +705,10 @@ void setupSolver( pugi::xml_node& config, AztecOO& solver,
       solver.SetAztecOption(AZ_precond, AZ_ilu);
       solver.SetAztecOption(AZ_subdomain_solve, AZ_ilu);
       solver.SetAztecOption(AZ_precond, AZ_dom_decomp);
-      solver.SetAztecOption(AZ_scaling, AZ_row_sum);
+      if( Plato::Parse::getString( config, "scaling" ) == "none" )
+        solver.SetAztecOption(AZ_scaling, AZ_none);
+      else
+        solver.SetAztecOption(AZ_scaling, AZ_row_sum);
       solver.SetAztecOption(AZ_solver, AZ_gmres);
     }
 }
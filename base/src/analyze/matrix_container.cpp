@@ -272,6 +272,32 @@ DistributedCrsMatrix::DistributedCrsMatrix(SystemContainer *sys) : DistributedEn
 }
 
 
+/******************************************************************************/
+void DistributedCrsMatrix::Assemble( const Real* localMatrix,
+                                     const int* elemConnect, int npe )
+/******************************************************************************/
+{
+    int dofsPerNode = mySystem->dofsPerNode;
+    int* node_global_ids = mySystem->myMesh->nodeGlobalIds;
+    int numElemDofs = npe*dofsPerNode;
+
+    // one column list per thread; every row of the element shares it
+    static thread_local std::vector<int> columns;
+    columns.resize(numElemDofs);
+    for(int jNode=0; jNode<npe; jNode++){
+      int global_column = node_global_ids[elemConnect[jNode]]*dofsPerNode;
+      for(int jDof=0; jDof<dofsPerNode; jDof++)
+        columns[jNode*dofsPerNode+jDof] = global_column+jDof;
+    }
+
+    for(int iRow=0; iRow<numElemDofs; iRow++){
+      int global_row = columns[iRow];
+      assemblyMatrix->SumIntoGlobalValues(global_row, numElemDofs,
+                                          const_cast<Real*>(&localMatrix[iRow*numElemDofs]),
+                                          columns.data());
+    }
+}
+
 /******************************************************************************/
 void DistributedCrsMatrix::Assemble( Intrepid::FieldContainer<double>& localMatrix, 
                                  int* elemConnect, int numFieldsG )
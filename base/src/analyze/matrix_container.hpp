@@ -142,6 +142,14 @@ class DistributedCrsMatrix : public DistributedEntity
     */
     DistributedCrsMatrix(SystemContainer *sys);
     void Assemble( Intrepid::FieldContainer<double>& localMatrix, int* elemConnect, int npe );
+
+    //! Sum a row-major element matrix into the assembly matrix.
+    /*!
+      \param localMatrix Element matrix with (npe*dofsPerNode)^2 entries, node major.
+      Only local workspace is used, so concurrent calls are safe as long as
+      they share no nodes (i.e., the elements are from the same color).
+    */
+    void Assemble( const Real* localMatrix, const int* elemConnect, int npe );
     Epetra_CrsMatrix* getEpetraCrsMatrix(){ return globalMatrix; }
     Epetra_CrsMatrix* getAssemblyEpetraCrsMatrix() const { return assemblyMatrix; }
     void replaceGlobalValue(int node1_plid, int node2_plid, int dof_id, Real val);
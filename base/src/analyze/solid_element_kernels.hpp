@@ -0,0 +1,157 @@
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+//
+// *************************************************************************
+//@HEADER
+*/
+
+#ifndef SOLID_ELEMENT_KERNELS
+#define SOLID_ELEMENT_KERNELS
+
+#include <cmath>
+
+/******************************************************************************/
+//! Fixed-size element kernels for small strain solid mechanics.
+/*!
+  Sizes are compile time constants so the inner loops have known trip counts
+  and the element workspace lives on the stack.  The kernels only read their
+  inputs, so they may be called concurrently from threaded element loops.
+  Dof ordering is node major (node*3+dim) and the Voigt ordering is
+  (xx, yy, zz, yz, xz, xy), matching SolidStatics.
+*/
+template<int NumNodes>
+class SolidElementKernel
+/******************************************************************************/
+{
+  public:
+    static const int SpaceDim = 3;
+    static const int NumDofs = SpaceDim*NumNodes;
+    static const int VoigtSize = 6;
+
+    //! Map reference shape function gradients to physical gradients.
+    /*!
+      \param nodes Nodal coordinates, nodes[node][dim].
+      \param refGrads Reference gradients at one cubature point, refGrads[node][dim].
+      \param grads Physical gradients, grads[node][dim].
+      \return Determinant of the Jacobian.
+    */
+    static double computeGradients( const double nodes[NumNodes][SpaceDim],
+                                    const double refGrads[NumNodes][SpaceDim],
+                                    double grads[NumNodes][SpaceDim] )
+    {
+      // J(i,j) = sum_n x_n(i) dN_n/dxi_j
+      double J[SpaceDim][SpaceDim] = {{0.0}};
+      for(int n=0; n<NumNodes; n++)
+        for(int i=0; i<SpaceDim; i++)
+          for(int j=0; j<SpaceDim; j++)
+            J[i][j] += nodes[n][i]*refGrads[n][j];
+
+      const double det = J[0][0]*(J[1][1]*J[2][2]-J[1][2]*J[2][1])
+                       - J[0][1]*(J[1][0]*J[2][2]-J[1][2]*J[2][0])
+                       + J[0][2]*(J[1][0]*J[2][1]-J[1][1]*J[2][0]);
+
+      // inverse transpose, so that grad = J^-T refGrad
+      const double invDet = 1.0/det;
+      double JinvT[SpaceDim][SpaceDim];
+      JinvT[0][0] =  (J[1][1]*J[2][2]-J[1][2]*J[2][1])*invDet;
+      JinvT[1][0] = -(J[0][1]*J[2][2]-J[0][2]*J[2][1])*invDet;
+      JinvT[2][0] =  (J[0][1]*J[1][2]-J[0][2]*J[1][1])*invDet;
+      JinvT[0][1] = -(J[1][0]*J[2][2]-J[1][2]*J[2][0])*invDet;
+      JinvT[1][1] =  (J[0][0]*J[2][2]-J[0][2]*J[2][0])*invDet;
+      JinvT[2][1] = -(J[0][0]*J[1][2]-J[0][2]*J[1][0])*invDet;
+      JinvT[0][2] =  (J[1][0]*J[2][1]-J[1][1]*J[2][0])*invDet;
+      JinvT[1][2] = -(J[0][0]*J[2][1]-J[0][1]*J[2][0])*invDet;
+      JinvT[2][2] =  (J[0][0]*J[1][1]-J[0][1]*J[1][0])*invDet;
+
+      for(int n=0; n<NumNodes; n++)
+        for(int i=0; i<SpaceDim; i++){
+          double val = 0.0;
+          for(int j=0; j<SpaceDim; j++)
+            val += JinvT[i][j]*refGrads[n][j];
+          grads[n][i] = val;
+        }
+
+      return det;
+    }
+
+    //! Strain-displacement matrix, B[voigt][dof].
+    static void computeB( const double grads[NumNodes][SpaceDim],
+                          double B[VoigtSize][NumDofs] )
+    {
+      for(int n=0; n<NumNodes; n++){
+        const double dx = grads[n][0], dy = grads[n][1], dz = grads[n][2];
+        const int ix = SpaceDim*n, iy = ix+1, iz = ix+2;
+
+        B[0][ix] = dx;  B[0][iy] = 0.0; B[0][iz] = 0.0;
+        B[1][ix] = 0.0; B[1][iy] = dy;  B[1][iz] = 0.0;
+        B[2][ix] = 0.0; B[2][iy] = 0.0; B[2][iz] = dz;
+        B[3][ix] = 0.0; B[3][iy] = dz;  B[3][iz] = dy;
+        B[4][ix] = dz;  B[4][iy] = 0.0; B[4][iz] = dx;
+        B[5][ix] = dy;  B[5][iy] = dx;  B[5][iz] = 0.0;
+      }
+    }
+
+    //! K += weight * B^T C B
+    static void addBtCB( const double C[VoigtSize][VoigtSize],
+                         const double B[VoigtSize][NumDofs],
+                         double weight,
+                         double K[NumDofs][NumDofs] )
+    {
+      // CB = weight * C B
+      double CB[VoigtSize][NumDofs];
+      for(int i=0; i<VoigtSize; i++){
+        for(int j=0; j<NumDofs; j++) CB[i][j] = 0.0;
+        for(int k=0; k<VoigtSize; k++){
+          const double cik = weight*C[i][k];
+          for(int j=0; j<NumDofs; j++)
+            CB[i][j] += cik*B[k][j];
+        }
+      }
+
+      // K(i,j) += sum_k B(k,i) CB(k,j); the j loop is contiguous
+      for(int i=0; i<NumDofs; i++)
+        for(int k=0; k<VoigtSize; k++){
+          const double bki = B[k][i];
+          if( bki == 0.0 ) continue;
+          for(int j=0; j<NumDofs; j++)
+            K[i][j] += bki*CB[k][j];
+        }
+    }
+};
+/******************************************************************************/
+#endif
@@ -43,12 +43,16 @@
 #include "lightmp.hpp"
 #include "bc.hpp"
 #include "Plato_PenaltyModel.hpp"
+#include "Plato_TimersTree.hpp"
 
 #define HAVE_CONFIG_H
 #include "matrix_container.hpp"
 #include "data_mesh.hpp"
 #include "data_container.hpp"
 #include "communicator.hpp"
+#include "solid_element_kernels.hpp"
+
+#include <cmath>
 
 using namespace Intrepid;
 
@@ -63,6 +67,19 @@ void SolidStatics::Parse( pugi::xml_node& input, LightMP& ren )
 
   solverspec = config.child( "solver" );
 
+  // optional solver reuse between solves; all default to off
+  reusePreconditioner = Plato::Parse::getBool( solverspec, "reuse_preconditioner" );
+  warmStart = Plato::Parse::getBool( solverspec, "warm_start" );
+  refreshInterval = Plato::Parse::getInt( solverspec, "preconditioner_refresh_interval" );
+  refreshIterationRatio = Plato::Parse::getDouble( solverspec, "preconditioner_refresh_iteration_ratio" );
+
+  // AZ_row_sum scaling rewrites A in place during each solve, so a kept
+  // preconditioner would not match the next matrix; reuse needs <scaling>none</scaling>
+  if( reusePreconditioner && Plato::Parse::getString( solverspec, "scaling" ) != "none" ){
+    p0cout << "SolidStatics: reuse_preconditioner ignored, it requires <scaling>none</scaling> in the solver spec" << endl;
+    reusePreconditioner = false;
+  }
+
   pugi::xml_node bcspecs = config.child( "boundary_conditions" );
   if( bcspecs ){
     // parse displacements
@@ -88,7 +105,17 @@ void SolidStatics::Parse( pugi::xml_node& input, LightMP& ren )
 }
 
 /******************************************************************************/
-SolidStatics::SolidStatics(SystemContainer& sys, LightMP& ren)
+SolidStatics::SolidStatics(SystemContainer& sys, LightMP& ren) :
+  reusePreconditioner(false),
+  warmStart(false),
+  refreshInterval(0),
+  refreshIterationRatio(0.0),
+  solvesSinceRefresh(0),
+  iterationsAfterRefresh(0),
+  myProblem(NULL),
+  mySolver(NULL),
+  previousSolution(NULL),
+  myTimers(NULL)
 /******************************************************************************/
 {
    myMaterialContainer = ren.getMaterialContainer();
@@ -141,6 +168,29 @@ SolidStatics::SolidStatics(SystemContainer& sys, LightMP& ren)
 
 }
 
+/******************************************************************************/
+SolidStatics::~SolidStatics()
+/******************************************************************************/
+{
+   resetSolver();
+   if(previousSolution) delete previousSolution;
+}
+
+/******************************************************************************/
+void SolidStatics::resetSolver()
+/******************************************************************************/
+{
+   if(mySolver){
+     mySolver->DestroyPreconditioner();
+     delete mySolver;
+     mySolver = NULL;
+   }
+   if(myProblem){
+     delete myProblem;
+     myProblem = NULL;
+   }
+}
+
 /******************************************************************************/
 void SolidStatics::
 computeInternalEnergy( DistributedVector* topology,
@@ -297,6 +347,8 @@ buildStiffnessMatrix( DistributedCrsMatrix&    stiffMatrix,
     const int dofsPerNode = mySystem->getDofsPerNode();
     const int voigtSize = 6;
 
+    if( elementColors.empty() ) colorElements();
+
     int nblocks = myMesh.getNumElemBlks();
     for(int ib=0; ib<nblocks; ib++){
       Topological::Element& elblock = *(myMesh.getElemBlk(ib));
@@ -306,6 +358,20 @@ buildStiffnessMatrix( DistributedCrsMatrix&    stiffMatrix,
       // not all blocks will be present on all processors
       if( elblock.getNumElem() == 0 ) continue;
 
+      // hex8 and tet4 blocks use the fixed-size, threaded kernels
+      int nnpe = elblock.getNnpe();
+      if( nHourglassModes == 0 && dofsPerNode == 3 && elblock.getDim() == 3 &&
+          elblock.getBasis().getCardinality() == nnpe ){
+        if( nnpe == 8 ){
+          assembleBlockStiffness<8>(stiffMatrix, ib, topoField, penaltyModel);
+          continue;
+        }
+        if( nnpe == 4 ){
+          assembleBlockStiffness<4>(stiffMatrix, ib, topoField, penaltyModel);
+          continue;
+        }
+      }
+
       shards::CellTopology& topo = elblock.getTopology();
       int numNodesPerElem = elblock.getNnpe();
       int spaceDim = elblock.getDim();
@@ -517,6 +583,137 @@ buildStiffnessMatrix( DistributedCrsMatrix&    stiffMatrix,
 
     return;
 }
+
+/******************************************************************************/
+void SolidStatics::colorElements()
+/******************************************************************************/
+{
+    // greedy coloring: an element takes the lowest color not yet used by any
+    // element that shares one of its nodes
+    DataMesh& myMesh = *myDataMesh;
+    int numNodes = myMesh.getNumNodes();
+
+    int nblocks = myMesh.getNumElemBlks();
+    elementColors.resize(nblocks);
+    for(int ib=0; ib<nblocks; ib++){
+      Topological::Element& elblock = *(myMesh.getElemBlk(ib));
+      int numNodesPerElem = elblock.getNnpe();
+      int numElemsThisBlock = elblock.getNumElem();
+
+      vector< vector<int> >& colors = elementColors[ib];
+      colors.clear();
+      vector< vector<int> > nodeColors(numNodes);
+      vector<bool> isTaken;
+      for(int iel=0; iel<numElemsThisBlock; iel++){
+        int* elemConnect = elblock.Connect(iel);
+
+        isTaken.assign(colors.size()+1, false);
+        for(int inode=0; inode<numNodesPerElem; inode++){
+          const vector<int>& taken = nodeColors[elemConnect[inode]];
+          for(size_t i=0; i<taken.size(); i++) isTaken[taken[i]] = true;
+        }
+        int color = 0;
+        while( isTaken[color] ) color++;
+
+        if( color == int(colors.size()) ) colors.push_back(vector<int>());
+        colors[color].push_back(iel);
+        for(int inode=0; inode<numNodesPerElem; inode++)
+          nodeColors[elemConnect[inode]].push_back(color);
+      }
+    }
+}
+
+/******************************************************************************/
+template<int NumNodes>
+void SolidStatics::
+assembleBlockStiffness( DistributedCrsMatrix& stiffMatrix, int ib,
+                        const Real* topoField,
+                        Plato::PenaltyModel* penaltyModel )
+/******************************************************************************/
+{
+    typedef SolidElementKernel<NumNodes> Kernel;
+    const int spaceDim = Kernel::SpaceDim;
+    const int numDofs = Kernel::NumDofs;
+    const int voigtSize = Kernel::VoigtSize;
+
+    MaterialContainer& mc = *myMaterialContainer;
+    DataMesh& myMesh = *myDataMesh;
+    Topological::Element& elblock = *(myMesh.getElemBlk(ib));
+
+    int numCubPoints = elblock.getNumIntPoints();
+    FieldContainer<double>& cubPoints = elblock.getCubaturePoints();
+    FieldContainer<double>& cubWeights = elblock.getCubatureWeights();
+
+    FieldContainer<double> Grads(NumNodes, numCubPoints, spaceDim);
+    elblock.getBasis().getValues(Grads, cubPoints, OPERATOR_GRAD);
+    FieldContainer<double> Gvals(NumNodes, numCubPoints);
+    elblock.getBasis().getValues(Gvals, cubPoints, OPERATOR_VALUE);
+
+    // reference gradients per cubature point, refGrads[cubPoint][node][dim]
+    vector<double> refGrads(numCubPoints*NumNodes*spaceDim);
+    for(int cubPoint=0; cubPoint<numCubPoints; cubPoint++)
+      for(int inode=0; inode<NumNodes; inode++)
+        for(int idim=0; idim<spaceDim; idim++)
+          refGrads[(cubPoint*NumNodes+inode)*spaceDim+idim] = Grads(inode, cubPoint, idim);
+
+    Real* X = myMesh.getX();
+    Real* Y = myMesh.getY();
+    Real* Z = myMesh.getZ();
+
+    // elements within a color share no nodes, so their scatters never touch the same rows
+    const vector< vector<int> >& colors = elementColors[ib];
+    int numColors = colors.size();
+    for(int icolor=0; icolor<numColors; icolor++){
+      const vector<int>& elems = colors[icolor];
+      int numElemsThisColor = elems.size();
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+      for(int ielem=0; ielem<numElemsThisColor; ielem++){
+        int iel = elems[ielem];
+        int* elemConnect = elblock.Connect(iel);
+
+        double nodes[NumNodes][spaceDim];
+        for(int inode=0; inode<NumNodes; inode++){
+          nodes[inode][0] = X[elemConnect[inode]];
+          nodes[inode][1] = Y[elemConnect[inode]];
+          nodes[inode][2] = Z[elemConnect[inode]];
+        }
+
+        double localStiffMatrix[numDofs][numDofs];
+        for(int i=0; i<numDofs; i++)
+          for(int j=0; j<numDofs; j++) localStiffMatrix[i][j] = 0.0;
+
+        double grads[NumNodes][spaceDim];
+        double B[voigtSize][numDofs];
+        double c[voigtSize][voigtSize];
+        for(int cubPoint=0; cubPoint<numCubPoints; cubPoint++){
+          typedef const double RefGrads[spaceDim];
+          const RefGrads* pointRefGrads =
+            reinterpret_cast<const RefGrads*>(&refGrads[cubPoint*NumNodes*spaceDim]);
+          double detJ = Kernel::computeGradients(nodes, pointRefGrads, grads);
+          Kernel::computeB(grads, B);
+
+          double topoVal=0.0;
+          for(int iNode=0; iNode<NumNodes; iNode++){
+            topoVal += Gvals(iNode,cubPoint)*topoField[elemConnect[iNode]];
+          }
+          if(penaltyModel) topoVal = penaltyModel->eval(topoVal);
+
+          FieldContainer<double>* C;
+          mc.getCurrentTangent(ib, iel, cubPoint, C, STRESS, STRAIN_INCREMENT);
+          for(int i=0; i<voigtSize; i++)
+            for(int k=0; k<voigtSize; k++) c[i][k] = (*C)(i,k);
+
+          double weight = topoVal*std::fabs(detJ)*cubWeights(cubPoint);
+          Kernel::addBtCB(c, B, weight, localStiffMatrix);
+        }
+
+        stiffMatrix.Assemble(&localStiffMatrix[0][0], elemConnect, NumNodes);
+      }
+    }
+}
 /******************************************************************************/
 void SolidStatics::computeExternalForces( DistributedVector& forcingVector,
                                           Real time )
@@ -843,19 +1040,68 @@ void SolidStatics::updateDisplacement( DistributedVector& x,
                                        DistributedVector& B,
                                        DistributedCrsMatrix& A, Real time )
 {
+  // the solver is bound to A, x, and B; rebuild it if any of them changed
+  if( myProblem && ( myProblem->GetMatrix() != A.getEpetraCrsMatrix() ||
+                     myProblem->GetLHS() != x.getEpetraVector() ||
+                     myProblem->GetRHS() != B.getEpetraVector() ) )
+    resetSolver();
 
   // create problem and solver
-  Epetra_LinearProblem problem( A.getEpetraCrsMatrix(),
-                                x.getEpetraVector(),
-                                B.getEpetraVector());
-  AztecOO solver(problem);
+  if(myTimers) myTimers->begin_partition(Plato::timer_partition_t::linear_solver_setup);
+  bool isNewSolver = (mySolver == NULL);
+  if( isNewSolver ){
+    myProblem = new Epetra_LinearProblem( A.getEpetraCrsMatrix(),
+                                          x.getEpetraVector(),
+                                          B.getEpetraVector());
+    mySolver = new AztecOO(*myProblem);
+  }
 
   // setup
   int niters; Real tolerance;
-  setupSolver( solverspec, solver, niters, tolerance, &A );
+  if( isNewSolver ) setupSolver( solverspec, *mySolver, niters, tolerance, &A );
+  else {
+    niters = Plato::Parse::getInt( solverspec, "iterations" );
+    tolerance = Plato::Parse::getDouble( solverspec, "tolerance" );
+  }
+
+  // the stiffness drifts slowly between optimization iterations, so an
+  // older preconditioner stays useful until the iteration count grows
+  if( reusePreconditioner ){
+    bool refresh = isNewSolver;
+    if( refreshInterval > 0 && solvesSinceRefresh >= refreshInterval ) refresh = true;
+    if( refreshIterationRatio > 0.0 &&
+        mySolver->NumIters() > refreshIterationRatio*iterationsAfterRefresh ) refresh = true;
+    if( refresh ){
+      double condest = 0.0;
+      mySolver->DestroyPreconditioner();
+      mySolver->ConstructPreconditioner(condest);
+      solvesSinceRefresh = 0;
+    }
+  }
+  if(myTimers) myTimers->end_partition();
+
+  // start from the previous displacement
+  if( warmStart && previousSolution )
+    *(x.getEpetraVector()) = *previousSolution;
 
   // solve
-  solver.Iterate( niters, tolerance );
+  if(myTimers) myTimers->begin_partition(Plato::timer_partition_t::linear_solver_solve);
+  mySolver->Iterate( niters, tolerance );
+  if(myTimers){
+    myTimers->end_partition();
+    myTimers->add_count(Plato::timer_partition_t::linear_solver_solve, mySolver->NumIters());
+  }
+
+  if( solvesSinceRefresh == 0 ) iterationsAfterRefresh = mySolver->NumIters();
+  solvesSinceRefresh++;
+
+  if( warmStart ){
+    if( previousSolution == NULL ) previousSolution = new Epetra_Vector(*(x.getEpetraVector()));
+    else *previousSolution = *(x.getEpetraVector());
+  }
+
+  // without reuse, keep the original one-shot behavior
+  if( !reusePreconditioner ) resetSolver();
 
   // exchange boundary data
   x.Import();
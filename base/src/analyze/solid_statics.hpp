@@ -55,8 +55,11 @@ class SystemContainer;
 class LightMP;
 class DistributedCrsMatrix;
 class DistributedVector;
+class AztecOO;
+class Epetra_LinearProblem;
+class Epetra_Vector;
 
-namespace Plato { class PenaltyModel; }
+namespace Plato { class PenaltyModel; class TimersTree; }
 
 /******************************************************************************/
 class SolidStatics
@@ -64,6 +67,10 @@ class SolidStatics
 {
   public:
     SolidStatics(SystemContainer& sys, LightMP& ren);
+    ~SolidStatics();
+
+    //! Optional timers; linear solver setup/solve times and iterations are logged to it.
+    void setTimersTree(Plato::TimersTree* timers){ myTimers = timers; }
 
     void buildStiffnessMatrix( DistributedCrsMatrix& K, 
                                const DistributedVector& topology,
@@ -90,6 +97,13 @@ class SolidStatics
   private:
     void Parse( pugi::xml_node& input, LightMP& ren );
 
+    void colorElements();
+
+    template<int NumNodes>
+    void assembleBlockStiffness( DistributedCrsMatrix& K, int blockIndex,
+                                 const Real* topoField,
+                                 Plato::PenaltyModel* penaltyModel );
+
     SystemContainer *mySystem;
     int nHourglassModes;
     Intrepid::FieldContainer<double>* hourglassModes;
@@ -107,6 +121,24 @@ class SolidStatics
     DataMesh* myDataMesh;
 
     pugi::xml_node solverspec;
+
+    // elementColors[block][color] lists elements that share no nodes, so
+    // each color can be assembled concurrently
+    vector< vector< vector<int> > > elementColors;
+
+    // linear solver kept between calls to updateDisplacement when
+    // <reuse_preconditioner> is set and <scaling> is none in the solver spec
+    void resetSolver();
+    bool reusePreconditioner;
+    bool warmStart;
+    int refreshInterval;
+    Real refreshIterationRatio;
+    int solvesSinceRefresh;
+    int iterationsAfterRefresh;
+    Epetra_LinearProblem* myProblem;
+    AztecOO* mySolver;
+    Epetra_Vector* previousSolution;
+    Plato::TimersTree* myTimers;
 };
 /******************************************************************************/
 #endif
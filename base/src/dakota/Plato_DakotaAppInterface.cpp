@@ -66,6 +66,28 @@ DakotaAppInterface::DakotaAppInterface
      mInterface(aInterface),
      mDataMap(aInterface->getInputData())
 {
+    this->initializeEvaluationCache(aInterface->getInputData());
+}
+
+void DakotaAppInterface::initializeEvaluationCache(const Plato::InputData& aInputData)
+{
+    if(aInputData.size<Plato::InputData>("DakotaDriver") == 0)
+        return;
+
+    auto tDakotaDriver = aInputData.get<Plato::InputData>("DakotaDriver");
+    auto tFileName = Plato::Get::String(tDakotaDriver, "EvaluationCacheFile");
+    auto tUseCache = Plato::Get::Bool(tDakotaDriver, "EvaluationCache", !tFileName.empty());
+    if(!tUseCache)
+        return;
+
+    // every rank reads the database so that all of them skip the same stages; one rank writes it
+    MPI_Comm tLocalComm;
+    mInterface->getLocalComm(tLocalComm);
+    int tMyRank = 0;
+    MPI_Comm_rank(tLocalComm, &tMyRank);
+
+    auto tTolerance = Plato::Get::Double(tDakotaDriver, "EvaluationCacheTolerance");
+    mEvaluationCache = std::make_shared<Plato::DakotaEvaluationCache>(tFileName, tTolerance, tMyRank == 0);
 }
 
 int DakotaAppInterface::derived_map_if(const Dakota::String &if_name)
@@ -88,9 +110,13 @@ int DakotaAppInterface::derived_map_of(const Dakota::String &of_name)
 
 void DakotaAppInterface::wait_local_evaluations(Dakota::PRPQueue &aParamResponsePairQueue)
 {
+    if(this->setDakotaOutputDataFromCache(aParamResponsePairQueue))
+        return;
+
     this->setAllStageData(aParamResponsePairQueue);
     this->evaluateStages();
     this->setDakotaOutputData(aParamResponsePairQueue);
+    this->cacheEvaluations(aParamResponsePairQueue);
 }
 
 void DakotaAppInterface::derived_map_asynch(const Dakota::ParamResponsePair& pair)
@@ -318,5 +344,103 @@ void DakotaAppInterface::setDakotaOutputData(const Dakota::PRPQueue &aParamRespo
     }
 }
 
+Plato::dakota::EvaluationRecord DakotaAppInterface::makeEvaluationRecord(const Dakota::ParamResponsePair& aPRP)
+{
+    this->setLocalData(aPRP);
+
+    Plato::dakota::EvaluationRecord tRecord;
+    for (size_t tIndex = 0; tIndex < Dakota::DirectApplicInterface::numACV; tIndex++)
+        tRecord.mContinuousVars.push_back(Dakota::DirectApplicInterface::xC[tIndex]);
+    for (size_t tIndex = 0; tIndex < Dakota::DirectApplicInterface::numADRV; tIndex++)
+        tRecord.mDiscreteRealVars.push_back(Dakota::DirectApplicInterface::xDR[tIndex]);
+    for (size_t tIndex = 0; tIndex < Dakota::DirectApplicInterface::numADIV; tIndex++)
+        tRecord.mDiscreteIntegerVars.push_back(Dakota::DirectApplicInterface::xDI[tIndex]);
+
+    auto tNumCriteria = Dakota::DirectApplicInterface::directFnASV.size();
+    tRecord.mActiveSet.resize(tNumCriteria);
+    for (size_t tCriterion = 0; tCriterion < tNumCriteria; tCriterion++)
+        tRecord.mActiveSet[tCriterion] = Dakota::DirectApplicInterface::directFnASV[tCriterion];
+    tRecord.mValues.assign(tNumCriteria, 0.0);
+    tRecord.mGradients.resize(tNumCriteria);
+    return tRecord;
+}
+
+bool DakotaAppInterface::setDakotaOutputDataFromCache(const Dakota::PRPQueue &aParamResponsePairQueue)
+{
+    if (mEvaluationCache == nullptr || aParamResponsePairQueue.empty())
+        return false;
+
+    // stages evaluate the whole queue, so they are skipped only if every pair is a hit
+    std::vector<Plato::dakota::EvaluationRecord> tCachedRecords(aParamResponsePairQueue.size());
+    size_t tPrpIndex = 0;
+    for (Dakota::PRPQueueIter tParamRespPairIter = aParamResponsePairQueue.begin();
+             tParamRespPairIter != aParamResponsePairQueue.end(); tParamRespPairIter++, tPrpIndex++)
+    {
+        auto tQuery = this->makeEvaluationRecord(*tParamRespPairIter);
+        if (!mEvaluationCache->find(tQuery, tCachedRecords[tPrpIndex]))
+            return false;
+
+        for (size_t tCriterion=0; tCriterion < tQuery.mActiveSet.size(); tCriterion++)
+        {
+            if ((tQuery.mActiveSet[tCriterion] & 2) &&
+                tCachedRecords[tPrpIndex].mGradients[tCriterion].size() < Dakota::DirectApplicInterface::numDerivVars)
+                return false;
+        }
+    }
+
+    tPrpIndex = 0;
+    for (Dakota::PRPQueueIter tParamRespPairIter = aParamResponsePairQueue.begin();
+             tParamRespPairIter != aParamResponsePairQueue.end(); tParamRespPairIter++, tPrpIndex++)
+    {
+        this->setLocalData(*tParamRespPairIter);
+        const auto& tCached = tCachedRecords[tPrpIndex];
+
+        Dakota::Response tResponse = tParamRespPairIter->response();
+        Dakota::RealVector tDakotaFunVals = tResponse.function_values_view();
+        Dakota::RealMatrix tDakotaFunGrads = tResponse.function_gradients_view();
+        auto tNumActiveCriteria = Dakota::DirectApplicInterface::directFnASV.size();
+        for (size_t tCriterion=0; tCriterion < tNumActiveCriteria; tCriterion++)
+        {
+            short tASV = Dakota::DirectApplicInterface::directFnASV[tCriterion];
+            if (tASV & 1)
+                tDakotaFunVals[tCriterion] = tCached.mValues[tCriterion];
+            if (tASV & 2)
+            {
+                for (size_t tVarIndex = 0; tVarIndex < Dakota::DirectApplicInterface::numDerivVars; tVarIndex++)
+                    tDakotaFunGrads[tCriterion][tVarIndex] = tCached.mGradients[tCriterion][tVarIndex];
+            }
+        }
+        Dakota::DirectApplicInterface::completionSet.insert(tParamRespPairIter->eval_id());
+    }
+    return true;
+}
+
+void DakotaAppInterface::cacheEvaluations(const Dakota::PRPQueue &aParamResponsePairQueue)
+{
+    if (mEvaluationCache == nullptr)
+        return;
+
+    for (Dakota::PRPQueueIter tParamRespPairIter = aParamResponsePairQueue.begin();
+             tParamRespPairIter != aParamResponsePairQueue.end(); tParamRespPairIter++)
+    {
+        auto tRecord = this->makeEvaluationRecord(*tParamRespPairIter);
+
+        Dakota::Response tResponse = tParamRespPairIter->response();
+        Dakota::RealVector tDakotaFunVals = tResponse.function_values_view();
+        Dakota::RealMatrix tDakotaFunGrads = tResponse.function_gradients_view();
+        for (size_t tCriterion=0; tCriterion < tRecord.mActiveSet.size(); tCriterion++)
+        {
+            if (tRecord.mActiveSet[tCriterion] & 1)
+                tRecord.mValues[tCriterion] = tDakotaFunVals[tCriterion];
+            if (tRecord.mActiveSet[tCriterion] & 2)
+            {
+                for (size_t tVarIndex = 0; tVarIndex < Dakota::DirectApplicInterface::numDerivVars; tVarIndex++)
+                    tRecord.mGradients[tCriterion].push_back(tDakotaFunGrads[tCriterion][tVarIndex]);
+            }
+        }
+        mEvaluationCache->insert(tRecord);
+    }
+}
+
 }
 // namespace Plato
@@ -50,6 +50,7 @@
 
 #include <vector>
 #include <string>
+#include <memory>
 #include <iterator>
 #include <algorithm>
 
@@ -62,6 +63,7 @@
 #include "Plato_Interface.hpp"
 #include "Plato_FreeFunctions.hpp"
 #include "Plato_DakotaDataMap.hpp"
+#include "Plato_DakotaEvaluationCache.hpp"
 #include "Plato_DakotaAppInterfaceUtilities.hpp"
 
 namespace Plato
@@ -243,11 +245,39 @@ private:
     void setNewEvaluationFlagsForPRPQueue(const size_t& tNumCriteria,
                                           const Dakota::PRPQueue& aParamResponsePairQueue);
 
+    /******************************************************************************//**
+     * \brief Create the evaluation cache if requested in the DakotaDriver block
+     * \param [in] aInputData Plato Engine (PE) input metadata.
+    **********************************************************************************/
+    void initializeEvaluationCache(const Plato::InputData& aInputData);
+
+    /******************************************************************************//**
+     * \brief Collect variables, active set and responses of a parameter-response pair
+     * \param [in] aPRP Dakota parameter response pair
+     * \return evaluation record
+    **********************************************************************************/
+    Plato::dakota::EvaluationRecord makeEvaluationRecord(const Dakota::ParamResponsePair& aPRP);
+
+    /******************************************************************************//**
+     * \brief Set dakota output data from the evaluation cache if every pair in the \n
+     *   queue has been evaluated before
+     * \param [in] aParamResponsePairQueue parameter-response pair queue metadata
+     * \return true if the whole queue was served from the cache
+    **********************************************************************************/
+    bool setDakotaOutputDataFromCache(const Dakota::PRPQueue &aParamResponsePairQueue);
+
+    /******************************************************************************//**
+     * \brief Store the responses of the evaluated queue in the evaluation cache
+     * \param [in] aParamResponsePairQueue parameter-response pair queue metadata
+    **********************************************************************************/
+    void cacheEvaluations(const Dakota::PRPQueue &aParamResponsePairQueue);
+
 private:
     Plato::Interface *mInterface; /*!< provides access to functions in plato engine */
     Teuchos::ParameterList mParameterList = Teuchos::ParameterList(); /*!< list of input and output shared data for evaluating plato stages */
     Plato::DakotaDataMap mDataMap; /*!< maps from plato stage shared data (inputs & outputs) to dakota data*/
     std::vector<Plato::DakotaEvaluationType> mEvaluationFlags; /*!< flag of evaluation type (value, gradient, or gradient and value) for different criteria  */
+    std::shared_ptr<Plato::DakotaEvaluationCache> mEvaluationCache; /*!< previously evaluated variables and responses, null if disabled */
 
 };
 // class DakotaAppInterface
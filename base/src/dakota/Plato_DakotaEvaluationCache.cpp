@@ -0,0 +1,309 @@
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+//
+// *************************************************************************
+//@HEADER
+*/
+
+/*
+ * Plato_DakotaEvaluationCache.cpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#include <cmath>
+#include <limits>
+#include <cstring>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+
+#include "Plato_DakotaEvaluationCache.hpp"
+
+namespace Plato
+{
+
+namespace
+{
+
+inline size_t combineHash(size_t aSeed, size_t aValue)
+{
+    return aSeed ^ (aValue + 0x9e3779b97f4a7c15ull + (aSeed << 6) + (aSeed >> 2));
+}
+
+inline size_t realHashKey(double aValue, double aTolerance)
+{
+    if(aTolerance > 0.0)
+    {
+        // cells much wider than the tolerance, so near points rarely straddle a boundary
+        const double tCell = aValue / (1024.0 * aTolerance);
+        if(std::fabs(tCell) < 9.0e18)
+        {
+            return static_cast<size_t>(static_cast<long long>(std::floor(tCell)));
+        }
+    }
+    if(aValue == 0.0)
+    {
+        return 0u; // +0 and -0
+    }
+    uint64_t tBits = 0;
+    std::memcpy(&tBits, &aValue, sizeof(tBits));
+    return static_cast<size_t>(tBits);
+}
+
+inline bool sameReal(double aValueOne, double aValueTwo, double aTolerance)
+{
+    return aValueOne == aValueTwo || std::fabs(aValueOne - aValueTwo) <= aTolerance;
+}
+
+}
+// namespace
+
+DakotaEvaluationCache::DakotaEvaluationCache(const std::string& aFileName, double aTolerance, bool aWriteFile) :
+    mFileName(aFileName),
+    mTolerance(aTolerance > 0.0 ? aTolerance : 0.0),
+    mWriteFile(aWriteFile)
+{
+    this->readFile();
+}
+
+bool DakotaEvaluationCache::find(const dakota::EvaluationRecord& aQuery, dakota::EvaluationRecord& aResult) const
+{
+    auto tIndex = this->findIndex(aQuery, this->hash(aQuery));
+    if(tIndex < 0 || !this->covers(mRecords[tIndex], aQuery))
+    {
+        return false;
+    }
+    aResult = mRecords[tIndex];
+    return true;
+}
+
+void DakotaEvaluationCache::insert(const dakota::EvaluationRecord& aRecord)
+{
+    this->insertRecord(aRecord);
+    this->appendToFile(mRecords[this->findIndex(aRecord, this->hash(aRecord))]);
+}
+
+size_t DakotaEvaluationCache::hash(const dakota::EvaluationRecord& aRecord) const
+{
+    size_t tHash = combineHash(0u, aRecord.mActiveSet.size());
+    tHash = combineHash(tHash, aRecord.mContinuousVars.size());
+    for(auto tValue : aRecord.mContinuousVars)
+    {
+        tHash = combineHash(tHash, realHashKey(tValue, mTolerance));
+    }
+    tHash = combineHash(tHash, aRecord.mDiscreteRealVars.size());
+    for(auto tValue : aRecord.mDiscreteRealVars)
+    {
+        tHash = combineHash(tHash, realHashKey(tValue, mTolerance));
+    }
+    tHash = combineHash(tHash, aRecord.mDiscreteIntegerVars.size());
+    for(auto tValue : aRecord.mDiscreteIntegerVars)
+    {
+        tHash = combineHash(tHash, static_cast<size_t>(tValue));
+    }
+    return tHash;
+}
+
+bool DakotaEvaluationCache::sameVariables(const dakota::EvaluationRecord& aRecordOne, const dakota::EvaluationRecord& aRecordTwo) const
+{
+    if(aRecordOne.mActiveSet.size() != aRecordTwo.mActiveSet.size() ||
+       aRecordOne.mContinuousVars.size() != aRecordTwo.mContinuousVars.size() ||
+       aRecordOne.mDiscreteRealVars.size() != aRecordTwo.mDiscreteRealVars.size() ||
+       aRecordOne.mDiscreteIntegerVars != aRecordTwo.mDiscreteIntegerVars)
+    {
+        return false;
+    }
+    for(size_t tIndex = 0; tIndex < aRecordOne.mContinuousVars.size(); tIndex++)
+    {
+        if(!sameReal(aRecordOne.mContinuousVars[tIndex], aRecordTwo.mContinuousVars[tIndex], mTolerance))
+        {
+            return false;
+        }
+    }
+    for(size_t tIndex = 0; tIndex < aRecordOne.mDiscreteRealVars.size(); tIndex++)
+    {
+        if(!sameReal(aRecordOne.mDiscreteRealVars[tIndex], aRecordTwo.mDiscreteRealVars[tIndex], mTolerance))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool DakotaEvaluationCache::covers(const dakota::EvaluationRecord& aCached, const dakota::EvaluationRecord& aQuery) const
+{
+    for(size_t tCriterion = 0; tCriterion < aQuery.mActiveSet.size(); tCriterion++)
+    {
+        const short tRequested = aQuery.mActiveSet[tCriterion];
+        if((aCached.mActiveSet[tCriterion] & tRequested) != tRequested)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+int DakotaEvaluationCache::findIndex(const dakota::EvaluationRecord& aQuery, size_t aHash) const
+{
+    auto tRange = mBuckets.equal_range(aHash);
+    for(auto tIter = tRange.first; tIter != tRange.second; ++tIter)
+    {
+        if(this->sameVariables(mRecords[tIter->second], aQuery))
+        {
+            return static_cast<int>(tIter->second);
+        }
+    }
+    return -1;
+}
+
+void DakotaEvaluationCache::insertRecord(const dakota::EvaluationRecord& aRecord)
+{
+    const size_t tNumCriteria = aRecord.mActiveSet.size();
+    const size_t tHash = this->hash(aRecord);
+    auto tIndex = this->findIndex(aRecord, tHash);
+    if(tIndex < 0)
+    {
+        dakota::EvaluationRecord tEmpty;
+        tEmpty.mContinuousVars = aRecord.mContinuousVars;
+        tEmpty.mDiscreteRealVars = aRecord.mDiscreteRealVars;
+        tEmpty.mDiscreteIntegerVars = aRecord.mDiscreteIntegerVars;
+        tEmpty.mActiveSet.assign(tNumCriteria, 0);
+        tEmpty.mValues.assign(tNumCriteria, 0.0);
+        tEmpty.mGradients.resize(tNumCriteria);
+        mRecords.push_back(tEmpty);
+        tIndex = static_cast<int>(mRecords.size() - 1u);
+        mBuckets.insert(std::make_pair(tHash, static_cast<size_t>(tIndex)));
+    }
+
+    // merge the newly evaluated responses into the record
+    auto& tCached = mRecords[tIndex];
+    for(size_t tCriterion = 0; tCriterion < tNumCriteria; tCriterion++)
+    {
+        const short tActiveSet = aRecord.mActiveSet[tCriterion];
+        if((tActiveSet & 1) && tCriterion < aRecord.mValues.size())
+        {
+            tCached.mValues[tCriterion] = aRecord.mValues[tCriterion];
+            tCached.mActiveSet[tCriterion] |= 1;
+        }
+        if((tActiveSet & 2) && tCriterion < aRecord.mGradients.size())
+        {
+            tCached.mGradients[tCriterion] = aRecord.mGradients[tCriterion];
+            tCached.mActiveSet[tCriterion] |= 2;
+        }
+    }
+}
+
+void DakotaEvaluationCache::readFile()
+{
+    if(mFileName.empty())
+    {
+        return;
+    }
+
+    std::ifstream tFile(mFileName);
+    std::string tLine;
+    while(std::getline(tFile, tLine))
+    {
+        // lines that don't parse, e.g. one cut short by a crash, are skipped
+        std::istringstream tStream(tLine);
+        std::string tTag;
+        size_t tNumContinuous = 0, tNumDiscreteReal = 0, tNumDiscreteInteger = 0, tNumCriteria = 0;
+        if(!(tStream >> tTag >> tNumContinuous >> tNumDiscreteReal >> tNumDiscreteInteger >> tNumCriteria) || tTag != "eval")
+        {
+            continue;
+        }
+
+        dakota::EvaluationRecord tRecord;
+        tRecord.mContinuousVars.resize(tNumContinuous);
+        tRecord.mDiscreteRealVars.resize(tNumDiscreteReal);
+        tRecord.mDiscreteIntegerVars.resize(tNumDiscreteInteger);
+        tRecord.mActiveSet.resize(tNumCriteria);
+        tRecord.mValues.resize(tNumCriteria);
+        tRecord.mGradients.resize(tNumCriteria);
+        for(auto& tValue : tRecord.mContinuousVars) { tStream >> tValue; }
+        for(auto& tValue : tRecord.mDiscreteRealVars) { tStream >> tValue; }
+        for(auto& tValue : tRecord.mDiscreteIntegerVars) { tStream >> tValue; }
+        for(size_t tCriterion = 0; tCriterion < tNumCriteria; tCriterion++)
+        {
+            size_t tGradientLength = 0;
+            tStream >> tRecord.mActiveSet[tCriterion] >> tRecord.mValues[tCriterion] >> tGradientLength;
+            if(!tStream || tGradientLength > tLine.size())
+            {
+                break;
+            }
+            tRecord.mGradients[tCriterion].resize(tGradientLength);
+            for(auto& tValue : tRecord.mGradients[tCriterion]) { tStream >> tValue; }
+        }
+        if(tStream)
+        {
+            this->insertRecord(tRecord);
+        }
+    }
+}
+
+void DakotaEvaluationCache::appendToFile(const dakota::EvaluationRecord& aRecord) const
+{
+    if(mFileName.empty() || !mWriteFile)
+    {
+        return;
+    }
+
+    std::ostringstream tLine;
+    tLine << std::setprecision(std::numeric_limits<double>::max_digits10);
+    tLine << "eval " << aRecord.mContinuousVars.size() << " " << aRecord.mDiscreteRealVars.size() << " "
+          << aRecord.mDiscreteIntegerVars.size() << " " << aRecord.mActiveSet.size();
+    for(auto tValue : aRecord.mContinuousVars) { tLine << " " << tValue; }
+    for(auto tValue : aRecord.mDiscreteRealVars) { tLine << " " << tValue; }
+    for(auto tValue : aRecord.mDiscreteIntegerVars) { tLine << " " << tValue; }
+    for(size_t tCriterion = 0; tCriterion < aRecord.mActiveSet.size(); tCriterion++)
+    {
+        tLine << " " << aRecord.mActiveSet[tCriterion] << " " << aRecord.mValues[tCriterion]
+              << " " << aRecord.mGradients[tCriterion].size();
+        for(auto tValue : aRecord.mGradients[tCriterion]) { tLine << " " << tValue; }
+    }
+
+    // one write per record and a flush, so a killed study loses at most its last line
+    std::ofstream tFile(mFileName, std::ios::app);
+    tFile << tLine.str() << "\n";
+    tFile.flush();
+}
+
+}
+// namespace Plato
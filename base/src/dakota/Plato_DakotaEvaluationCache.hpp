@@ -0,0 +1,136 @@
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+//
+// *************************************************************************
+//@HEADER
+*/
+
+/*
+ * Plato_DakotaEvaluationCache.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+namespace Plato
+{
+
+namespace dakota
+{
+
+/******************************************************************************//**
+ * \struct EvaluationRecord
+ * \brief Variables, active set and responses of one Dakota evaluation.
+**********************************************************************************/
+struct EvaluationRecord
+{
+    std::vector<double> mContinuousVars; /*!< active continuous variables */
+    std::vector<double> mDiscreteRealVars; /*!< active discrete real variables */
+    std::vector<int> mDiscreteIntegerVars; /*!< active discrete integer variables */
+    std::vector<short> mActiveSet; /*!< active set vector, one entry per criterion */
+    std::vector<double> mValues; /*!< criterion values, valid where the active set has the value bit */
+    std::vector<std::vector<double>> mGradients; /*!< criterion gradients, valid where the active set has the gradient bit */
+};
+// struct EvaluationRecord
+
+}
+// namespace dakota
+
+/******************************************************************************//**
+ * \brief Database of evaluated Dakota variable vectors. Records are hashed on the \n
+ *   variables rounded to cells much wider than the tolerance, so revisited and \n
+ *   nearly revisited points share a bucket; candidates are then compared \n
+ *   component-wise. A near point that straddles a cell boundary is simply a miss. \n
+ *   When a file name is given, records are read from it on construction and \n
+ *   appended to it as they are inserted, so a restarted study finds them again.
+**********************************************************************************/
+class DakotaEvaluationCache
+{
+public:
+    /******************************************************************************//**
+     * \brief Constructor
+     * \param [in] aFileName evaluation database file (empty for an in-memory cache)
+     * \param [in] aTolerance absolute tolerance on real variables (zero for exact matches)
+     * \param [in] aWriteFile append new records to the file (false on all but one rank)
+    **********************************************************************************/
+    DakotaEvaluationCache(const std::string& aFileName = "", double aTolerance = 0.0, bool aWriteFile = true);
+
+    /******************************************************************************//**
+     * \brief Find a record with the same variables whose active set covers the query
+     * \param [in] aQuery variables and requested active set
+     * \param [out] aResult cached record
+     * \return true if found
+    **********************************************************************************/
+    bool find(const dakota::EvaluationRecord& aQuery, dakota::EvaluationRecord& aResult) const;
+
+    /******************************************************************************//**
+     * \brief Add a record, merging it with an existing record for the same variables
+     * \param [in] aRecord evaluated record
+    **********************************************************************************/
+    void insert(const dakota::EvaluationRecord& aRecord);
+
+    /******************************************************************************//**
+     * \brief Return number of distinct variable vectors in the cache
+    **********************************************************************************/
+    size_t size() const { return mRecords.size(); }
+
+private:
+    size_t hash(const dakota::EvaluationRecord& aRecord) const;
+    bool sameVariables(const dakota::EvaluationRecord& aRecordOne, const dakota::EvaluationRecord& aRecordTwo) const;
+    bool covers(const dakota::EvaluationRecord& aCached, const dakota::EvaluationRecord& aQuery) const;
+    int findIndex(const dakota::EvaluationRecord& aQuery, size_t aHash) const;
+    void insertRecord(const dakota::EvaluationRecord& aRecord);
+    void readFile();
+    void appendToFile(const dakota::EvaluationRecord& aRecord) const;
+
+private:
+    std::string mFileName; /*!< evaluation database file */
+    double mTolerance; /*!< absolute tolerance on real variables */
+    bool mWriteFile; /*!< append new records to the file */
+    std::vector<dakota::EvaluationRecord> mRecords; /*!< one record per distinct variable vector */
+    std::unordered_multimap<size_t, size_t> mBuckets; /*!< map from hash to record index */
+};
+// class DakotaEvaluationCache
+
+}
+// namespace Plato
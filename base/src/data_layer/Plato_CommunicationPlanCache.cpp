@@ -0,0 +1,224 @@
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+//
+// *************************************************************************
+//@HEADER
+*/
+
+/*
+ * Plato_CommunicationPlanCache.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *
+ */
+
+#include <set>
+#include <sstream>
+#include <algorithm>
+
+#include "Plato_Console.hpp"
+#include "Plato_Communication.hpp"
+#include "Plato_CommunicationPlanCache.hpp"
+
+namespace Plato
+{
+
+namespace
+{
+/// @return Order independent key for a set of performer names.
+std::string namesKey(std::vector<std::string> aNames)
+{
+    std::sort(aNames.begin(), aNames.end());
+    std::stringstream tKey;
+    for(const std::string & tName : aNames)
+    {
+        tKey << tName << ";";
+    }
+    return tKey.str();
+}
+}
+
+/******************************************************************************/
+std::shared_ptr<Plato::SharedFieldPlan>
+buildSharedFieldPlan(const Plato::data::layout_t & aLayout,
+                     const Plato::communication::broadcast_t & aMyBroadcast,
+                     const Plato::CommunicationData & aCommData)
+/******************************************************************************/
+{
+    std::vector<int> tMySendGlobalIDs;
+    std::vector<int> tMyRecvGlobalIDs;
+
+    const auto& tOwnedGIDs = aCommData.mMyOwnedGlobalIDs.at(aLayout);
+    switch(aMyBroadcast)
+    {
+        case Plato::communication::broadcast_t::SENDER_AND_RECEIVER:
+        {
+            tMySendGlobalIDs = tOwnedGIDs;
+            tMyRecvGlobalIDs = tOwnedGIDs;
+            break;
+        }
+        case Plato::communication::broadcast_t::SENDER:
+        {
+            tMySendGlobalIDs = tOwnedGIDs;
+            break;
+        }
+        case Plato::communication::broadcast_t::RECEIVER:
+        {
+            tMyRecvGlobalIDs = tOwnedGIDs;
+            break;
+        }
+        default:
+        case Plato::communication::broadcast_t::UNDEFINED:
+        {
+            // TODO: THROW
+            break;
+        }
+    }
+
+    auto tPlan = std::make_shared<Plato::SharedFieldPlan>();
+    tPlan->mEpetraComm = std::make_shared<Epetra_MpiComm>(aCommData.mInterComm);
+    tPlan->mGlobalIDsProvided = std::make_shared<Epetra_Map>(-1, tMySendGlobalIDs.size(), tMySendGlobalIDs.data(), 0, *tPlan->mEpetraComm);
+    tPlan->mGlobalIDsReceived = std::make_shared<Epetra_Map>(-1, tMyRecvGlobalIDs.size(), tMyRecvGlobalIDs.data(), 0, *tPlan->mEpetraComm);
+    tPlan->mNodeImporter = std::make_shared<Epetra_Import>(*tPlan->mGlobalIDsReceived, *tPlan->mGlobalIDsProvided);
+    return tPlan;
+}
+
+/******************************************************************************/
+void CommunicationPlanCache::validate(const Plato::CommunicationData & aCommData)
+/******************************************************************************/
+{
+    // walk the union of the cached and requested layouts in a rank independent order
+    std::set<Plato::data::layout_t> tLayouts;
+    for(const auto & tOwned : mOwnedGlobalIDs)
+    {
+        tLayouts.insert(tOwned.first);
+    }
+    for(const auto & tOwned : aCommData.mMyOwnedGlobalIDs)
+    {
+        tLayouts.insert(tOwned.first);
+    }
+
+    for(const Plato::data::layout_t & tLayout : tLayouts)
+    {
+        auto tCached = mOwnedGlobalIDs.find(tLayout);
+        auto tRequested = aCommData.mMyOwnedGlobalIDs.find(tLayout);
+        int tMySame = (tCached != mOwnedGlobalIDs.end() &&
+                       tRequested != aCommData.mMyOwnedGlobalIDs.end() &&
+                       tCached->second == tRequested->second) ? 1 : 0;
+        int tSame = 0;
+        MPI_Allreduce(&tMySame, &tSame, 1, MPI_INT, MPI_MIN, aCommData.mInterComm);
+        if(tSame)
+        {
+            continue;
+        }
+
+        // the distribution changed, plans built for this layout are stale
+        for(auto tIterator = mPlans.begin(); tIterator != mPlans.end();)
+        {
+            if(tIterator->first.first == tLayout)
+            {
+                tIterator = mPlans.erase(tIterator);
+            }
+            else
+            {
+                ++tIterator;
+            }
+        }
+        if(tRequested != aCommData.mMyOwnedGlobalIDs.end())
+        {
+            mOwnedGlobalIDs[tLayout] = tRequested->second;
+        }
+        else
+        {
+            mOwnedGlobalIDs.erase(tLayout);
+        }
+    }
+}
+
+/******************************************************************************/
+std::shared_ptr<Plato::SharedFieldPlan>
+CommunicationPlanCache::get(const Plato::data::layout_t & aLayout,
+                            const std::vector<std::string> & aProviderNames,
+                            const std::vector<std::string> & aReceiverNames,
+                            const Plato::communication::broadcast_t & aMyBroadcast,
+                            const Plato::CommunicationData & aCommData)
+/******************************************************************************/
+{
+    mNumRequests++;
+
+    Key tKey(aLayout, namesKey(aProviderNames) + "|" + namesKey(aReceiverNames));
+    auto tIterator = mPlans.find(tKey);
+    if(tIterator != mPlans.end())
+    {
+        return tIterator->second;
+    }
+
+    mNumBuilt++;
+    auto tPlan = Plato::buildSharedFieldPlan(aLayout, aMyBroadcast, aCommData);
+    mPlans[tKey] = tPlan;
+    if(mOwnedGlobalIDs.count(aLayout) == 0)
+    {
+        mOwnedGlobalIDs[aLayout] = aCommData.mMyOwnedGlobalIDs.at(aLayout);
+    }
+    return tPlan;
+}
+
+/******************************************************************************/
+void CommunicationPlanCache::resetStatistics()
+/******************************************************************************/
+{
+    mNumRequests = 0;
+    mNumBuilt = 0;
+}
+
+/******************************************************************************/
+void CommunicationPlanCache::report() const
+/******************************************************************************/
+{
+    if(mNumRequests == 0)
+    {
+        return;
+    }
+    const double tReuseRate = 100.0 * (mNumRequests - mNumBuilt) / mNumRequests;
+    std::stringstream tMsg;
+    tMsg << "Plato::DataLayer: " << mNumRequests << " shared field(s), " << mNumBuilt
+         << " communication plan(s) built, " << tReuseRate << "% reused.";
+    Plato::Console::Status(tMsg.str());
+}
+
+} // namespace Plato
@@ -0,0 +1,151 @@
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+//
+// *************************************************************************
+//@HEADER
+*/
+
+/*
+ * Plato_CommunicationPlanCache.hpp
+ *
+ *  Created on: Oct 17, 2026
+ *
+ */
+
+#ifndef SRC_COMMUNICATIONPLANCACHE_HPP_
+#define SRC_COMMUNICATIONPLANCACHE_HPP_
+
+#include <map>
+#include <string>
+#include <vector>
+#include <memory>
+
+#include <Epetra_MpiComm.h>
+#include <Epetra_Map.h>
+#include <Epetra_Import.h>
+
+#include "Plato_SharedData.hpp"
+#include "Plato_SharedDataInfo.hpp"
+
+namespace Plato
+{
+
+struct CommunicationData;
+
+/******************************************************************************//**
+ * \brief Maps and importer used by a SharedField to move data from providers to
+ * receivers. Fields with the same layout and the same provider/receiver sets can
+ * share one plan.
+**********************************************************************************/
+struct SharedFieldPlan
+{
+    std::shared_ptr<Epetra_MpiComm> mEpetraComm;
+    std::shared_ptr<Epetra_Map> mGlobalIDsProvided;
+    std::shared_ptr<Epetra_Map> mGlobalIDsReceived;
+    std::shared_ptr<Epetra_Import> mNodeImporter;
+};
+
+/******************************************************************************//**
+ * \brief Build the communication plan of a shared field. Collective over the inter-comm.
+ * \param [in] aLayout      data layout
+ * \param [in] aMyBroadcast broadcast type of the local rank
+ * \param [in] aCommData    communication data
+ * \return communication plan
+**********************************************************************************/
+std::shared_ptr<Plato::SharedFieldPlan>
+buildSharedFieldPlan(const Plato::data::layout_t & aLayout,
+                     const Plato::communication::broadcast_t & aMyBroadcast,
+                     const Plato::CommunicationData & aCommData);
+
+/******************************************************************************//**
+ * \brief Cache of shared field communication plans keyed by (layout, provider set,
+ * receiver set). Owned by Plato::DataLayer and handed on when the shared data is
+ * recreated, so plans survive 'Update Shared Data' if the owned global IDs did not
+ * change.
+**********************************************************************************/
+class CommunicationPlanCache
+{
+public:
+    CommunicationPlanCache() = default;
+
+    /******************************************************************************//**
+     * \brief Drop plans built from owned global IDs that differ from the ones in
+     * aCommData. Collective over the inter-comm.
+     * \param [in] aCommData communication data
+    **********************************************************************************/
+    void validate(const Plato::CommunicationData & aCommData);
+
+    /******************************************************************************//**
+     * \brief Return the plan for a shared field, building it on a miss. Collective
+     * over the inter-comm on a miss; every rank requests plans in the same order.
+     * \param [in] aLayout        data layout
+     * \param [in] aProviderNames names of the providing performers
+     * \param [in] aReceiverNames names of the receiving performers
+     * \param [in] aMyBroadcast   broadcast type of the local rank
+     * \param [in] aCommData      communication data
+     * \return communication plan
+    **********************************************************************************/
+    std::shared_ptr<Plato::SharedFieldPlan>
+    get(const Plato::data::layout_t & aLayout,
+        const std::vector<std::string> & aProviderNames,
+        const std::vector<std::string> & aReceiverNames,
+        const Plato::communication::broadcast_t & aMyBroadcast,
+        const Plato::CommunicationData & aCommData);
+
+    int getNumRequests() const { return mNumRequests; }
+    int getNumBuilt() const { return mNumBuilt; }
+    void resetStatistics();
+
+    /******************************************************************************//**
+     * \brief Report plan reuse on the console
+    **********************************************************************************/
+    void report() const;
+
+private:
+    typedef std::pair<Plato::data::layout_t, std::string> Key;
+
+    std::map<Key, std::shared_ptr<Plato::SharedFieldPlan>> mPlans;
+    std::map<Plato::data::layout_t, std::vector<int>> mOwnedGlobalIDs;
+
+    int mNumRequests = 0;
+    int mNumBuilt = 0;
+};
+
+} // namespace Plato
+
+#endif
@@ -53,23 +53,32 @@
 // 6.  Ndof SharedField
 #include <cstdlib>
 #include <stdlib.h>
+#include <sstream>
 
+#include "Plato_Console.hpp"
 #include "Plato_Interface.hpp"
 #include "Plato_SharedField.hpp"
 #include "Plato_SharedValue.hpp"
 #include "Plato_Exceptions.hpp"
 #include "Plato_Communication.hpp"
 #include "Plato_SharedDataInfo.hpp"
+#include "Plato_CommunicationPlanCache.hpp"
 
 namespace Plato
 {
 
 /******************************************************************************/
-DataLayer::DataLayer(const Plato::SharedDataInfo & aSharedDataInfo, const Plato::CommunicationData & aCommData) :
+DataLayer::DataLayer(const Plato::SharedDataInfo & aSharedDataInfo,
+                     const Plato::CommunicationData & aCommData,
+                     std::shared_ptr<Plato::CommunicationPlanCache> aPlanCache) :
         mSharedData(),
-        mSharedDataMap()
+        mSharedDataMap(),
+        mPlanCache(aPlanCache ? aPlanCache : std::make_shared<Plato::CommunicationPlanCache>())
 /******************************************************************************/
 {
+    mPlanCache->resetStatistics();
+    mPlanCache->validate(aCommData);
+
     // create the shared fields
     //
     const int tNumSharedData = aSharedDataInfo.getNumSharedData();
@@ -79,16 +88,17 @@ DataLayer::DataLayer(const Plato::SharedDataInfo & aSharedDataInfo, const Plato:
         std::string tMyLayout = aSharedDataInfo.getSharedDataLayout(tIndex);
 
         SharedData* tNewData = nullptr;
-        if(tMyLayout == "NODAL FIELD" )
-        {
-            const Plato::communication::broadcast_t tBroadcastType = aSharedDataInfo.getMyBroadcast(tIndex);
-            tNewData = new Plato::SharedField(tMyName, tBroadcastType, aCommData,  Plato::data::layout_t::SCALAR_FIELD);
-        }
-        else
-        if(tMyLayout == "ELEMENT FIELD")
+        if(tMyLayout == "NODAL FIELD" || tMyLayout == "ELEMENT FIELD")
         {
+            const Plato::data::layout_t tLayout = tMyLayout == "NODAL FIELD" ?
+                    Plato::data::layout_t::SCALAR_FIELD : Plato::data::layout_t::ELEMENT_FIELD;
             const Plato::communication::broadcast_t tBroadcastType = aSharedDataInfo.getMyBroadcast(tIndex);
-            tNewData = new Plato::SharedField(tMyName, tBroadcastType, aCommData, Plato::data::layout_t::ELEMENT_FIELD);
+            auto tPlan = mPlanCache->get(tLayout,
+                                         aSharedDataInfo.getProviderNames(tIndex),
+                                         aSharedDataInfo.getReceiverNames(tIndex),
+                                         tBroadcastType,
+                                         aCommData);
+            tNewData = new Plato::SharedField(tMyName, tBroadcastType, tPlan, tLayout);
         }
         else
         if(tMyLayout == "GLOBAL")
@@ -110,6 +120,8 @@ DataLayer::DataLayer(const Plato::SharedDataInfo & aSharedDataInfo, const Plato:
         mSharedData.push_back(tNewData);
         mSharedDataMap[tMyName] = tNewData;
     }
+
+    mPlanCache->report();
 }
 
 /******************************************************************************/
@@ -148,6 +160,30 @@ const std::vector<SharedData*> & DataLayer::getSharedData() const
     return mSharedData;
 }
 
+/******************************************************************************/
+std::shared_ptr<Plato::CommunicationPlanCache> DataLayer::getCommunicationPlanCache() const
+/******************************************************************************/
+{
+    return mPlanCache;
+}
+
+/******************************************************************************/
+void DataLayer::reportTransmissions() const
+/******************************************************************************/
+{
+    const Plato::TransmissionStatistics & tStatistics = SharedData::getTransmissionStatistics();
+    const long long tNumTransmits = tStatistics.mNumMoved + tStatistics.mNumSkipped;
+    if(tNumTransmits == 0)
+    {
+        return;
+    }
+    std::stringstream tMsg;
+    tMsg << "Plato::DataLayer: " << tNumTransmits << " shared data transmit(s), " << tStatistics.mNumSkipped
+         << " skipped as unchanged. " << tStatistics.mBytesMoved << " bytes moved, " << tStatistics.mBytesSkipped
+         << " bytes skipped on this rank.";
+    Plato::Console::Status(tMsg.str());
+}
+
 /******************************************************************************/
 void DataLayer::initializeMPI(const Plato::CommunicationData& aCommData)
 /******************************************************************************/
@@ -56,10 +56,12 @@
 #include <map>
 #include <vector>
 #include <string>
+#include <memory>
 
 namespace Plato
 {
 class SharedDataInfo;
+class CommunicationPlanCache;
 struct CommunicationData;
 
 /******************************************************************************/
@@ -71,12 +73,20 @@ class DataLayer
 {
 public:
     DataLayer() = default;
-    DataLayer(const Plato::SharedDataInfo & aSharedDataInfo, const Plato::CommunicationData & aCommData);
+    /// @param aPlanCache Shared field communication plans from a previous DataLayer.
+    /// Plans whose owned global IDs are unchanged are reused. A new cache is created if null.
+    DataLayer(const Plato::SharedDataInfo & aSharedDataInfo,
+              const Plato::CommunicationData & aCommData,
+              std::shared_ptr<Plato::CommunicationPlanCache> aPlanCache = nullptr);
     ~DataLayer();
 
     // accessors
     SharedData* getSharedData(const std::string & aName) const;
     const std::vector<SharedData*> & getSharedData() const;
+    std::shared_ptr<Plato::CommunicationPlanCache> getCommunicationPlanCache() const;
+
+    /// Report the shared data bytes moved and skipped by this rank since the start of the run
+    void reportTransmissions() const;
 
     template<typename Archive>
     void serialize(Archive& aArchive, const unsigned int aVersion)
@@ -88,6 +98,7 @@ public:
 private:
     std::vector<SharedData*> mSharedData;
     std::map<std::string, SharedData*> mSharedDataMap;
+    std::shared_ptr<Plato::CommunicationPlanCache> mPlanCache;
 
 private:
     DataLayer(const Plato::DataLayer & aRhs);
@@ -53,6 +53,7 @@
 #include <string>
 #include <vector>
 #include <cassert>
+#include <algorithm>
 
 namespace Plato
 {
@@ -82,6 +83,18 @@ struct data
     };
 };
 
+/******************************************************************************//**
+ * \brief Shared data transfers seen by this rank since the start of the run. Bytes
+ * are counted on the receiving side of each transfer.
+**********************************************************************************/
+struct TransmissionStatistics
+{
+    long long mNumMoved = 0;
+    long long mNumSkipped = 0;
+    long long mBytesMoved = 0;
+    long long mBytesSkipped = 0;
+};
+
 /******************************************************************************//**
  * \brief Shared Data abstract class
 **********************************************************************************/
@@ -119,6 +132,18 @@ public:
     **********************************************************************************/
     virtual void transmitData() = 0;
 
+    /******************************************************************************//**
+     * \brief Post the transmission of data from owner application to user application.
+     * The data must not be accessed until endTransmitData() is called. The default
+     * implementation performs a blocking transmit.
+    **********************************************************************************/
+    virtual void beginTransmitData() { this->transmitData(); }
+
+    /******************************************************************************//**
+     * \brief Complete a transmission posted with beginTransmitData()
+    **********************************************************************************/
+    virtual void endTransmitData() {}
+
     /******************************************************************************//**
      * \brief Set SharedData container values
      * \param [in] aData standard vector
@@ -131,10 +156,86 @@ public:
     **********************************************************************************/
     virtual void getData(std::vector<double> & aData) const = 0;
 
+    /******************************************************************************//**
+     * \brief Borrow the buffer sent by transmitData(). The buffer holds size() values
+     * and is owned by the SharedData. Borrowing counts as a write, so the next transmit
+     * sends the buffer; use copyToSendBuffer() to only send values that changed.
+     * \return pointer to the send buffer, nullptr if the SharedData does not expose it
+    **********************************************************************************/
+    double* getSendBuffer()
+    {
+        double* tSendBuffer = this->sendBuffer();
+        if(tSendBuffer != nullptr)
+        {
+            mVersion++;
+        }
+        return tSendBuffer;
+    }
+
+    /******************************************************************************//**
+     * \brief Borrow the buffer filled by transmitData(). The buffer holds size() values
+     * and is owned by the SharedData.
+     * \return pointer to the receive buffer, nullptr if the SharedData does not expose it
+    **********************************************************************************/
+    virtual const double* getRecvBuffer() const { return nullptr; }
+
+    /******************************************************************************//**
+     * \brief Copy size() values into the send buffer. The version only changes if a
+     * value differs from the one already in the buffer.
+     * \param [in] aData values to send
+     * \return false if the SharedData does not expose a send buffer
+    **********************************************************************************/
+    bool copyToSendBuffer(const double* aData)
+    {
+        double* tSendBuffer = this->sendBuffer();
+        if(tSendBuffer == nullptr)
+        {
+            return false;
+        }
+        const int tLength = this->size();
+        if(std::equal(aData, aData + tLength, tSendBuffer) == false)
+        {
+            std::copy(aData, aData + tLength, tSendBuffer);
+            mVersion++;
+        }
+        return true;
+    }
+
+    /******************************************************************************//**
+     * \brief Return the write version. The version is bumped by every write to the
+     * local send data, so transmits can skip transfers of unchanged data.
+     * \return write version
+    **********************************************************************************/
+    unsigned long long getVersion() const { return mVersion; }
+
+    /******************************************************************************//**
+     * \brief Mark the local send data as changed
+    **********************************************************************************/
+    void incrementVersion() { mVersion++; }
+
+    /******************************************************************************//**
+     * \brief Return the transfers moved and skipped by this rank, summed over all
+     * shared data
+    **********************************************************************************/
+    static Plato::TransmissionStatistics & getTransmissionStatistics()
+    {
+        static Plato::TransmissionStatistics tStatistics;
+        return tStatistics;
+    }
+
     template<class Archive>
     void serialize(Archive & aArchive, const unsigned int version){};
 
     virtual void initializeMPI(const Plato::CommunicationData& aCommData){}
+
+protected:
+    /******************************************************************************//**
+     * \brief Return the send buffer without changing the version
+     * \return pointer to the send buffer, nullptr if the SharedData does not expose it
+    **********************************************************************************/
+    virtual double* sendBuffer() { return nullptr; }
+
+    unsigned long long mVersion = 0;
 };
 // class SharedData
 
@@ -0,0 +1,206 @@
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+//
+// *************************************************************************
+//@HEADER
+*/
+
+/*
+ * Plato_SharedDataBatch.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *
+ */
+
+#include <algorithm>
+
+#include "Plato_SharedField.hpp"
+#include "Plato_SharedDataBatch.hpp"
+
+namespace Plato
+{
+
+/******************************************************************************/
+void SharedDataBatch::initialize(const std::vector<Plato::SharedData*> & aSharedData)
+/******************************************************************************/
+{
+    this->clear();
+
+    for(Plato::SharedData* tSharedData : aSharedData)
+    {
+        Plato::SharedField* tField = dynamic_cast<Plato::SharedField*>(tSharedData);
+        if(tField == nullptr)
+        {
+            mValues.push_back(tSharedData);
+            continue;
+        }
+
+        // group fields that can share one import. the comparison is collective,
+        // so every rank must walk the groups in the same order.
+        bool tFoundGroup = false;
+        for(FieldGroup & tGroup : mFieldGroups)
+        {
+            if(tGroup.mFields.front()->hasSameCommunicationPlan(*tField))
+            {
+                tGroup.mFields.push_back(tField);
+                tFoundGroup = true;
+                break;
+            }
+        }
+        if(tFoundGroup == false)
+        {
+            mFieldGroups.push_back(FieldGroup());
+            mFieldGroups.back().mFields.push_back(tField);
+        }
+    }
+
+    // preallocate the packed buffers once
+    for(FieldGroup & tGroup : mFieldGroups)
+    {
+        const int tNumVectors = tGroup.mFields.size();
+        if(tNumVectors > 1)
+        {
+            Plato::SharedField* tFirst = tGroup.mFields.front();
+            tGroup.mSendData = std::make_shared<Epetra_MultiVector>(tFirst->getSendVector().Map(), tNumVectors);
+            tGroup.mRecvData = std::make_shared<Epetra_MultiVector>(tFirst->getRecvVector().Map(), tNumVectors);
+        }
+    }
+}
+
+/******************************************************************************/
+void SharedDataBatch::post()
+/******************************************************************************/
+{
+    // scalar values go first so that their collectives progress during the imports
+    for(Plato::SharedData* tValue : mValues)
+    {
+        tValue->beginTransmitData();
+        mPending[tValue->myName()] = tValue;
+    }
+
+    // one version check for all fields of the batch
+    std::vector<Plato::SharedData*> tFields;
+    for(FieldGroup & tGroup : mFieldGroups)
+    {
+        tFields.insert(tFields.end(), tGroup.mFields.begin(), tGroup.mFields.end());
+    }
+    Plato::SharedField::skipUnchangedTransfers(tFields);
+
+    for(FieldGroup & tGroup : mFieldGroups)
+    {
+        this->transmit(tGroup);
+    }
+}
+
+/******************************************************************************/
+void SharedDataBatch::transmit(FieldGroup & aGroup)
+/******************************************************************************/
+{
+    if(aGroup.mFields.size() == 1u)
+    {
+        aGroup.mFields.front()->transmitData();
+        return;
+    }
+
+    // the packed import moves every field of the group unless all are unchanged
+    const int tNumVectors = aGroup.mFields.size();
+    bool tAllSkipped = std::all_of(aGroup.mFields.begin(), aGroup.mFields.end(),
+                                   [](const Plato::SharedField* aField){ return aField->isTransferSkipped(); });
+    if(tAllSkipped)
+    {
+        for(Plato::SharedField* tField : aGroup.mFields)
+        {
+            tField->recordTransfer(false);
+        }
+        return;
+    }
+
+    for(int tIndex = 0; tIndex < tNumVectors; tIndex++)
+    {
+        const Epetra_Vector & tSend = aGroup.mFields[tIndex]->getSendVector();
+        std::copy(tSend.Values(), tSend.Values() + tSend.MyLength(), (*aGroup.mSendData)[tIndex]);
+    }
+
+    aGroup.mRecvData->PutScalar(0.0);
+    aGroup.mRecvData->Import(*aGroup.mSendData, aGroup.mFields.front()->getImporter(), Insert);
+
+    for(int tIndex = 0; tIndex < tNumVectors; tIndex++)
+    {
+        Epetra_Vector & tRecv = aGroup.mFields[tIndex]->getRecvVector();
+        const double* tPacked = (*aGroup.mRecvData)[tIndex];
+        std::copy(tPacked, tPacked + tRecv.MyLength(), tRecv.Values());
+        aGroup.mFields[tIndex]->recordTransfer(true);
+    }
+}
+
+/******************************************************************************/
+void SharedDataBatch::wait(const std::vector<std::string> & aNames)
+/******************************************************************************/
+{
+    for(const std::string & tName : aNames)
+    {
+        auto tIterator = mPending.find(tName);
+        if(tIterator != mPending.end())
+        {
+            tIterator->second->endTransmitData();
+            mPending.erase(tIterator);
+        }
+    }
+}
+
+/******************************************************************************/
+void SharedDataBatch::waitAll()
+/******************************************************************************/
+{
+    for(auto & tPending : mPending)
+    {
+        tPending.second->endTransmitData();
+    }
+    mPending.clear();
+}
+
+/******************************************************************************/
+void SharedDataBatch::clear()
+/******************************************************************************/
+{
+    this->waitAll();
+    mValues.clear();
+    mFieldGroups.clear();
+}
+
+} // End namespace Plato
@@ -0,0 +1,120 @@
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+//
+// *************************************************************************
+//@HEADER
+*/
+
+/*
+ * Plato_SharedDataBatch.hpp
+ *
+ *  Created on: Oct 17, 2026
+ *
+ */
+
+#ifndef SRC_SHAREDDATABATCH_HPP_
+#define SRC_SHAREDDATABATCH_HPP_
+
+#include <map>
+#include <string>
+#include <vector>
+#include <memory>
+
+#include <Epetra_MultiVector.h>
+
+#include "Plato_SharedData.hpp"
+
+namespace Plato
+{
+
+class SharedField;
+
+/******************************************************************************//**
+ * \brief Transmits a set of shared data as one batch. Scalar values are posted as
+ * non-blocking collectives and shared fields with identical communication plans
+ * are packed into a single multi-vector import. Individual data can be waited on
+ * so that work that does not depend on pending transfers can proceed.
+**********************************************************************************/
+class SharedDataBatch
+{
+public:
+    SharedDataBatch() = default;
+
+    /******************************************************************************//**
+     * \brief Build the batch. Collective over the inter-comm.
+     * \param [in] aSharedData shared data transmitted by the batch
+    **********************************************************************************/
+    void initialize(const std::vector<Plato::SharedData*> & aSharedData);
+
+    /******************************************************************************//**
+     * \brief Post the transmission of all shared data in the batch
+    **********************************************************************************/
+    void post();
+
+    /******************************************************************************//**
+     * \brief Wait on the pending transmission of the named shared data, if any
+     * \param [in] aNames shared data names
+    **********************************************************************************/
+    void wait(const std::vector<std::string> & aNames);
+
+    /******************************************************************************//**
+     * \brief Wait on all pending transmissions
+    **********************************************************************************/
+    void waitAll();
+
+    void clear();
+
+private:
+    struct FieldGroup
+    {
+        std::vector<Plato::SharedField*> mFields;
+        std::shared_ptr<Epetra_MultiVector> mSendData;
+        std::shared_ptr<Epetra_MultiVector> mRecvData;
+    };
+
+    void transmit(FieldGroup & aGroup);
+
+private:
+    std::vector<Plato::SharedData*> mValues;
+    std::vector<FieldGroup> mFieldGroups;
+    std::map<std::string, Plato::SharedData*> mPending;
+};
+
+} // End namespace Plato
+
+#endif
@@ -131,6 +131,7 @@ void SharedField::setData(const std::vector<double> & aData)
     {
         tMyDataView[tIndex] = aData[tIndex];
     }
+    mVersion++;
 }
 
 /******************************************************************************/
@@ -163,6 +164,7 @@ void SharedField::setData(const double & aDataVal, const int & aGlobalIndex)
     if(tLocalID >= 0)
     {
         (*mSendDataVector)[tLocalID] = aDataVal;
+        mVersion++;
     }
 }
 
@@ -181,6 +183,22 @@ void SharedField::getData(double & aDataVal, const int & aGlobalIndex) const
     }
 }
 
+/******************************************************************************/
+double* SharedField::sendBuffer()
+/******************************************************************************/
+{
+    assert(mSendDataVector.get() != nullptr);
+    return mSendDataVector->Values();
+}
+
+/******************************************************************************/
+const double* SharedField::getRecvBuffer() const
+/******************************************************************************/
+{
+    assert(mRecvDataVector.get() != nullptr);
+    return mRecvDataVector->Values();
+}
+
 /******************************************************************************/
 void SharedField::transmitData()
 /******************************************************************************/
@@ -189,61 +207,161 @@ void SharedField::transmitData()
     assert(mRecvDataVector.get() != nullptr);
     assert(mSendDataVector.get() != nullptr);
 
+    // set for every rank by skipUnchangedTransfers
+    if(mSkipNextTransfer)
+    {
+        this->recordTransfer(false);
+        return;
+    }
+
     mRecvDataVector->PutScalar(0.0);
     mRecvDataVector->Import(*mSendDataVector, *mNodeImporter, Insert);
+    this->recordTransfer(true);
 }
 
 /******************************************************************************/
-void SharedField::initialize(const Plato::CommunicationData & aCommData)
+void SharedField::skipUnchangedTransfers(const std::vector<Plato::SharedData*> & aSharedData)
 /******************************************************************************/
 {
-    std::vector<int> tMySendGlobalIDs;
-    std::vector<int> tMyRecvGlobalIDs;
-
-    const auto& ownedGIDs = aCommData.mMyOwnedGlobalIDs.at(mMyLayout);
-    auto begin = ownedGIDs.begin();
-    auto end   = ownedGIDs.end();
-    auto size  = ownedGIDs.size();
-
-    switch(mMyBroadcast)
+    std::vector<Plato::SharedField*> tFields;
+    for(Plato::SharedData* tSharedData : aSharedData)
     {
-        case Plato::communication::broadcast_t::SENDER_AND_RECEIVER:
+        Plato::SharedField* tField = dynamic_cast<Plato::SharedField*>(tSharedData);
+        if(tField != nullptr)
         {
-            tMySendGlobalIDs.resize(size);
-            tMyRecvGlobalIDs.resize(size);
-            std::copy(begin, end, tMySendGlobalIDs.begin());
-            std::copy(begin, end, tMyRecvGlobalIDs.begin());
-            break;
-        }
-        case Plato::communication::broadcast_t::SENDER:
-        {
-            tMySendGlobalIDs.resize(size);
-            std::copy(begin, end, tMySendGlobalIDs.begin());
-            break;
-        }
-        case Plato::communication::broadcast_t::RECEIVER:
-        {
-            tMyRecvGlobalIDs.resize(size);
-            std::copy(begin, end, tMyRecvGlobalIDs.begin());
-            break;
-        }
-        default:
-        case Plato::communication::broadcast_t::UNDEFINED:
-        {
-            // TODO: THROW
-            break;
+            tFields.push_back(tField);
         }
     }
+    if(tFields.empty())
+    {
+        return;
+    }
+
+    // imports are collective, so every rank must skip the same fields
+    const int tNumFields = tFields.size();
+    std::vector<int> tMyHasChanges(tNumFields, 0);
+    for(int tIndex = 0; tIndex < tNumFields; tIndex++)
+    {
+        tMyHasChanges[tIndex] = tFields[tIndex]->hasLocalChanges() ? 1 : 0;
+    }
+    std::vector<int> tHasChanges(tNumFields, 0);
+    tFields.front()->getImporter().SourceMap().Comm().MaxAll(tMyHasChanges.data(), tHasChanges.data(), tNumFields);
+
+    for(int tIndex = 0; tIndex < tNumFields; tIndex++)
+    {
+        tFields[tIndex]->mSkipNextTransfer = (tHasChanges[tIndex] == 0);
+    }
+}
+
+/******************************************************************************/
+bool SharedField::isTransferSkipped() const
+/******************************************************************************/
+{
+    return mSkipNextTransfer;
+}
 
-    mGlobalIDsProvided = std::make_shared<Epetra_Map>(-1, tMySendGlobalIDs.size(), tMySendGlobalIDs.data(), 0, *mEpetraComm);
-    mGlobalIDsReceived = std::make_shared<Epetra_Map>(-1, tMyRecvGlobalIDs.size(), tMyRecvGlobalIDs.data(), 0, *mEpetraComm);
+/******************************************************************************/
+bool SharedField::hasLocalChanges() const
+/******************************************************************************/
+{
+    return (mHasTransmitted == false || mVersion != mTransmittedVersion);
+}
 
-    mNodeImporter = std::make_shared<Epetra_Import>(*mGlobalIDsReceived, *mGlobalIDsProvided);
+/******************************************************************************/
+void SharedField::recordTransfer(bool aMoved)
+/******************************************************************************/
+{
+    assert(mRecvDataVector.get() != nullptr);
+    Plato::TransmissionStatistics & tStatistics = SharedData::getTransmissionStatistics();
+    const long long tBytes = static_cast<long long>(mRecvDataVector->MyLength()) * sizeof(double);
+    mSkipNextTransfer = false;
+    if(aMoved)
+    {
+        mHasTransmitted = true;
+        mTransmittedVersion = mVersion;
+        mImportedVersion++;
+        tStatistics.mNumMoved++;
+        tStatistics.mBytesMoved += tBytes;
+    }
+    else
+    {
+        tStatistics.mNumSkipped++;
+        tStatistics.mBytesSkipped += tBytes;
+    }
+}
+
+/******************************************************************************/
+unsigned long long SharedField::getImportedVersion() const
+/******************************************************************************/
+{
+    return mImportedVersion;
+}
+
+/******************************************************************************/
+bool SharedField::hasSameCommunicationPlan(const SharedField & aOther) const
+/******************************************************************************/
+{
+    // fields built from one cached plan share it on every rank
+    if(mNodeImporter == aOther.mNodeImporter)
+    {
+        return true;
+    }
+
+    // Epetra_BlockMap::SameAs is collective over the inter-comm
+    assert(mGlobalIDsProvided.get() != nullptr);
+    assert(mGlobalIDsReceived.get() != nullptr);
+    bool tSameProvided = mGlobalIDsProvided->SameAs(*aOther.mGlobalIDsProvided);
+    bool tSameReceived = mGlobalIDsReceived->SameAs(*aOther.mGlobalIDsReceived);
+    return (tSameProvided && tSameReceived);
+}
+
+/******************************************************************************/
+const Epetra_Import & SharedField::getImporter() const
+/******************************************************************************/
+{
+    assert(mNodeImporter.get() != nullptr);
+    return *mNodeImporter;
+}
+
+/******************************************************************************/
+Epetra_Vector & SharedField::getSendVector()
+/******************************************************************************/
+{
+    assert(mSendDataVector.get() != nullptr);
+    return *mSendDataVector;
+}
+
+/******************************************************************************/
+Epetra_Vector & SharedField::getRecvVector()
+/******************************************************************************/
+{
+    assert(mRecvDataVector.get() != nullptr);
+    return *mRecvDataVector;
+}
+
+/******************************************************************************/
+void SharedField::initialize(const Plato::CommunicationData & aCommData)
+/******************************************************************************/
+{
+    this->initialize(Plato::buildSharedFieldPlan(mMyLayout, mMyBroadcast, aCommData));
+}
+
+/******************************************************************************/
+void SharedField::initialize(const std::shared_ptr<Plato::SharedFieldPlan> & aPlan)
+/******************************************************************************/
+{
+    assert(aPlan.get() != nullptr);
+    mEpetraComm = aPlan->mEpetraComm;
+    mGlobalIDsProvided = aPlan->mGlobalIDsProvided;
+    mGlobalIDsReceived = aPlan->mGlobalIDsReceived;
+    mNodeImporter = aPlan->mNodeImporter;
 
     mSendDataVector = std::make_shared<Epetra_Vector>(*mGlobalIDsProvided);
     mSendDataVector->PutScalar(0.0);
     mRecvDataVector = std::make_shared<Epetra_Vector>(*mGlobalIDsReceived);
     mRecvDataVector->PutScalar(0.0);
+
+    mHasTransmitted = false;
 }
 
 /*****************************************************************************/
@@ -255,7 +373,7 @@ SharedField::SharedField(const std::string & aMyName,
         mMyName(aMyName),
         mMyLayout(aMyLayout),
         mMyBroadcast(aMyBroadcast),
-        mEpetraComm(std::make_shared<Epetra_MpiComm>(aCommData.mInterComm)),
+        mEpetraComm(nullptr),
         mGlobalIDsProvided(nullptr),
         mGlobalIDsReceived(nullptr),
         mNodeImporter(nullptr),
@@ -270,11 +388,30 @@ SharedField::SharedField(const std::string & aMyName,
     this->initialize(aCommData);
 }
 
+/*****************************************************************************/
+SharedField::SharedField(const std::string & aMyName,
+                         const Plato::communication::broadcast_t & aMyBroadcast,
+                         const std::shared_ptr<Plato::SharedFieldPlan> & aPlan,
+                         Plato::data::layout_t aMyLayout) :
+        SharedData(),
+        mMyName(aMyName),
+        mMyLayout(aMyLayout),
+        mMyBroadcast(aMyBroadcast),
+        mEpetraComm(nullptr),
+        mGlobalIDsProvided(nullptr),
+        mGlobalIDsReceived(nullptr),
+        mNodeImporter(nullptr),
+        mSendDataVector(nullptr),
+        mRecvDataVector(nullptr)
+/*****************************************************************************/
+{
+    this->initialize(aPlan);
+}
+
 /*****************************************************************************/
 void SharedField::initializeMPI(const Plato::CommunicationData& aCommData)
 /*****************************************************************************/
 {
-    mEpetraComm = std::make_shared<Epetra_MpiComm>(aCommData.mInterComm);
     initialize(aCommData);
 }
 
@@ -62,6 +62,7 @@
 #include "Plato_SharedData.hpp"
 #include "Plato_Communication.hpp"
 #include "Plato_SharedDataInfo.hpp"
+#include "Plato_CommunicationPlanCache.hpp"
 
 #include "Plato_SerializationHeaders.hpp"
 
@@ -79,6 +80,12 @@ public:
                 const Plato::communication::broadcast_t & aMyBroadcast,
                 const Plato::CommunicationData & aCommData,
                 Plato::data::layout_t aMyLayout);
+    /// Construct a field on a communication plan shared with other fields,
+    /// see Plato::CommunicationPlanCache.
+    SharedField(const std::string & aMyName,
+                const Plato::communication::broadcast_t & aMyBroadcast,
+                const std::shared_ptr<Plato::SharedFieldPlan> & aPlan,
+                Plato::data::layout_t aMyLayout);
 
     int size() const;
     std::string myName() const;
@@ -92,6 +99,28 @@ public:
     void setData(const double & aDataVal, const int & aGlobalIndex);
     void getData(double & dataVal, const int & aGlobalIndex) const;
 
+    const double* getRecvBuffer() const override;
+
+    /// Number of transfers that moved data into the receive buffer. Identical on every
+    /// rank; a receiver holds the data of this transfer.
+    unsigned long long getImportedVersion() const;
+
+    // access to the communication plan, used to pack several fields into one import.
+    // the send and receive vectors are accessed without bumping the version.
+    bool hasSameCommunicationPlan(const SharedField & aOther) const;
+    const Epetra_Import & getImporter() const;
+    Epetra_Vector & getSendVector();
+    Epetra_Vector & getRecvVector();
+
+    /// Decide with one reduction which of the fields in @a aSharedData no rank changed
+    /// since their last transfer; their next transfer is skipped. Collective over the
+    /// inter-comm shared by the fields, entries that are not fields are ignored.
+    static void skipUnchangedTransfers(const std::vector<Plato::SharedData*> & aSharedData);
+
+    // version bookkeeping, used by transfers that bypass transmitData()
+    bool isTransferSkipped() const;
+    void recordTransfer(bool aMoved);
+
     friend class boost::serialization::access;
     template<class Archive>
     void serialize(Archive & aArchive, const unsigned int version)
@@ -102,8 +131,12 @@ public:
         aArchive & boost::serialization::make_nvp("Broadcast",mMyBroadcast);
     }
     void initializeMPI(const Plato::CommunicationData& aCommData) override;
+protected:
+    double* sendBuffer() override;
 private:
     void initialize(const Plato::CommunicationData & aCommData);
+    void initialize(const std::shared_ptr<Plato::SharedFieldPlan> & aPlan);
+    bool hasLocalChanges() const;
 
 private:
     std::string mMyName;
@@ -119,6 +152,11 @@ private:
     std::shared_ptr<Epetra_Vector> mSendDataVector;
     std::shared_ptr<Epetra_Vector> mRecvDataVector;
 
+    bool mHasTransmitted = false;
+    bool mSkipNextTransfer = false;
+    unsigned long long mTransmittedVersion = 0;
+    unsigned long long mImportedVersion = 0;
+
 private:
     SharedField(const SharedField& aRhs);
     SharedField& operator=(const SharedField& aRhs);
@@ -53,6 +53,8 @@
 #include "Plato_SharedValue.hpp"
 #include "Plato_Communication.hpp"
 
+#include <algorithm>
+
 #include <boost/archive/xml_oarchive.hpp>
 #include <boost/archive/xml_iarchive.hpp>
 BOOST_CLASS_EXPORT_IMPLEMENT(Plato::SharedValue)
@@ -64,80 +66,103 @@ namespace Plato
 void SharedValue::transmitData()
 /******************************************************************************/
 {
-    int tMyProcID = -1;
-    MPI_Comm_rank(mMyComm, &tMyProcID);
+    this->beginTransmitData();
+    this->endTransmitData();
+}
+
+/******************************************************************************/
+void SharedValue::beginTransmitData()
+/******************************************************************************/
+{
+    // values are a few doubles, so a version check would cost as much as the transfer
+    Plato::TransmissionStatistics & tStatistics = SharedData::getTransmissionStatistics();
+    tStatistics.mNumMoved++;
+    tStatistics.mBytesMoved += static_cast<long long>(mData.size()) * sizeof(double);
 
     if( mProviderNames.size() == 1 )
     { // single provider
-        int tGlobalProcID = -1;
-        bool tIsProvider = mLocalCommName == mProviderNames[0];
-        if(tMyProcID == 0 && tIsProvider)
-        {
-            MPI_Comm_rank(mInterComm, &tGlobalProcID);
-        }
-        // determine provider procID
-        int tSenderProcID = -1;
-        MPI_Allreduce(&tGlobalProcID, &tSenderProcID, 1, MPI_INT, MPI_MAX, mInterComm);
-
         if( mIsDynamic )
         {
             int tNumData = mData.size();
-            MPI_Bcast(&tNumData, 1, MPI_INT, tSenderProcID, mInterComm);
+            MPI_Bcast(&tNumData, 1, MPI_INT, mSenderProcID, mInterComm);
             mData.resize(tNumData);
             mNumData = tNumData;
         }
-        auto tRecv(mData);
-        MPI_Bcast(tRecv.data(), tRecv.size(), MPI_DOUBLE, tSenderProcID, mInterComm);
-        if( !tIsProvider ){
-            mData = tRecv;
+
+        // providers keep their local values, so only non-providers receive in place
+        if( mIsProvider )
+        {
+            mRecvBuffer = mData;
+            MPI_Ibcast(mRecvBuffer.data(), mRecvBuffer.size(), MPI_DOUBLE, mSenderProcID, mInterComm, &mRequest);
+        }
+        else
+        {
+            MPI_Ibcast(mData.data(), mData.size(), MPI_DOUBLE, mSenderProcID, mInterComm, &mRequest);
         }
     }
     else 
     { // multiple provider
-    
-        // reduce data from all rank zeros of all provider local comms.
-        //
-
-        // determine if local rank is a provider
-        bool tIsaProvider = 
-         ( std::find( mProviderNames.begin(), 
-                      mProviderNames.end(), 
-                      mLocalCommName ) != mProviderNames.end() );
-        int tProviderColor = (tMyProcID == 0 && tIsaProvider) ? 1 : 0;
-    
-        // create temporary comm for reducing from multiple providers
-        int tGlobalProcID = -1;
-        MPI_Comm_rank(mInterComm, &tGlobalProcID);
-        MPI_Comm tReductionComm;
-        MPI_Comm_split(mInterComm, tProviderColor, tGlobalProcID, &tReductionComm);
-
-        // reduce data to rank zero of tReductionComm
-        std::vector<double> tRecv(mData.size(), 0.0);
-        MPI_Reduce(mData.data(), tRecv.data(), mData.size(), MPI_DOUBLE, MPI_SUM, /*rank_of_root=*/0, tReductionComm);
 
+        // sum the data from rank zero of each provider local comm.  every other
+        // rank contributes zeros, so a single allreduce on the inter-comm
+        // replaces the split/reduce/bcast sequence.
+        if( mIsReductionRoot )
+        {
+            mRecvBuffer = mData;
+        }
+        else
+        {
+            mRecvBuffer.assign(mData.size(), 0.0);
+        }
+        MPI_Iallreduce(MPI_IN_PLACE, mRecvBuffer.data(), mRecvBuffer.size(), MPI_DOUBLE, MPI_SUM, mInterComm, &mRequest);
+    }
+}
 
-        // broadcast the result to all ranks in mIntercomm
-        //
+/******************************************************************************/
+void SharedValue::endTransmitData()
+/******************************************************************************/
+{
+    if( mRequest == MPI_REQUEST_NULL )
+    {
+        return;
+    }
+    MPI_Wait(&mRequest, MPI_STATUS_IGNORE);
 
-        // get rank in mReductionComm
-        int tRankInReductionComm;
-        MPI_Comm_rank(tReductionComm, &tRankInReductionComm);
+    if( mProviderNames.size() > 1 && !mIsProvider )
+    {
+        mData = mRecvBuffer;
+    }
+}
 
-        // if the local rank is not zero (i.e., the sender), then flip the global rank to -1
-        if( tRankInReductionComm ) tGlobalProcID = -1;
+/******************************************************************************/
+void SharedValue::initializeCommunicationPlan()
+/******************************************************************************/
+{
+    // The roles of the local rank do not change between transmits.  Compute
+    // them once here, when the shared value is created or its MPI state is
+    // updated, instead of on every call to transmitData().
+    int tMyProcID = -1;
+    MPI_Comm_rank(mMyComm, &tMyProcID);
 
-        // global max now returns the rank of the sender
-        int tSenderProcID=-1;
-        MPI_Allreduce(&tGlobalProcID, &tSenderProcID, 1, MPI_INT, MPI_MAX, mInterComm);
+    mIsProvider = ( std::find( mProviderNames.begin(),
+                               mProviderNames.end(),
+                               mLocalCommName ) != mProviderNames.end() );
+    mIsReductionRoot = (tMyProcID == 0 && mIsProvider);
 
-        // broadcast the reduced data to all ranks 
-        MPI_Bcast(tRecv.data(), tRecv.size(), MPI_DOUBLE, tSenderProcID, mInterComm);
-        if( !tIsaProvider ){
-            mData = tRecv;
+    mSenderProcID = -1;
+    if( mProviderNames.size() == 1 )
+    {
+        // determine provider procID
+        int tGlobalProcID = -1;
+        if( mIsReductionRoot )
+        {
+            MPI_Comm_rank(mInterComm, &tGlobalProcID);
         }
+        MPI_Allreduce(&tGlobalProcID, &mSenderProcID, 1, MPI_INT, MPI_MAX, mInterComm);
     }
+
+    mRecvBuffer.reserve(mNumData);
 }
-  
 
 /******************************************************************************/
 void SharedValue::setData(const std::vector<double> & aData)
@@ -152,6 +177,7 @@ void SharedValue::setData(const std::vector<double> & aData)
     {
         mData[tIndex] = aData[tIndex];
     }
+    mVersion++;
 }
 
 /******************************************************************************/
@@ -168,6 +194,20 @@ void SharedValue::getData(std::vector<double> & aData) const
     }
 }
 
+/******************************************************************************/
+double* SharedValue::sendBuffer()
+/******************************************************************************/
+{
+    return mData.data();
+}
+
+/******************************************************************************/
+const double* SharedValue::getRecvBuffer() const
+/******************************************************************************/
+{
+    return mData.data();
+}
+
 /*****************************************************************************/
 int SharedValue::size() const
 /*****************************************************************************/
@@ -204,6 +244,7 @@ SharedValue::SharedValue(const std::string & aMyName,
         mMyLayout(Plato::data::layout_t::SCALAR)
 /*****************************************************************************/
 {
+    this->initializeCommunicationPlan();
 }
 
 /*****************************************************************************/
@@ -213,6 +254,7 @@ void SharedValue::initializeMPI(const Plato::CommunicationData& aCommData)
     mLocalCommName = aCommData.mLocalCommName;
     mMyComm = aCommData.mLocalComm;
     mInterComm = aCommData.mInterComm;
+    this->initializeCommunicationPlan();
 }
 
 } // End namespace Plato
@@ -74,9 +74,13 @@ public:
     Plato::data::layout_t myLayout() const;
 
     void transmitData();
+    void beginTransmitData() override;
+    void endTransmitData() override;
     void setData(const std::vector<double> & aData);
     void getData(std::vector<double> & aData) const;
 
+    const double* getRecvBuffer() const override;
+
     template<class Archive>
     void serialize(Archive & aArchive, const unsigned int version)
     {
@@ -93,6 +97,13 @@ public:
     }
 
     void initializeMPI(const Plato::CommunicationData& aCommData) override;
+
+protected:
+    double* sendBuffer() override;
+
+private:
+    void initializeCommunicationPlan();
+
 private:
     std::string mMyName;
     std::vector<std::string> mProviderNames;
@@ -101,6 +112,13 @@ private:
     MPI_Comm mMyComm;
     MPI_Comm mInterComm;
 
+    // communication plan, computed once on creation/update (see initializeCommunicationPlan)
+    bool mIsProvider = false;
+    bool mIsReductionRoot = false;
+    int mSenderProcID = -1;
+    std::vector<double> mRecvBuffer;
+    MPI_Request mRequest = MPI_REQUEST_NULL;
+
     int mNumData;
     bool mIsDynamic;
     std::vector<double> mData;
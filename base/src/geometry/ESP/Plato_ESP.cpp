@@ -53,6 +53,7 @@ ESP<ScalarType,ScalarVectorType>::ESP(std::string aModelFileName, std::string aT
     mTessFileName(aTessFileName)
 {
     readNames();
+    mAllParameterNames = mParameterNames;
 
     if(aParameterIndex != -1){
         auto tName = mParameterNames[aParameterIndex];
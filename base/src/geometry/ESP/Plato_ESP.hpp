@@ -70,6 +70,7 @@ class ESP
     std::vector<VectorType> mSensitivity;
 
     std::vector<std::string>  mParameterNames;
+    std::vector<std::string>  mAllParameterNames;
    
     std::string  mModelFileName;
     std::string  mTessFileName;
@@ -1,6 +1,12 @@
 #include "Plato_ESP.hpp"
 #include "Plato_KokkosTypes.hpp"
 
+#include <list>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <sys/stat.h>
+
 extern "C" {
 #include "egads.h"
 #include "bodyTess.h"
@@ -27,8 +33,12 @@ ESPImpl(std::string aModelFileName, std::string aTessFileName, int aParameterInd
     openContext();
     openModel();
     checkModel();
+    mapParameterIndices();
+    stampInputFiles();
+    if( readSensitivitiesFromCache() ) return;
     buildGeometryAndGetBodies();
     tesselate();
+    writeSensitivitiesToCache();
 }
 virtual ~ESPImpl() {
     safeFreeOCSM();
@@ -42,15 +52,67 @@ private:
 
     static constexpr int mSpaceDim = 3;
 
+    // vertices of the base tessellation grouped by the topological entity they lie on
+    struct BodyTessellation
+    {
+        int mBodyIndex;
+        int mNumVerts;
+        std::vector<std::pair<int,int>> mNodeVerts;                // (vertex, node)
+        std::vector<std::vector<std::pair<int,int>>> mEdgeVerts;   // per edge: (vertex, index in edge)
+        std::vector<std::vector<std::pair<int,int>>> mFaceVerts;   // per face: (vertex, index in face)
+    };
+    std::vector<BodyTessellation> mBodyTessellations;
+
+    std::map<std::string,int> mParameterIndices;
+    std::vector<ScalarType>   mParameterValues;
+    bool                      mCacheable = true;
+
+    // size and modification time of an input file; a rewritten file invalidates cached results
+    struct FileStamp
+    {
+        long long mSize = -1;
+        long long mModifiedSeconds = 0;
+        long long mModifiedNanoseconds = 0;
+        bool operator==(const FileStamp& aOther) const
+        {
+            return mSize == aOther.mSize &&
+                   mModifiedSeconds == aOther.mModifiedSeconds &&
+                   mModifiedNanoseconds == aOther.mModifiedNanoseconds;
+        }
+    };
+    FileStamp mModelFileStamp;
+    FileStamp mTessFileStamp;
+
+    // sensitivities of recently seen designs, keyed by the input files and the design parameter values
+    struct CacheEntry
+    {
+        std::string mModelFileName;
+        std::string mTessFileName;
+        FileStamp mModelFileStamp;
+        FileStamp mTessFileStamp;
+        std::vector<std::string> mParameterNames;
+        std::vector<ScalarType> mParameterValues;
+        std::vector<VectorType> mSensitivity;
+    };
+    static constexpr size_t mMaxCacheEntries = 8;
+    static std::list<CacheEntry>& sensitivityCache();
+    static std::mutex& sensitivityCacheMutex();
+
     ego context = nullptr;
     void *model = nullptr;
     modl_T *modelT = nullptr;
 
     void cleanUpAndThrow(std::string aError);
     void tesselate();
+    void groupTessellationVertices();
     ScalarType computeSensitivity(VectorType& aDXDp);
     void buildGeometryAndGetBodies();
+    void mapParameterIndices();
     void activateParameterInModel(const std::string& aParameterName);
+    bool stampFile(const std::string& aFileName, FileStamp& aStamp);
+    void stampInputFiles();
+    bool readSensitivitiesFromCache();
+    void writeSensitivitiesToCache();
     void openContext();
     void openModel();
     void checkModel();
@@ -78,6 +140,10 @@ void ESPImpl<ScalarType,ScalarVectorType>::tesselate()
             cleanUpAndThrow("EG_loadTess failed.");
         }
     }
+
+    /* the tessellation doesn't change with the active parameter, so group its vertices once */
+    groupTessellationVertices();
+
     int tNumParams = this->mParameterNames.size();
     for(int iParam=0; iParam<tNumParams; iParam++)
     {
@@ -87,18 +153,10 @@ void ESPImpl<ScalarType,ScalarVectorType>::tesselate()
 }
 
 template <typename ScalarType, typename ScalarVectorType>
-ScalarType ESPImpl<ScalarType,ScalarVectorType>::computeSensitivity(VectorType& aDXDp)
+void ESPImpl<ScalarType,ScalarVectorType>::groupTessellationVertices()
 {
-    ScalarType tSensitivity(0.0);
+    mBodyTessellations.clear();
 
-    /* clear all then set the parameter & tell OpenCSM */
-    ocsmSetVelD(model, 0,     0,    0,    0.0);
-    ocsmSetVelD(model, this->mActiveParameterIndex, /*irow=*/ 1, /*icol=*/ 1, 1.0);
-    int tBuildTo = 0;
-    int tNbody   = 0;
-    ocsmBuild(model, tBuildTo, &this->mBuiltTo, &tNbody, NULL);
-    
-    /* retrieve the sensitivities for the active bodies */
     int tNface, tNedge, tNvert, tNtri;
     int *tTris(nullptr);
     ScalarType *tCoords(nullptr);
@@ -113,23 +171,69 @@ ScalarType ESPImpl<ScalarType,ScalarVectorType>::computeSensitivity(VectorType&
            cleanUpAndThrow("bodyTess failed.");
         }
 
-        aDXDp = VectorType(tNvert*this->mSpaceDim);
+        BodyTessellation tBodyTess;
+        tBodyTess.mBodyIndex = ibody;
+        tBodyTess.mNumVerts = tNvert;
+        tBodyTess.mEdgeVerts.resize(tNedge);
+        tBodyTess.mFaceVerts.resize(tNface);
+        for (int k=0; k<tNvert; k++)
+        {
+            int tPtype = tVtags[k].ptype;
+            int tPindex = tVtags[k].pindex;
+            if (tPtype == 0)
+            {
+                tBodyTess.mNodeVerts.push_back(std::make_pair(k, tPindex));
+            }
+            else
+            if (tPtype > 0 && tPindex >= 1 && tPindex <= tNedge)
+            {
+                tBodyTess.mEdgeVerts[tPindex-1].push_back(std::make_pair(k, tPtype-1));
+            }
+            else
+            if (tPtype < 0 && tPindex >= 1 && tPindex <= tNface)
+            {
+                tBodyTess.mFaceVerts[tPindex-1].push_back(std::make_pair(k, -tPtype-1));
+            }
+        }
+        mBodyTessellations.push_back(tBodyTess);
+
+        EG_free(tTris);
+        EG_free(tVtags);
+        EG_free(tCoords);
+    }
+}
+
+template <typename ScalarType, typename ScalarVectorType>
+ScalarType ESPImpl<ScalarType,ScalarVectorType>::computeSensitivity(VectorType& aDXDp)
+{
+    ScalarType tSensitivity(0.0);
+
+    /* clear all then set the parameter & tell OpenCSM */
+    ocsmSetVelD(model, 0,     0,    0,    0.0);
+    ocsmSetVelD(model, this->mActiveParameterIndex, /*irow=*/ 1, /*icol=*/ 1, 1.0);
+    int tBuildTo = 0;
+    int tNbody   = 0;
+    ocsmBuild(model, tBuildTo, &this->mBuiltTo, &tNbody, NULL);
+    
+    /* retrieve the sensitivities for the active bodies */
+    for (auto& tBodyTess : mBodyTessellations)
+    {
+        int ibody = tBodyTess.mBodyIndex;
+
+        aDXDp = VectorType(tBodyTess.mNumVerts*this->mSpaceDim);
 
         const ScalarType *tPcsens;
     
         /* fill in the Nodes */
-        for (int j=0; j<tNvert; j++)
+        for (auto& tVert : tBodyTess.mNodeVerts)
         {
-            if (tVtags[j].ptype != 0) continue;
-            auto tStatus = ocsmGetTessVel(model, ibody, OCSM_NODE, tVtags[j].pindex, &tPcsens);
+            int j = tVert.first;
+            auto tStatus = ocsmGetTessVel(model, ibody, OCSM_NODE, tVert.second, &tPcsens);
             if (tStatus != EGADS_SUCCESS)
             {
-                EG_free(tTris);
-                EG_free(tVtags);
-                EG_free(tCoords);
                 std::stringstream ss;
                 ss << "ocsmGetTessVel Parameter " << this->mActiveParameterName << " vert " << j+1 << " failed: " 
-                    << tStatus << " (Node = " << tVtags[j].pindex << ")!";
+                    << tStatus << " (Node = " << tVert.second << ")!";
                 cleanUpAndThrow(ss.str());
             }
             aDXDp[3*j  ] = tPcsens[0];
@@ -138,54 +242,44 @@ ScalarType ESPImpl<ScalarType,ScalarVectorType>::computeSensitivity(VectorType&
         }
     
         /* next do all of the edges */
-        int tIndex;
+        int tNedge = tBodyTess.mEdgeVerts.size();
         for (int j=1; j<=tNedge; j++)
         {
             auto tStatus = ocsmGetTessVel(model, ibody, OCSM_EDGE, j, &tPcsens);
             if (tStatus != EGADS_SUCCESS)
             {
-                EG_free(tTris);
-                EG_free(tVtags);
-                EG_free(tCoords);
                 std::stringstream ss;
                 ss << " ocsmGetTessVel Parameter " << this->mActiveParameterName << " Edge " << j << " failed: " << tStatus;
                 cleanUpAndThrow(ss.str());
             }
-            for (int k = 0; k < tNvert; k++)
+            for (auto& tVert : tBodyTess.mEdgeVerts[j-1])
             {
-                if ((tVtags[k].ptype > 0) && (tVtags[k].pindex == j)) {
-                    tIndex       = tVtags[k].ptype - 1;
-                    aDXDp[3*k  ] = tPcsens[3*tIndex  ];
-                    aDXDp[3*k+1] = tPcsens[3*tIndex+1];
-                    aDXDp[3*k+2] = tPcsens[3*tIndex+2];
-                }
+                int k = tVert.first, tIndex = tVert.second;
+                aDXDp[3*k  ] = tPcsens[3*tIndex  ];
+                aDXDp[3*k+1] = tPcsens[3*tIndex+1];
+                aDXDp[3*k+2] = tPcsens[3*tIndex+2];
             }
         }
             
         /* do all of the faces */
-        for (int j=1; j<=tNface; j++) {
+        int tNface = tBodyTess.mFaceVerts.size();
+        for (int j=1; j<=tNface; j++)
+        {
             auto tStatus = ocsmGetTessVel(model, ibody, OCSM_FACE, j, &tPcsens);
-            if (tStatus != EGADS_SUCCESS) {
-            EG_free(tTris);
-            EG_free(tVtags);
-            EG_free(tCoords);
-            std::stringstream ss;
-            ss << " ocsmGetTessVel Parameter " << this->mActiveParameterName << " Face " << j << "failed: " << tStatus;
-            cleanUpAndThrow(ss.str());
+            if (tStatus != EGADS_SUCCESS)
+            {
+                std::stringstream ss;
+                ss << " ocsmGetTessVel Parameter " << this->mActiveParameterName << " Face " << j << "failed: " << tStatus;
+                cleanUpAndThrow(ss.str());
             }
-            for (int k=0; k<tNvert; k++)
-            if ((tVtags[k].ptype < 0) && (tVtags[k].pindex == j)) {
-                tIndex       = -tVtags[k].ptype - 1;
+            for (auto& tVert : tBodyTess.mFaceVerts[j-1])
+            {
+                int k = tVert.first, tIndex = tVert.second;
                 aDXDp[3*k  ] = tPcsens[3*tIndex  ];
                 aDXDp[3*k+1] = tPcsens[3*tIndex+1];
                 aDXDp[3*k+2] = tPcsens[3*tIndex+2];
             }
         }
-    
-        EG_free(tTris);
-        EG_free(tVtags);
-        EG_free(tCoords);
-
     }
     return tSensitivity;
 }
@@ -218,7 +312,7 @@ void ESPImpl<ScalarType,ScalarVectorType>::buildGeometryAndGetBodies()
 }
 
 template <typename ScalarType, typename ScalarVectorType>
-void ESPImpl<ScalarType,ScalarVectorType>::activateParameterInModel(const std::string& aParameterName)
+void ESPImpl<ScalarType,ScalarVectorType>::mapParameterIndices()
 {
     int tNumRows(1), tNumCols(1); // no matrix variables allowed currently
     int tType(0); // not sure what this variable is for
@@ -229,18 +323,130 @@ void ESPImpl<ScalarType,ScalarVectorType>::activateParameterInModel(const std::s
         if (tStatus != OCSM_SUCCESS) {
             cleanUpAndThrow("ocsmGetPmtr failed.");
         }
-        if (strcmp(aParameterName.c_str(), tParameterName) == 0) {
-            this->mActiveParameterIndex = j+1;
-            this->mActiveParameterName = aParameterName;
-            break;
+        mParameterIndices.insert(std::make_pair(std::string(tParameterName), j+1));
+    }
+
+    /* the values of all design parameters identify the design */
+    mParameterValues.clear();
+    for (auto& tName : this->mAllParameterNames)
+    {
+        auto tIter = mParameterIndices.find(tName);
+        if (tIter == mParameterIndices.end()) continue;
+
+        auto tStatus = ocsmGetPmtr(model, tIter->second, &tType, &tNumRows, &tNumCols, tParameterName);
+        for (int iRow=1; iRow<=tNumRows && tStatus == OCSM_SUCCESS; iRow++)
+        {
+            for (int iCol=1; iCol<=tNumCols && tStatus == OCSM_SUCCESS; iCol++)
+            {
+                ScalarType tValue(0.0), tDot(0.0);
+                tStatus = ocsmGetValu(model, tIter->second, iRow, iCol, &tValue, &tDot);
+                mParameterValues.push_back(tValue);
+            }
+        }
+        if (tStatus != OCSM_SUCCESS)
+        {
+            /* without the full parameter vector a cached result can't be matched safely */
+            mCacheable = false;
         }
     }
-    if (this->mActiveParameterIndex == 0)
+}
+
+template <typename ScalarType, typename ScalarVectorType>
+void ESPImpl<ScalarType,ScalarVectorType>::activateParameterInModel(const std::string& aParameterName)
+{
+    auto tIter = mParameterIndices.find(aParameterName);
+    if (tIter == mParameterIndices.end())
     {
         std::stringstream ss;
         ss << "Parameter not found: " << aParameterName;
         cleanUpAndThrow(ss.str());
     }
+    this->mActiveParameterIndex = tIter->second;
+    this->mActiveParameterName = aParameterName;
+}
+
+template <typename ScalarType, typename ScalarVectorType>
+bool ESPImpl<ScalarType,ScalarVectorType>::stampFile(const std::string& aFileName, FileStamp& aStamp)
+{
+    struct stat tStat;
+    if (stat(aFileName.c_str(), &tStat) != 0) return false;
+
+    aStamp.mSize = static_cast<long long>(tStat.st_size);
+    aStamp.mModifiedSeconds = static_cast<long long>(tStat.st_mtim.tv_sec);
+    aStamp.mModifiedNanoseconds = static_cast<long long>(tStat.st_mtim.tv_nsec);
+    return true;
+}
+
+template <typename ScalarType, typename ScalarVectorType>
+void ESPImpl<ScalarType,ScalarVectorType>::stampInputFiles()
+{
+    /* the same paths may be rewritten between designs, e.g. a new tessellation each iteration */
+    if (!stampFile(this->mModelFileName, mModelFileStamp) ||
+        !stampFile(this->mTessFileName, mTessFileStamp))
+    {
+        mCacheable = false;
+    }
+}
+
+template <typename ScalarType, typename ScalarVectorType>
+std::list<typename ESPImpl<ScalarType,ScalarVectorType>::CacheEntry>&
+ESPImpl<ScalarType,ScalarVectorType>::sensitivityCache()
+{
+    static std::list<CacheEntry> tCache;
+    return tCache;
+}
+
+template <typename ScalarType, typename ScalarVectorType>
+std::mutex& ESPImpl<ScalarType,ScalarVectorType>::sensitivityCacheMutex()
+{
+    static std::mutex tMutex;
+    return tMutex;
+}
+
+template <typename ScalarType, typename ScalarVectorType>
+bool ESPImpl<ScalarType,ScalarVectorType>::readSensitivitiesFromCache()
+{
+    if (!mCacheable) return false;
+
+    std::lock_guard<std::mutex> tLock(sensitivityCacheMutex());
+    auto& tCache = sensitivityCache();
+    for (auto tIter = tCache.begin(); tIter != tCache.end(); ++tIter)
+    {
+        if (tIter->mParameterValues == mParameterValues &&
+            tIter->mParameterNames  == this->mParameterNames &&
+            tIter->mModelFileName   == this->mModelFileName &&
+            tIter->mTessFileName    == this->mTessFileName &&
+            tIter->mModelFileStamp  == mModelFileStamp &&
+            tIter->mTessFileStamp   == mTessFileStamp)
+        {
+            this->mSensitivity = tIter->mSensitivity;
+            tCache.splice(tCache.begin(), tCache, tIter);
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename ScalarType, typename ScalarVectorType>
+void ESPImpl<ScalarType,ScalarVectorType>::writeSensitivitiesToCache()
+{
+    if (!mCacheable) return;
+
+    std::lock_guard<std::mutex> tLock(sensitivityCacheMutex());
+    auto& tCache = sensitivityCache();
+    CacheEntry tEntry;
+    tEntry.mModelFileName   = this->mModelFileName;
+    tEntry.mTessFileName    = this->mTessFileName;
+    tEntry.mModelFileStamp  = mModelFileStamp;
+    tEntry.mTessFileStamp   = mTessFileStamp;
+    tEntry.mParameterNames  = this->mParameterNames;
+    tEntry.mParameterValues = mParameterValues;
+    tEntry.mSensitivity     = this->mSensitivity;
+    tCache.push_front(tEntry);
+    if (tCache.size() > mMaxCacheEntries)
+    {
+        tCache.pop_back();
+    }
 }
 
 template <typename ScalarType, typename ScalarVectorType>
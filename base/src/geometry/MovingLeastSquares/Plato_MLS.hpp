@@ -53,7 +53,10 @@
 #include <Kokkos_Core.hpp>
 #include <array>
 #include <map>
+#include <cmath>
 #include <string>
+#include <sstream>
+#include <algorithm>
 #include <stdio.h>
 #include <math.h>
 #include "Plato_Parser.hpp"
@@ -76,62 +79,6 @@ using ScalarArray  = typename Kokkos::View<ScalarType**, Plato::Layout, MemSpace
 using NeighborMap = typename Kokkos::View<int**, Plato::Layout, Kokkos::DefaultExecutionSpace::memory_space>;
 using NeighborMapHost = typename NeighborMap::HostMirror;
 
-template<int SpaceDim, typename ScalarType>
-class NeighborMapper
-{
-   // for now, this is done on the host
-   typename ScalarArray<ScalarType>::HostMirror m_points;
-
-   struct Neighbor{ 
-     Neighbor() : index(0), distance(0.0) {}
-     int        index;
-     ScalarType distance;
-     friend bool operator< (const Neighbor & a, const Neighbor & b)
-     {
-          return a.distance < b.distance;
-     }
-   };
-  
-   public:
-       NeighborMapper(const typename ScalarArray<ScalarType>::HostMirror & a_points) : m_points( a_points ) {}
-
-       NeighborMap map( int a_numNeighbors )
-       {
-           int t_numPoints = m_points.extent(0);
-           NeighborMap retMap("map", t_numPoints, a_numNeighbors);
-           auto hstMap = Kokkos::create_mirror_view(retMap);
-  
-           // use brute force for now.  need a k-d tree w/ n nearest neighbor search
-           for(int i=0; i<t_numPoints; i++)
-           {
-               ScalarType t_iPoint[SpaceDim];
-               for(int k=0; k<SpaceDim; k++)
-               {
-                   t_iPoint[k] = m_points(i,k);
-               }
-
-               std::vector<Neighbor> t_neighbors(t_numPoints);
-               for(int j=0; j<t_numPoints; j++)
-               {
-                   t_neighbors[j].index = j;
-                   ScalarType t_square_distance = 0.0;
-                   for(int k=0; k<SpaceDim; k++)
-                   {
-                       t_square_distance += (m_points(j,k)-t_iPoint[k])*(m_points(j,k)-t_iPoint[k]);
-                   }
-                   t_neighbors[j].distance = t_square_distance;
-               }
-               std::sort(t_neighbors.begin(), t_neighbors.end());
-               for(int j=0; j<a_numNeighbors; j++)
-               {
-                   hstMap(i,j) = t_neighbors[j].index;
-               }
-           }
-           Kokkos::deep_copy(retMap, hstMap);
-           return retMap;
-       }
-};
-
 template<int SpaceDim=3, typename ScalarType=double>
 class PointGrid
 {
@@ -142,16 +89,19 @@ class PointGrid
   ScalarVector<ScalarType> m_d;
   ScalarVector<ScalarType> m_o;
   int m_numPoints;
-  
-  public:
-    PointGrid(std::array<int,SpaceDim> n, 
-              std::array<ScalarType,SpaceDim> d,
-              std::array<ScalarType,SpaceDim> o) :
-       m_n     ("num grid points",SpaceDim),
-       m_stride("grid strides",   SpaceDim),
-       m_d     ("grid dimensions",SpaceDim),
-       m_o     ("grid offsets",   SpaceDim)
-    {
+
+  // bucketed index (point constructor only).  grid point i owns the indexed points
+  // in the cell [o+i*d, o+(i+1)*d), listed in m_bucketPoints from m_bucketOffsets(i)
+  // to m_bucketOffsets(i+1)-1 in increasing order.
+  ScalarArray<ScalarType> m_points;
+  ScalarVector<int> m_bucketOffsets;
+  ScalarVector<int> m_bucketPoints;
+
+  void
+  setLattice(std::array<int,SpaceDim> n,
+             std::array<ScalarType,SpaceDim> d,
+             std::array<ScalarType,SpaceDim> o)
+  {
       auto n_host = Kokkos::create_mirror_view(m_n);
       auto d_host = Kokkos::create_mirror_view(m_d);
       auto o_host = Kokkos::create_mirror_view(m_o);
@@ -177,8 +127,144 @@ class PointGrid
         }
       }
       Kokkos::deep_copy(m_stride, stride_host);
+  }
+
+  public:
+    PointGrid() : m_numPoints(0) {}
+
+    PointGrid(std::array<int,SpaceDim> n,
+              std::array<ScalarType,SpaceDim> d,
+              std::array<ScalarType,SpaceDim> o) :
+       m_n     ("num grid points",SpaceDim),
+       m_stride("grid strides",   SpaceDim),
+       m_d     ("grid dimensions",SpaceDim),
+       m_o     ("grid offsets",   SpaceDim)
+    {
+      setLattice(n, d, o);
+    }
+
+    /***************************************************************************/
+    /*!
+     *  /brief Constructor for a bucketed index of a_points.
+     *  Lays a grid with spacing a_cellSize over the bounding box of a_points and
+     *  counting sorts the points into the cells.  If a_cellSize isn't positive,
+     *  the spacing is chosen to give about one point per cell.  The spacing is
+     *  coarsened if the grid would have more than two cells per point.
+     */
+    /***************************************************************************/
+    PointGrid(ScalarArray<ScalarType> a_points, ScalarType a_cellSize) :
+       m_n     ("num grid cells", SpaceDim),
+       m_stride("grid strides",   SpaceDim),
+       m_d     ("grid dimensions",SpaceDim),
+       m_o     ("grid offsets",   SpaceDim),
+       m_points(a_points)
+    {
+      int t_numPoints = a_points.extent(0);
+
+      // bounding box
+      //
+      std::array<ScalarType,SpaceDim> t_min, t_max;
+      for(int iDim=0; iDim<SpaceDim; iDim++){
+        t_min[iDim] = 0.0;
+        t_max[iDim] = 0.0;
+        if( t_numPoints == 0 ) continue;
+
+        Kokkos::Min<ScalarType> t_minReducer(t_min[iDim]);
+        Kokkos::parallel_reduce(Kokkos::RangePolicy<int>(0,t_numPoints), KOKKOS_LAMBDA(int pointIndex, ScalarType& a_value)
+        {
+          t_minReducer.join(a_value, a_points(pointIndex,iDim));
+        }, t_minReducer);
+
+        Kokkos::Max<ScalarType> t_maxReducer(t_max[iDim]);
+        Kokkos::parallel_reduce(Kokkos::RangePolicy<int>(0,t_numPoints), KOKKOS_LAMBDA(int pointIndex, ScalarType& a_value)
+        {
+          t_maxReducer.join(a_value, a_points(pointIndex,iDim));
+        }, t_maxReducer);
+      }
+
+      // cell size
+      //
+      ScalarType t_maxExtent = 0.0;
+      for(int iDim=0; iDim<SpaceDim; iDim++){
+        t_maxExtent = std::max(t_maxExtent, t_max[iDim]-t_min[iDim]);
+      }
+      ScalarType t_cellSize = a_cellSize;
+      if( !(t_cellSize > 0.0) ){
+        t_cellSize = t_maxExtent / std::ceil(std::pow(ScalarType(std::max(t_numPoints,1)), ScalarType(1.0)/SpaceDim));
+      }
+      if( !(t_cellSize > 0.0) ){
+        t_cellSize = 1.0;
+      }
+      while(true){
+        double t_numCells = 1.0;
+        for(int iDim=0; iDim<SpaceDim; iDim++){
+          t_numCells *= std::floor((t_max[iDim]-t_min[iDim])/t_cellSize) + 1.0;
+        }
+        if( t_numCells <= 2.0*t_numPoints + 1.0 ) break;
+        t_cellSize *= 2.0;
+      }
+
+      std::array<int,SpaceDim> t_n;
+      std::array<ScalarType,SpaceDim> t_d;
+      for(int iDim=0; iDim<SpaceDim; iDim++){
+        t_n[iDim] = std::floor((t_max[iDim]-t_min[iDim])/t_cellSize) + 1;
+        t_d[iDim] = t_cellSize;
+      }
+      setLattice(t_n, t_d, t_min);
+
+      // count points per cell
+      //
+      int t_numCells = m_numPoints;
+      m_bucketOffsets = ScalarVector<int>("bucket offsets", t_numCells+1);
+      m_bucketPoints  = ScalarVector<int>("bucket points",  t_numPoints);
+
+      ScalarVector<int> t_cellIndices("cell indices", t_numPoints);
+      ScalarVector<int> t_cellCounts("cell counts", t_numCells);
+      auto t_grid = *this;
+      Kokkos::parallel_for(Kokkos::RangePolicy<int>(0,t_numPoints), KOKKOS_LAMBDA(int pointIndex)
+      {
+        ScalarType t_pointCoord[SpaceDim];
+        for(int iDim=0; iDim<SpaceDim; iDim++){
+          t_pointCoord[iDim] = a_points(pointIndex,iDim);
+        }
+        t_cellIndices(pointIndex) = t_grid.getCell(t_pointCoord);
+        Kokkos::atomic_fetch_add(&t_cellCounts(t_cellIndices(pointIndex)), 1);
+      });
+
+      auto t_bucketOffsets = m_bucketOffsets;
+      Kokkos::parallel_scan(Kokkos::RangePolicy<int>(0,t_numCells), KOKKOS_LAMBDA(int cellIndex, int& a_offset, const bool a_final)
+      {
+        if( a_final ) t_bucketOffsets(cellIndex) = a_offset;
+        a_offset += t_cellCounts(cellIndex);
+        if( a_final && cellIndex == t_numCells-1 ) t_bucketOffsets(t_numCells) = a_offset;
+      });
+
+      // fill buckets, then sort each bucket so that traversal order doesn't
+      // depend on the thread schedule
+      //
+      auto t_bucketPoints = m_bucketPoints;
+      Kokkos::deep_copy(t_cellCounts, 0);
+      Kokkos::parallel_for(Kokkos::RangePolicy<int>(0,t_numPoints), KOKKOS_LAMBDA(int pointIndex)
+      {
+        int t_cell = t_cellIndices(pointIndex);
+        int t_slot = Kokkos::atomic_fetch_add(&t_cellCounts(t_cell), 1);
+        t_bucketPoints(t_bucketOffsets(t_cell) + t_slot) = pointIndex;
+      });
+      Kokkos::parallel_for(Kokkos::RangePolicy<int>(0,t_numCells), KOKKOS_LAMBDA(int cellIndex)
+      {
+        int t_begin = t_bucketOffsets(cellIndex);
+        int t_end = t_bucketOffsets(cellIndex+1);
+        for(int iEntry=t_begin+1; iEntry<t_end; iEntry++){
+          int t_point = t_bucketPoints(iEntry);
+          int jEntry = iEntry;
+          for(; jEntry>t_begin && t_bucketPoints(jEntry-1)>t_point; jEntry--){
+            t_bucketPoints(jEntry) = t_bucketPoints(jEntry-1);
+          }
+          t_bucketPoints(jEntry) = t_point;
+        }
+      });
     }
-    
+
     ScalarArray<ScalarType>
     operator()(){
       // create coordinates
@@ -205,6 +291,157 @@ class PointGrid
       });
       return coords;
     }
+
+    KOKKOS_INLINE_FUNCTION ScalarType
+    getSpacing(int a_dim) const { return m_d(a_dim); }
+
+    /***************************************************************************/
+    /*!
+     *  /brief Index of the cell that contains a_coord (clamped to the grid).
+     */
+    /***************************************************************************/
+    KOKKOS_INLINE_FUNCTION int
+    getCell(const ScalarType a_coord[SpaceDim]) const
+    {
+      int t_cell = 0;
+      for(int iDim=0; iDim<SpaceDim; iDim++){
+        ScalarType t_i = floor((a_coord[iDim]-m_o(iDim))/m_d(iDim));
+        t_i = t_i < 0 ? 0 : t_i;
+        t_i = t_i > m_n(iDim)-1 ? m_n(iDim)-1 : t_i;
+        t_cell += int(t_i)*m_stride(iDim);
+      }
+      return t_cell;
+    }
+
+    /***************************************************************************/
+    /*!
+     *  /brief Call a_functor(pointIndex, squaredDistance) for each indexed point
+     *  within a_radius of a_coord.  Only the cells overlapping the bounding box of
+     *  the search sphere are visited.
+     */
+    /***************************************************************************/
+    template<typename FunctorType>
+    KOKKOS_INLINE_FUNCTION void
+    forEachPointWithin(const ScalarType a_coord[SpaceDim], ScalarType a_radius, FunctorType & a_functor) const
+    {
+      // pad the cell range slightly so points on cell faces aren't lost to round off
+      const ScalarType t_pad = 1.0e-6;
+
+      int t_lo[SpaceDim], t_hi[SpaceDim], t_i[SpaceDim];
+      for(int iDim=0; iDim<SpaceDim; iDim++){
+        ScalarType t_x = a_coord[iDim]-m_o(iDim);
+        ScalarType t_lower = floor((t_x-a_radius)/m_d(iDim) - t_pad);
+        ScalarType t_upper = floor((t_x+a_radius)/m_d(iDim) + t_pad);
+        if( t_upper < 0 || t_lower > m_n(iDim)-1 ) return;
+        t_lo[iDim] = t_lower < 0 ? 0 : int(t_lower);
+        t_hi[iDim] = t_upper > m_n(iDim)-1 ? m_n(iDim)-1 : int(t_upper);
+        t_i[iDim] = t_lo[iDim];
+      }
+
+      ScalarType t_radiusSquared = a_radius*a_radius;
+      while(true){
+        int t_cell = 0;
+        for(int iDim=0; iDim<SpaceDim; iDim++){
+          t_cell += t_i[iDim]*m_stride(iDim);
+        }
+        int t_end = m_bucketOffsets(t_cell+1);
+        for(int iEntry=m_bucketOffsets(t_cell); iEntry<t_end; iEntry++){
+          int t_point = m_bucketPoints(iEntry);
+          ScalarType t_distance = 0.0;
+          for(int iDim=0; iDim<SpaceDim; iDim++){
+            ScalarType t_delta = a_coord[iDim]-m_points(t_point,iDim);
+            t_distance += t_delta*t_delta;
+          }
+          if( t_distance <= t_radiusSquared ){
+            a_functor(t_point, t_distance);
+          }
+        }
+
+        // next cell in the range, last dimension fastest
+        int iDim = SpaceDim-1;
+        for(; iDim>=0 && t_i[iDim]==t_hi[iDim]; iDim--){
+          t_i[iDim] = t_lo[iDim];
+        }
+        if( iDim < 0 ) break;
+        t_i[iDim]++;
+      }
+    }
+};
+
+template<int SpaceDim, typename ScalarType>
+class NeighborMapper
+{
+   // for now, this is done on the host
+   typename ScalarArray<ScalarType>::HostMirror m_points;
+
+   public:
+       NeighborMapper(const typename ScalarArray<ScalarType>::HostMirror & a_points) : m_points( a_points ) {}
+
+       /***************************************************************************/
+       /*!
+        *  /brief Find the a_numNeighbors nearest points of each point.
+        *  Neighbors are ordered by distance, ties by point index.  Each point grows a
+        *  search radius over a bucketed PointGrid until enough candidates are found,
+        *  so only nearby points are ranked.
+        */
+       /***************************************************************************/
+       NeighborMap map( int a_numNeighbors )
+       {
+           int t_numPoints = m_points.extent(0);
+           if( a_numNeighbors > t_numPoints ){
+             std::stringstream ss;
+             ss << "Plato::Geometry::NeighborMapper: " << std::endl;
+             ss << "  Requested " << a_numNeighbors << " neighbors but only " << t_numPoints << " points exist." << std::endl;
+             throw Plato::ParsingException(ss.str());
+           }
+           NeighborMap retMap("map", t_numPoints, a_numNeighbors);
+           if( t_numPoints == 0 || a_numNeighbors == 0 ) return retMap;
+
+           ScalarArray<ScalarType> t_points("points", t_numPoints, SpaceDim);
+           Kokkos::deep_copy(t_points, m_points);
+           PointGrid<SpaceDim,ScalarType> t_grid(t_points, /*cellSize=*/ 0.0);
+
+           Kokkos::View<ScalarType**, Plato::Layout, MemSpace> t_distances("distances", t_numPoints, a_numNeighbors);
+           Kokkos::parallel_for(Kokkos::RangePolicy<int>(0,t_numPoints),KOKKOS_LAMBDA(int pointIndex)
+           {
+             ScalarType t_iPoint[SpaceDim];
+             for(int k=0; k<SpaceDim; k++){
+               t_iPoint[k] = t_points(pointIndex,k);
+             }
+
+             // grow the search radius until it holds enough points
+             int t_numFound = 0;
+             auto t_count = [&](int, ScalarType){ t_numFound++; };
+             ScalarType t_radius = t_grid.getSpacing(0);
+             while(true){
+               t_numFound = 0;
+               t_grid.forEachPointWithin(t_iPoint, t_radius, t_count);
+               if( t_numFound >= a_numNeighbors ) break;
+               t_radius *= 2.0;
+             }
+
+             // insertion sort the nearest candidates into the map
+             int t_numKept = 0;
+             auto t_keep = [&](int a_index, ScalarType a_distance)
+             {
+               int j = t_numKept < a_numNeighbors ? t_numKept++ : a_numNeighbors;
+               for(; j>0; j--){
+                 ScalarType t_prior = t_distances(pointIndex,j-1);
+                 if( t_prior < a_distance || (t_prior == a_distance && retMap(pointIndex,j-1) < a_index) ) break;
+                 if( j < a_numNeighbors ){
+                   retMap(pointIndex,j) = retMap(pointIndex,j-1);
+                   t_distances(pointIndex,j) = t_prior;
+                 }
+               }
+               if( j < a_numNeighbors ){
+                 retMap(pointIndex,j) = a_index;
+                 t_distances(pointIndex,j) = a_distance;
+               }
+             };
+             t_grid.forEachPointWithin(t_iPoint, t_radius, t_keep);
+           });
+           return retMap;
+       }
 };
 
 template<int SpaceDim=3, typename ScalarType=double>
@@ -278,6 +515,12 @@ class MovingLeastSquares {
 
     ScalarType m_radius;
 
+    // the kernel, exp(-r^2/R^2), is truncated at the support radius, 8R.  points at
+    // half that distance or closer outweigh the truncated tail by at least e^-48.
+    static constexpr ScalarType c_supportFactor = 8.0;
+    ScalarType m_supportRadius;
+    PointGrid<SpaceDim,ScalarType> m_pointIndex;
+
     std::string strint(std::string base, int index)
     {
       std::stringstream out;
@@ -322,19 +565,22 @@ class MovingLeastSquares {
       PointGrid<SpaceDim,ScalarType> gp(t_num, t_delta, t_offset);
       m_coords = gp();
 
-      auto t_coords_host = getPointCoords();
-      NeighborMapper<SpaceDim,ScalarType> tNeighborMapper(t_coords_host);
-      
-      int t_numNeighbors;
+      // a neighbor map is only needed if it excludes points.  otherwise mapToPoints
+      // uses the same denominator as f.
+      //
       if( a_node.size<std::string>("NumNeighbors") ) {
-        t_numNeighbors = Plato::Get::Int(a_node, "NumNeighbors");
-      } else {
-        t_numNeighbors = t_coords_host.extent(0);
+        int t_numNeighbors = Plato::Get::Int(a_node, "NumNeighbors");
+        if( t_numNeighbors < getNumPoints() ) {
+          auto t_coords_host = getPointCoords();
+          NeighborMapper<SpaceDim,ScalarType> tNeighborMapper(t_coords_host);
+          m_neighborMap = tNeighborMapper.map( t_numNeighbors );
+        }
       }
-      m_neighborMap = tNeighborMapper.map( t_numNeighbors );
 
 
       m_radius = Plato::Get::Double(a_node, "Radius");
+      m_supportRadius = c_supportFactor * m_radius;
+      m_pointIndex = PointGrid<SpaceDim,ScalarType>(m_coords, m_supportRadius);
 
       // create fields
       //
@@ -373,6 +619,8 @@ class MovingLeastSquares {
     /******************************************************************************/
     /*! 
      *  /brief Compute the MLS function values.
+     *  Only points within the support radius of a node are summed.  Nodes with no
+     *  point within half the support radius fall back to summing over all points.
      *  /input a_pointValues Values at the MLS points
      *  /input a_nodeCoords Coordinates (nodeIndex, dimIndex) of nodes for which MLS 
      *         function values will be computed
@@ -386,6 +634,8 @@ class MovingLeastSquares {
       int t_numPoints = a_pointValues.size();
       auto t_coords = m_coords;
       auto t_radius = m_radius;
+      auto t_supportRadius = m_supportRadius;
+      auto t_pointIndex = m_pointIndex;
       Kokkos::parallel_for(Kokkos::RangePolicy<int>(0,t_numNodes),KOKKOS_LAMBDA(int nodeIndex)
       {
         ScalarType t_nodeCoord[SpaceDim];
@@ -393,14 +643,28 @@ class MovingLeastSquares {
           t_nodeCoord[iDim] = a_nodeCoords(nodeIndex,iDim);
         }
         ScalarType numerator=0.0, denominator=0.0;
-        for(int iPoint=0; iPoint<t_numPoints; iPoint++){
-          ScalarType norm=0.0;
-          for(int iDim=0; iDim<SpaceDim; iDim++){
-            norm += pow(t_nodeCoord[iDim]-t_coords(iPoint,iDim),2);
-          }
+        ScalarType t_nearest = t_supportRadius*t_supportRadius;
+        auto t_accumulate = [&](int iPoint, ScalarType norm)
+        {
           auto t_kernelVal = exp(-norm/(t_radius*t_radius));
           numerator   += a_pointValues(iPoint)*t_kernelVal;
           denominator += t_kernelVal;
+          t_nearest = norm < t_nearest ? norm : t_nearest;
+        };
+        t_pointIndex.forEachPointWithin(t_nodeCoord, t_supportRadius, t_accumulate);
+
+        if( 4.0*t_nearest > t_supportRadius*t_supportRadius ){
+          numerator=0.0;
+          denominator=0.0;
+          for(int iPoint=0; iPoint<t_numPoints; iPoint++){
+            ScalarType norm=0.0;
+            for(int iDim=0; iDim<SpaceDim; iDim++){
+              norm += pow(t_nodeCoord[iDim]-t_coords(iPoint,iDim),2);
+            }
+            auto t_kernelVal = exp(-norm/(t_radius*t_radius));
+            numerator   += a_pointValues(iPoint)*t_kernelVal;
+            denominator += t_kernelVal;
+          }
         }
         a_nodeValues(nodeIndex) = denominator != 0.0 ? numerator / denominator : 0.0;
       });
@@ -410,6 +674,10 @@ class MovingLeastSquares {
     /*! 
      *  /brief Map a derivative with respect to MLS values at nodes to a derivative
                with respect to MLS point values.
+     *  Without a neighbor map, each point gathers from the nodes within its support
+     *  radius through a bucketed index of the nodes, plus the nodes that f evaluates
+     *  with a sum over all points.  With a neighbor map the denominator isn't local
+     *  to the point, so every node is visited.
      *  /input a_nodeCoords Coordinates (nodeIndex, dimIndex) of nodes.
      *  /input a_nodeValues Values (nodeIndex) of a gradient with respect to nodal MLS values
      *  /output a_mappedValues Values (pointIndex) of the gradient with respect to the MLS point values.
@@ -421,19 +689,22 @@ class MovingLeastSquares {
       ScalarVector<ScalarType> a_nodeValues, 
       ScalarVector<ScalarType> a_mappedValues)
     {
+      if( m_neighborMap.extent(0) == 0 ){
+        mapToPointsWithinSupport(a_nodeCoords, a_nodeValues, a_mappedValues);
+        return;
+      }
 
-      auto t_mappedValuesHost = Kokkos::create_mirror_view(a_mappedValues);
       auto t_neighborMap = m_neighborMap;
       int tNumNeighbors = t_neighborMap.extent(1);
 
       int tNumPoints = m_coords.extent(0);
+      int tNumNodes = a_nodeValues.size();
       auto t_coords = m_coords;
       auto t_radius = m_radius;
-      for(int t_pointIndex=0; t_pointIndex<tNumPoints; t_pointIndex++){
+      Kokkos::parallel_for(Kokkos::RangePolicy<int>(0,tNumPoints),KOKKOS_LAMBDA(int t_pointIndex)
+      {
         ScalarType tReturnVal(0.0);
-        typedef typename ScalarArray<ScalarType>::size_type size_type;
-        Kokkos::parallel_reduce( Kokkos::RangePolicy<>(0,a_nodeValues.size()), KOKKOS_LAMBDA( const size_type & aNodeIndex, ScalarType& aLocalResult)
-        {
+        for(int aNodeIndex=0; aNodeIndex<tNumNodes; aNodeIndex++){
            // buffer the node coordinate (X_k)
            ScalarType t_nodeCoord[SpaceDim];
            for(int iDim=0; iDim<SpaceDim; iDim++){
@@ -457,11 +728,101 @@ class MovingLeastSquares {
              denominator += exp(-norm/(t_radius*t_radius));
            }
            ScalarType tInc = (denominator != 0) ? a_nodeValues(aNodeIndex) * numerator / denominator : 0.0;
-           aLocalResult += tInc;
-        }, tReturnVal);
-        t_mappedValuesHost(t_pointIndex) = tReturnVal;
-      }
-      Kokkos::deep_copy(a_mappedValues, t_mappedValuesHost);
+           tReturnVal += tInc;
+        }
+        a_mappedValues(t_pointIndex) = tReturnVal;
+      });
+    }
+
+  private:
+
+    void
+    mapToPointsWithinSupport(
+      ScalarArray<ScalarType> a_nodeCoords, 
+      ScalarVector<ScalarType> a_nodeValues, 
+      ScalarVector<ScalarType> a_mappedValues)
+    {
+      int tNumPoints = m_coords.extent(0);
+      int tNumNodes = a_nodeValues.size();
+      auto t_coords = m_coords;
+      auto t_radius = m_radius;
+      auto t_supportRadius = m_supportRadius;
+      auto t_pointIndex = m_pointIndex;
+
+      // compute denominators (sum_i e_{ki}) as in f, flagging the nodes that need all points
+      //
+      ScalarVector<ScalarType> t_denominators("denominators", tNumNodes);
+      ScalarVector<int> t_isFar("far node flags", tNumNodes);
+      Kokkos::parallel_for(Kokkos::RangePolicy<int>(0,tNumNodes),KOKKOS_LAMBDA(int aNodeIndex)
+      {
+        ScalarType t_nodeCoord[SpaceDim];
+        for(int iDim=0; iDim<SpaceDim; iDim++){
+          t_nodeCoord[iDim] = a_nodeCoords(aNodeIndex,iDim);
+        }
+        ScalarType denominator=0.0;
+        ScalarType t_nearest = t_supportRadius*t_supportRadius;
+        auto t_accumulate = [&](int, ScalarType norm)
+        {
+          denominator += exp(-norm/(t_radius*t_radius));
+          t_nearest = norm < t_nearest ? norm : t_nearest;
+        };
+        t_pointIndex.forEachPointWithin(t_nodeCoord, t_supportRadius, t_accumulate);
+
+        t_isFar(aNodeIndex) = 4.0*t_nearest > t_supportRadius*t_supportRadius ? 1 : 0;
+        if( t_isFar(aNodeIndex) ){
+          denominator=0.0;
+          for(int iPoint=0; iPoint<tNumPoints; iPoint++){
+            ScalarType norm=0.0;
+            for(int iDim=0; iDim<SpaceDim; iDim++){
+              norm += pow(t_nodeCoord[iDim]-t_coords(iPoint,iDim),2);
+            }
+            denominator += exp(-norm/(t_radius*t_radius));
+          }
+        }
+        t_denominators(aNodeIndex) = denominator;
+      });
+
+      int tNumFarNodes = 0;
+      Kokkos::parallel_reduce(Kokkos::RangePolicy<int>(0,tNumNodes),KOKKOS_LAMBDA(int aNodeIndex, int& aLocalResult)
+      {
+        aLocalResult += t_isFar(aNodeIndex);
+      }, tNumFarNodes);
+
+      ScalarVector<int> t_farNodes("far nodes", tNumFarNodes);
+      Kokkos::parallel_scan(Kokkos::RangePolicy<int>(0,tNumNodes),KOKKOS_LAMBDA(int aNodeIndex, int& aOffset, const bool aFinal)
+      {
+        if( aFinal && t_isFar(aNodeIndex) ) t_farNodes(aOffset) = aNodeIndex;
+        aOffset += t_isFar(aNodeIndex);
+      });
+
+      // gather e_{kl} / sum_i e_{ki} from the nodes within support of each point
+      //
+      PointGrid<SpaceDim,ScalarType> t_nodeIndex(a_nodeCoords, t_supportRadius);
+      Kokkos::parallel_for(Kokkos::RangePolicy<int>(0,tNumPoints),KOKKOS_LAMBDA(int t_pointIndex)
+      {
+        ScalarType t_pointCoord[SpaceDim];
+        for(int iDim=0; iDim<SpaceDim; iDim++){
+          t_pointCoord[iDim] = t_coords(t_pointIndex,iDim);
+        }
+        ScalarType tReturnVal(0.0);
+        auto t_accumulate = [&](int aNodeIndex, ScalarType norm)
+        {
+          if( t_isFar(aNodeIndex) || t_denominators(aNodeIndex) == 0.0 ) return;
+          tReturnVal += a_nodeValues(aNodeIndex) * exp(-norm/(t_radius*t_radius)) / t_denominators(aNodeIndex);
+        };
+        t_nodeIndex.forEachPointWithin(t_pointCoord, t_supportRadius, t_accumulate);
+
+        for(int iFar=0; iFar<tNumFarNodes; iFar++){
+          int aNodeIndex = t_farNodes(iFar);
+          if( t_denominators(aNodeIndex) == 0.0 ) continue;
+          ScalarType norm=0.0;
+          for(int iDim=0; iDim<SpaceDim; iDim++){
+            norm += pow(a_nodeCoords(aNodeIndex,iDim)-t_pointCoord[iDim],2);
+          }
+          tReturnVal += a_nodeValues(aNodeIndex) * exp(-norm/(t_radius*t_radius)) / t_denominators(aNodeIndex);
+        }
+        a_mappedValues(t_pointIndex) = tReturnVal;
+      });
     }
 };
 
@@ -50,6 +50,9 @@
 #include <sstream>
 #include <fstream>
 #include <stdio.h>
+#include <vector>
+#include <utility>
+#include <algorithm>
 #include "Plato_MLS.hpp"
 
 #include "pugixml.hpp"
@@ -671,5 +674,136 @@ namespace PlatoTestGeometryMLS
 #endif
     
   }
-}
 
+  TEST(PlatoTestGeometryMLS, MovingLeastSquaresSupportMatchesAllPoints3D)
+  {
+
+    int n1=12, n2=16, n3=4;
+    double s1=1.0, s2=4.0/3.0, s3=1.0/3.0, radius=0.05;
+
+    std::stringstream input;
+    input << "<PointArray>";
+    input << "  <N1>" << n1 << "</N1>";
+    input << "  <N2>" << n2 << "</N2>";
+    input << "  <N3>" << n3 << "</N3>";
+    input << "  <Size1>" << std::setprecision(18) << s1 << "</Size1>";
+    input << "  <Size2>" << std::setprecision(18) << s2 << "</Size2>";
+    input << "  <Size3>" << std::setprecision(18) << s3 << "</Size3>";
+    input << "  <Radius>" << std::setprecision(18) << radius << "</Radius>";
+    input << "</PointArray>";
+
+    Plato::Parser* parser = new Plato::PugiParser();
+    auto tInputData = parser->parseString(input.str());
+    delete parser;
+
+    constexpr int numDims=3;
+    auto tMLSParams = tInputData.get<Plato::InputData>("PointArray");
+    Plato::Geometry::MovingLeastSquares<numDims, double> mls(tMLSParams);
+
+    // nodes overhang the point grid so that some have no point within support
+    int m1=15, m2=19, m3=5;
+    int numNodes = m1*m2*m3;
+
+    Kokkos::View<double**, Plato::Layout, Kokkos::DefaultExecutionSpace::memory_space>
+      nodeCoords("coords", numNodes, numDims);
+
+    auto nodeCoordsHost = Kokkos::create_mirror_view(nodeCoords);
+
+    double d1 = 1.5*s1/(m1-1);
+    double d2 = 1.5*s2/(m2-1);
+    double d3 = 2.0*s3/(m3-1);
+    int nodeIndex = 0;
+    for(int i=0; i<m1; i++)
+      for(int j=0; j<m2; j++)
+        for(int k=0; k<m3; k++){
+          nodeCoordsHost(nodeIndex,0) = i*d1 - 0.25*s1;
+          nodeCoordsHost(nodeIndex,1) = j*d2 - 0.25*s2;
+          nodeCoordsHost(nodeIndex,2) = k*d3 - 0.5*s3;
+          nodeIndex++;
+        }
+    Kokkos::deep_copy(nodeCoords, nodeCoordsHost);
+
+    auto pointCoords = mls.getPointCoords();
+    auto numPoints = pointCoords.extent(0);
+    Kokkos::View<double*, Kokkos::DefaultExecutionSpace::memory_space>
+      pointValues("values", numPoints);
+
+    auto pointValuesHost = Kokkos::create_mirror_view(pointValues);
+
+    double pi = acos(-1.0);
+    for(decltype(numPoints) iPoint=0; iPoint<numPoints; iPoint++){
+      auto x = pointCoords(iPoint,0);
+      auto y = pointCoords(iPoint,1);
+      auto z = pointCoords(iPoint,2);
+      pointValuesHost(iPoint) = cos(2.0*pi*x)*cos(2.0*pi*y)*cos(2.0*pi*z);
+    }
+    Kokkos::deep_copy(pointValues, pointValuesHost);
+
+    Kokkos::View<double*, Kokkos::DefaultExecutionSpace::memory_space>
+      nodeValues("values", numNodes);
+
+    mls.f(pointValues, nodeCoords, nodeValues);
+
+    Kokkos::View<double*, Kokkos::DefaultExecutionSpace::memory_space>
+      mappedValues("values", numPoints);
+
+    mls.mapToPoints(nodeCoords, nodeValues, mappedValues);
+
+    auto nodeValuesHost = Kokkos::create_mirror_view(nodeValues);
+    Kokkos::deep_copy(nodeValuesHost, nodeValues);
+
+    auto mappedValuesHost = Kokkos::create_mirror_view(mappedValues);
+    Kokkos::deep_copy(mappedValuesHost, mappedValues);
+
+    // compare to sums over all points
+    std::vector<double> goldDenominators(numNodes, 0.0);
+    for(int iNode=0; iNode<numNodes; iNode++){
+      double numerator=0.0;
+      for(decltype(numPoints) iPoint=0; iPoint<numPoints; iPoint++){
+        double norm=0.0;
+        for(int iDim=0; iDim<numDims; iDim++){
+          norm += pow(nodeCoordsHost(iNode,iDim)-pointCoords(iPoint,iDim),2);
+        }
+        double kernelVal = exp(-norm/(radius*radius));
+        numerator += pointValuesHost(iPoint)*kernelVal;
+        goldDenominators[iNode] += kernelVal;
+      }
+      double gold = goldDenominators[iNode] != 0.0 ? numerator/goldDenominators[iNode] : 0.0;
+      EXPECT_NEAR(/*Gold=*/ gold, /*Result=*/ nodeValuesHost(iNode), /*tTolerance=*/1e-13);
+    }
+    for(decltype(numPoints) iPoint=0; iPoint<numPoints; iPoint++){
+      double gold=0.0;
+      for(int iNode=0; iNode<numNodes; iNode++){
+        double norm=0.0;
+        for(int iDim=0; iDim<numDims; iDim++){
+          norm += pow(nodeCoordsHost(iNode,iDim)-pointCoords(iPoint,iDim),2);
+        }
+        if( goldDenominators[iNode] != 0.0 ){
+          gold += nodeValuesHost(iNode)*exp(-norm/(radius*radius))/goldDenominators[iNode];
+        }
+      }
+      EXPECT_NEAR(/*Gold=*/ gold, /*Result=*/ mappedValuesHost(iPoint), /*tTolerance=*/1e-12);
+    }
+
+    // neighbors are sorted by distance, then by index
+    Plato::Geometry::NeighborMapper<numDims,double> tNeighborMapper(pointCoords);
+    int numNeighbors = 7;
+    auto t_map = tNeighborMapper.map( numNeighbors );
+    auto t_mapHost = Kokkos::create_mirror_view(t_map);
+    Kokkos::deep_copy(t_mapHost, t_map);
+    for(decltype(numPoints) iPoint=0; iPoint<numPoints; iPoint++){
+      std::vector<std::pair<double,int>> neighbors;
+      for(decltype(numPoints) jPoint=0; jPoint<numPoints; jPoint++){
+        double norm=0.0;
+        for(int iDim=0; iDim<numDims; iDim++){
+          norm += pow(pointCoords(jPoint,iDim)-pointCoords(iPoint,iDim),2);
+        }
+        neighbors.push_back(std::make_pair(norm, int(jPoint)));
+      }
+      std::sort(neighbors.begin(), neighbors.end());
+      for(int iNeighbor=0; iNeighbor<numNeighbors; iNeighbor++){
+        EXPECT_EQ(neighbors[iNeighbor].second, t_mapHost(iPoint,iNeighbor));
+      }
+    }
+  }
+}
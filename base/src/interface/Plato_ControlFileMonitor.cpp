@@ -0,0 +1,111 @@
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+//
+// *************************************************************************
+//@HEADER
+*/
+
+/*
+ * Plato_ControlFileMonitor.cpp
+ *
+ *  Created on: Oct 17, 2026
+ *
+ */
+
+#include <sys/stat.h>
+
+#include "Plato_Parser.hpp"
+#include "Plato_ControlFileMonitor.hpp"
+
+namespace Plato
+{
+
+/******************************************************************************/
+ControlFileMonitor::ControlFileMonitor(const std::string & aFileName, double aPollInterval) :
+        mFileName(aFileName),
+        mPollInterval(aPollInterval)
+/******************************************************************************/
+{
+}
+
+/******************************************************************************/
+bool ControlFileMonitor::terminateRequested()
+/******************************************************************************/
+{
+    auto tNow = std::chrono::steady_clock::now();
+    if(mHasChecked == false || std::chrono::duration<double>(tNow - mLastCheck).count() >= mPollInterval)
+    {
+        mHasChecked = true;
+        mLastCheck = tNow;
+        this->check();
+    }
+    return mTerminate;
+}
+
+/******************************************************************************/
+void ControlFileMonitor::check()
+/******************************************************************************/
+{
+    mNumChecks++;
+
+    struct stat tStatus;
+    if(stat(mFileName.c_str(), &tStatus) != 0)
+    {
+        mFileExists = false;
+        mTerminate = false;
+        return;
+    }
+
+    long long tModificationTime = static_cast<long long>(tStatus.st_mtim.tv_sec) * 1000000000LL + tStatus.st_mtim.tv_nsec;
+    long long tFileSize = static_cast<long long>(tStatus.st_size);
+    if(mFileExists && tModificationTime == mModificationTime && tFileSize == mFileSize)
+    {
+        return;
+    }
+
+    mFileExists = true;
+    mModificationTime = tModificationTime;
+    mFileSize = tFileSize;
+
+    mNumParses++;
+    Plato::PugiParser tParser;
+    auto tControlData = tParser.parseFile(mFileName);
+    mTerminate = Plato::Get::Bool(tControlData, "Terminate", false);
+}
+
+} // namespace Plato
@@ -0,0 +1,106 @@
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+//
+// *************************************************************************
+//@HEADER
+*/
+
+/*
+ * Plato_ControlFileMonitor.hpp
+ *
+ *  Created on: Oct 17, 2026
+ *
+ */
+
+#ifndef SRC_CONTROLFILEMONITOR_HPP_
+#define SRC_CONTROLFILEMONITOR_HPP_
+
+#include <chrono>
+#include <string>
+
+namespace Plato
+{
+
+/******************************************************************************//**
+ * \brief Watches the run control file (plato.control) for a termination request.
+ * The file is checked at most once per poll interval and only parsed again when
+ * its modification time or size changed, so asking before every stage is cheap.
+**********************************************************************************/
+class ControlFileMonitor
+{
+public:
+    /******************************************************************************//**
+     * \brief Constructor
+     * \param [in] aFileName     control file name
+     * \param [in] aPollInterval minimum number of seconds between file system checks
+    **********************************************************************************/
+    explicit ControlFileMonitor(const std::string & aFileName = "plato.control", double aPollInterval = 1.0);
+
+    /******************************************************************************//**
+     * \brief Return true if the control file requests termination. Between checks
+     * the answer of the last check is returned.
+    **********************************************************************************/
+    bool terminateRequested();
+
+    void setPollInterval(double aPollInterval) { mPollInterval = aPollInterval; }
+    double getPollInterval() const { return mPollInterval; }
+
+    int getNumChecks() const { return mNumChecks; }
+    int getNumParses() const { return mNumParses; }
+
+private:
+    void check();
+
+    std::string mFileName;
+    double mPollInterval;
+
+    bool mHasChecked = false;
+    std::chrono::steady_clock::time_point mLastCheck;
+
+    bool mFileExists = false;
+    long long mModificationTime = 0;
+    long long mFileSize = 0;
+    bool mTerminate = false;
+
+    int mNumChecks = 0;
+    int mNumParses = 0;
+};
+
+} // namespace Plato
+
+#endif
@@ -48,11 +48,12 @@
  */
 
 #include <limits>
+#include <cassert>
+#include <algorithm>
 #include <vector>
 #include <string>
 #include <cstdlib>
 #include <stdlib.h>
-#include <fstream>
 
 #include "Plato_Interface.hpp"
 #include "Plato_InputData.hpp"
@@ -87,6 +88,21 @@ int performerID()
         return -1;
     }
 }
+
+/// @return Minimum number of seconds between checks of the plato.control file.
+/// This value (PLATO_CONTROL_POLL_INTERVAL) is optional and defaults to one second.
+double controlPollInterval()
+{
+    const char* const tIntervalChar = getenv("PLATO_CONTROL_POLL_INTERVAL");
+    if(tIntervalChar)
+    {
+        return atof(tIntervalChar);
+    }
+    else
+    {
+        return 1.0;
+    }
+}
 }
 
 /******************************************************************************/
@@ -98,6 +114,7 @@ Interface::Interface(MPI_Comm aGlobalComm) :
 {
     createPerformers();
     initializeConsole();
+    mControlFileMonitor.setPollInterval(controlPollInterval());
 }
 
 /******************************************************************************/
@@ -110,6 +127,7 @@ Interface::Interface(const XMLFileName& aFileName, const XMLNodeName& aNodeName,
     Plato::loadFromXML(*this, aFileName, aNodeName);
     initializePerformerMPI();
     initializeConsole();
+    mControlFileMonitor.setPollInterval(controlPollInterval());
 }
 
 /******************************************************************************/
@@ -128,6 +146,16 @@ Interface::Interface(const int & aCommID, const std::string & aXML_String, MPI_C
 
     createPerformers();
     initializeConsole();
+    mControlFileMonitor.setPollInterval(controlPollInterval());
+}
+
+/******************************************************************************/
+Interface::Interface(const Plato::InputData & aInputData, MPI_Comm aGlobalComm) :
+        mInputData(aInputData),
+        mLocalComm(aGlobalComm),
+        mGlobalComm(aGlobalComm)
+/******************************************************************************/
+{
 }
 
 /******************************************************************************/
@@ -145,9 +173,16 @@ Plato::InputData Interface::getInputData() const
 }
 
 /******************************************************************************/
-int Interface::getStageIndex(std::string aStageName) const
+int Interface::getStageIndex(const std::string & aStageName) const
 /******************************************************************************/
 {
+    if(mStageIndices.size() == mStages.size())
+    {
+        auto tIterator = mStageIndices.find(aStageName);
+        return tIterator == mStageIndices.end() ? -1 : tIterator->second;
+    }
+
+    // stages were added after the last indexStages()
     for(size_t tIndex = 0; tIndex < mStages.size(); ++tIndex)
     {
         if(mStages[tIndex]->getName() == aStageName)
@@ -159,22 +194,64 @@ int Interface::getStageIndex(std::string aStageName) const
 }
 
 /******************************************************************************/
-void Interface::broadcastStageIndex(int & aStageIndex)
+void Interface::indexStages()
+/******************************************************************************/
+{
+    mStageIndices.clear();
+    for(size_t tIndex = 0; tIndex < mStages.size(); ++tIndex)
+    {
+        // first stage with a given name wins, as in a linear search
+        mStageIndices.insert(std::make_pair(mStages[tIndex]->getName(), static_cast<int>(tIndex)));
+    }
+}
+
+/******************************************************************************/
+void Interface::broadcastStagePlan(std::vector<int> & aStagePlan)
 /******************************************************************************/
 {
-    MPI_Bcast(&aStageIndex, 1, MPI_INT, 0, mGlobalComm);
+    // One message holds the number of stages to run, the stage_index_t code that
+    // ends the plan (zero if none) and the indices of the stages to run. Stages
+    // requested before an invalid or terminate stage still run. Rank 0 of the
+    // global comm sends.
+    int tMessage[MAX_STAGE_PLAN_LENGTH + 2] = {0};
+    int tMyRank = 0;
+    MPI_Comm_rank(mGlobalComm, &tMyRank);
+    if(tMyRank == 0)
+    {
+        assert(aStagePlan.size() <= static_cast<size_t>(MAX_STAGE_PLAN_LENGTH));
+        auto tCode = std::find_if(aStagePlan.begin(), aStagePlan.end(), [](int aIndex){ return aIndex < 0; });
+        tMessage[0] = static_cast<int>(std::distance(aStagePlan.begin(), tCode));
+        tMessage[1] = tCode != aStagePlan.end() ? *tCode : 0;
+        std::copy(aStagePlan.begin(), tCode, tMessage + 2);
+    }
+
+    MPI_Bcast(tMessage, MAX_STAGE_PLAN_LENGTH + 2, MPI_INT, 0, mGlobalComm);
+
+    aStagePlan.assign(tMessage + 2, tMessage + 2 + tMessage[0]);
+    if(tMessage[1] < 0)
+    {
+        aStagePlan.push_back(tMessage[1]);
+    }
+    this->handleExceptions();
+}
 
-    if(aStageIndex == INVALID_STAGE)
+/******************************************************************************/
+void Interface::endStagePlan(int aStageCode)
+/******************************************************************************/
+{
+    // every rank reaches the code of a plan once the stages before it have run
+    mIsDone = true;
+    if(aStageCode == INVALID_STAGE)
     {
         std::stringstream tMsg;
-        tMsg << "\n\n ********** PLATO ERROR: Interface::broadcastStageIndex: Invalid stage requested.\n\n";
+        tMsg << "\n\n ********** PLATO ERROR: Interface::endStagePlan: Invalid stage requested.\n\n";
         Plato::ParsingException tParsingException(tMsg.str());
         registerException(tParsingException);
     } else
-    if(aStageIndex == TERMINATE_STAGE)
+    if(aStageCode == TERMINATE_STAGE)
     {
         std::stringstream tMsg;
-        tMsg << "\n\n INFO: Interface::broadcastStageIndex: Terminate stage requested.  Exiting.\n\n";
+        tMsg << "\n\n INFO: Interface::endStagePlan: Terminate stage requested.  Exiting.\n\n";
         Plato::TerminateSignal tTerminateSignal(tMsg.str());
         registerException(tTerminateSignal);
     }
@@ -182,43 +259,45 @@ void Interface::broadcastStageIndex(int & aStageIndex)
 }
 
 /******************************************************************************/
-Plato::Stage*
-Interface::getStage(std::string aStageName)
+std::vector<int>
+Interface::getStagePlan(const std::vector<std::string> & aStageNames)
 /******************************************************************************/
 {
-    // check for control file
-    std::ifstream tControlFile;
-    tControlFile.open("plato.control");
-    if(tControlFile)
-    {
-        Plato::Parser* parser = new Plato::PugiParser();
-        auto tControlData = parser->parseFile("plato.control");
-        delete parser;
-
-        auto tTerminate = Plato::Get::Bool(tControlData, "Terminate", false);
+    // only the sending rank's answer matters, see broadcastStagePlan
+    int tMyRank = 0;
+    MPI_Comm_rank(mGlobalComm, &tMyRank);
 
-        if(tTerminate)
+    std::vector<int> tStagePlan;
+    if(tMyRank == 0 && mControlFileMonitor.terminateRequested())
+    {
+        tStagePlan.push_back(TERMINATE_STAGE);
+    }
+    else
+    {
+        for(const std::string & tStageName : aStageNames)
         {
-            aStageName = "Terminate";
+            tStagePlan.push_back(tStageName == "Terminate" ? TERMINATE_STAGE : getStageIndex(tStageName));
         }
     }
 
-    // broadcast the index of the next stage
-    int tStageIndex;
-    if(aStageName == "Terminate")
-        tStageIndex = TERMINATE_STAGE;
-    else
-        tStageIndex = getStageIndex(aStageName);
-
-    broadcastStageIndex(tStageIndex);
+    // broadcast the indices of the next stages
+    broadcastStagePlan(tStagePlan);
+    return tStagePlan;
+}
 
-    if(tStageIndex >= 0)
+/******************************************************************************/
+Plato::Stage*
+Interface::getStage(std::string aStageName)
+/******************************************************************************/
+{
+    std::vector<int> tStagePlan = getStagePlan(std::vector<std::string>(1, aStageName));
+    if(tStagePlan.front() >= 0)
     {
-        return mStages[tStageIndex];
+        return mStages[tStagePlan.front()];
     }
     else
     {
-        mIsDone = true;
+        this->endStagePlan(tStagePlan.front());
         return nullptr;
     }
 }
@@ -228,18 +307,21 @@ Plato::Stage*
 Interface::getStage()
 /******************************************************************************/
 {
-    // broadcast the index of the next stage
-    int tStageIndex;
-
-    broadcastStageIndex(tStageIndex);
+    // receive the next plan once the stages of the last one have been run
+    while(mStagePlanPosition >= mStagePlan.size())
+    {
+        broadcastStagePlan(mStagePlan);
+        mStagePlanPosition = 0;
+    }
 
+    int tStageIndex = mStagePlan[mStagePlanPosition++];
     if(tStageIndex >= 0)
     {
         return mStages[tStageIndex];
     }
     else
     {
-        mIsDone = true;
+        this->endStagePlan(tStageIndex);
         return nullptr;
     }
 }
@@ -351,11 +433,18 @@ void Interface::perform(Plato::Stage* aStage)
         while(tOperation)
         {
             // Console::Status("Perform Operation: (" + mPerformer->myName() + ") " + tOperation->getOperationName());
+
+            // complete pending stage transfers of the data this operation touches
+            //
+            std::vector<std::string> tOperationInputDataNames = tOperation->getInputDataNames();
+            std::vector<std::string> tOperationOutputDataNames = tOperation->getOutputDataNames();
+            aStage->waitForData(tOperationInputDataNames);
+            aStage->waitForData(tOperationOutputDataNames);
+
             tOperation->sendInput();
 
             // copy data from Plato::SharedData buffers to hostedCode data containers
             //
-            std::vector<std::string> tOperationInputDataNames = tOperation->getInputDataNames();
             for(std::string tName : tOperationInputDataNames)
             {
                 try
@@ -381,7 +470,6 @@ void Interface::perform(Plato::Stage* aStage)
 
             // copy data from hostedCode data containers to Plato::SharedData buffers
             //
-            std::vector<std::string> tOperationOutputDataNames = tOperation->getOutputDataNames();
             for(std::string tName : tOperationOutputDataNames)
             {
                 try
@@ -425,9 +513,26 @@ void Interface::finalize( std::string aStageName )
 void Interface::compute(const std::vector<std::string> & aStageNames, Teuchos::ParameterList& aArguments)
 /******************************************************************************/
 {
-    for(const std::string & tStageName : aStageNames)
+    // the performers receive the whole sequence in one broadcast
+    for(size_t tBegin = 0; tBegin < aStageNames.size(); tBegin += MAX_STAGE_PLAN_LENGTH)
     {
-        this->compute(tStageName, aArguments);
+        size_t tEnd = std::min(aStageNames.size(), tBegin + MAX_STAGE_PLAN_LENGTH);
+        std::vector<std::string> tStageNames(aStageNames.begin() + tBegin, aStageNames.begin() + tEnd);
+        std::vector<int> tStagePlan = this->getStagePlan(tStageNames);
+        for(size_t tIndex = 0; tIndex < tStagePlan.size(); tIndex++)
+        {
+            if(tStagePlan[tIndex] < 0)
+            {
+                this->endStagePlan(tStagePlan[tIndex]);
+
+                std::stringstream tMsg;
+                tMsg << "\n\n ********** PLATO ERROR: Interface::compute: Invalid stage requested: " << tStageNames[tIndex] << "\n\n";
+                Plato::ParsingException tParsingException(tMsg.str());
+                registerException(tParsingException);
+                return;
+            }
+            this->computeStage(mStages[tStagePlan[tIndex]], aArguments);
+        }
     }
 }
 
@@ -435,32 +540,28 @@ void Interface::compute(const std::vector<std::string> & aStageNames, Teuchos::P
 void Interface::compute(const std::string & aStageName, Teuchos::ParameterList& aArguments)
 /******************************************************************************/
 {
-    // Console::Status("Compute Stage: (" + mPerformer->myName() + ") " + aStageName);
-
-    // Find the requested stage
-    Plato::Stage* tStage = getStage(aStageName);
+    this->compute(std::vector<std::string>(1, aStageName), aArguments);
+}
 
-    if( tStage == nullptr )
-    {
-        std::stringstream tMsg;
-        tMsg << "\n\n ********** PLATO ERROR: Interface::compute: Invalid stage requested: " << aStageName << "\n\n";
-        Plato::ParsingException tParsingException(tMsg.str());
-        registerException(tParsingException);
-    }
+/******************************************************************************/
+void Interface::computeStage(Plato::Stage* aStage, Teuchos::ParameterList& aArguments)
+/******************************************************************************/
+{
+    // Console::Status("Compute Stage: (" + mPerformer->myName() + ") " + aStage->getName());
 
     // Unpack input arguments into Plato::SharedData
     //
-    std::vector<std::string> tStageInputDataNames = tStage->getInputDataNames();
+    std::vector<std::string> tStageInputDataNames = aStage->getInputDataNames();
     for(std::string tName : tStageInputDataNames)
     {
         exportData(aArguments.get<double*>(tName), mDataLayer->getSharedData(tName));
     }
 
-    this->perform(tStage);
+    this->perform(aStage);
 
     // Unpack output arguments from Plato::SharedData
     //
-    std::vector<std::string> tStageOutputDataNames = tStage->getOutputDataNames();
+    std::vector<std::string> tStageOutputDataNames = aStage->getOutputDataNames();
     for(std::string tName : tStageOutputDataNames)
     {
         importData(aArguments.get<double*>(tName), mDataLayer->getSharedData(tName));
@@ -471,6 +572,12 @@ void Interface::compute(const std::string & aStageName, Teuchos::ParameterList&
 void Interface::exportData(double* aFrom, Plato::SharedData* aTo)
 /******************************************************************************/
 {
+    // unchanged values leave the version alone, so their transfer can be skipped
+    if(aTo->copyToSendBuffer(aFrom))
+    {
+        return;
+    }
+
     int tMyLength = aTo->size();
     std::vector<double> tExportData(tMyLength);
     std::copy(aFrom, aFrom + tMyLength, tExportData.begin());
@@ -482,6 +589,13 @@ void Interface::importData(double* aTo, Plato::SharedData* aFrom)
 /******************************************************************************/
 {
     int tMyLength = aFrom->size();
+    const double* tRecvBuffer = aFrom->getRecvBuffer();
+    if(tRecvBuffer != nullptr)
+    {
+        std::copy(tRecvBuffer, tRecvBuffer + tMyLength, aTo);
+        return;
+    }
+
     std::vector<double> tImportData(tMyLength);
     aFrom->getData(tImportData);
     std::copy(tImportData.begin(), tImportData.end(), aTo);
@@ -503,6 +617,7 @@ void Interface::registerApplicationOnlyInitializeMPI(Application* aApplication)
 {
     checkAndSetApplication(aApplication);
     setPerformerOnStages();
+    indexStages();
     initializeSharedDataMPI(aApplication);
 }
 
@@ -527,6 +642,8 @@ void Interface::createStages()
         Plato::Stage* tNewStage = new Plato::Stage(tStageInputDataMng, mPerformer, mDataLayer->getSharedData());
         mStages.push_back(tNewStage);
     }
+
+    indexStages();
 }
 
 /******************************************************************************/
@@ -606,11 +723,14 @@ void Interface::createSharedData(Plato::Application* const aApplication)
     CommunicationData tCommunicationData;
     getSharedDataAndCommunicationInfo(aApplication, tSharedDataInfo, tCommunicationData);
 
+    // hand the communication plans on so unchanged field layouts are not rebuilt
+    std::shared_ptr<Plato::CommunicationPlanCache> tPlanCache;
     if(mDataLayer)
     {
+        tPlanCache = mDataLayer->getCommunicationPlanCache();
         delete mDataLayer;
     }
-    mDataLayer = new Plato::DataLayer(tSharedDataInfo, tCommunicationData);
+    mDataLayer = new Plato::DataLayer(tSharedDataInfo, tCommunicationData, tPlanCache);
 }
 
 /******************************************************************************/
@@ -939,6 +1059,7 @@ Interface::~Interface()
 {
     if(mDataLayer)
     {
+        mDataLayer->reportTransmissions();
         delete mDataLayer;
         mDataLayer = nullptr;
     }
@@ -57,6 +57,7 @@
 #include <mpi.h>
 #include <vector>
 #include <string>
+#include <unordered_map>
 
 #include "Plato_Parser.hpp"
 #include "Plato_DataLayer.hpp"
@@ -65,6 +66,7 @@
 #include "Plato_Console.hpp"
 
 #include "Plato_Stage.hpp"
+#include "Plato_ControlFileMonitor.hpp"
 
 #include "Plato_SerializationHeaders.hpp"
 #include "Plato_SerializationLoadSave.hpp"
@@ -84,6 +86,9 @@ enum stage_index_t
     TERMINATE_STAGE = -1
 };
 
+// maximum number of stages sent in one stage plan broadcast
+constexpr int MAX_STAGE_PLAN_LENGTH = 31;
+
 struct PerformerInfo
 {
     std::vector<std::string> mNames;
@@ -131,7 +136,7 @@ struct SharedDataSerializedInfo
  This should be separated into two virtual bases.
  */
 /******************************************************************************/
-class Interface final
+class Interface
 {
 public:
     explicit Interface(MPI_Comm aGlobalComm = MPI_COMM_WORLD);
@@ -139,7 +144,7 @@ public:
     /// @a aFileName, and assumes the data with XML tag @a aNodeName.
     Interface(const XMLFileName& aFileName, const XMLNodeName& aNodeName, MPI_Comm aGlobalComm = MPI_COMM_WORLD);
     Interface(const int & aCommID, const std::string & a_XML_String, MPI_Comm aGlobalComm = MPI_COMM_WORLD);
-    ~Interface();
+    virtual ~Interface();
 
     void registerApplication(Plato::Application* aApplication);
 
@@ -153,7 +158,7 @@ public:
     void run();
     void perform();
     void compute(const std::string & stageName, Teuchos::ParameterList & aArguments);
-    void compute(const std::vector<std::string> & stageNames, Teuchos::ParameterList & aArguments);
+    virtual void compute(const std::vector<std::string> & stageNames, Teuchos::ParameterList & aArguments);
     void finalize( std::string aStageName = std::string() );
 
     // data motion
@@ -202,13 +207,22 @@ public:
     template<typename F>
     void tryFCatchInterfaceExceptions(const F& aF);
 
+protected:
+    /// This ctor only holds @a aInputData; it creates no performers, shared data or stages.
+    /// It lets test doubles that override compute stand in for the interface.
+    explicit Interface(const Plato::InputData & aInputData, MPI_Comm aGlobalComm = MPI_COMM_WORLD);
+
 private:
     void perform(Plato::Stage* aStage);
-    void broadcastStageIndex(int & aStageIndex);
+    void computeStage(Plato::Stage* aStage, Teuchos::ParameterList& aArguments);
+    void broadcastStagePlan(std::vector<int> & aStagePlan);
+    void endStagePlan(int aStageCode);
 
     Plato::Stage* getStage();
     Plato::Stage* getStage(std::string aStageName);
-    int getStageIndex(std::string aStageName) const;
+    std::vector<int> getStagePlan(const std::vector<std::string> & aStageNames);
+    int getStageIndex(const std::string & aStageName) const;
+    void indexStages();
 
     void updateStages();
     void createPerformers();
@@ -237,6 +251,13 @@ private:
 
     std::shared_ptr<Plato::Performer> mPerformer;
     std::vector<Plato::Stage*> mStages;
+    std::unordered_map<std::string, int> mStageIndices;
+
+    // stages of the last broadcast plan that this performer has yet to run
+    std::vector<int> mStagePlan;
+    size_t mStagePlanPosition = 0;
+
+    Plato::ControlFileMonitor mControlFileMonitor;
 
     Plato::ExceptionHandler* mExceptionHandler = nullptr;
 
@@ -88,6 +88,8 @@ initialize(const Plato::OperationInputDataMng & aOperationDataMng,
     m_inputData.clear();
     m_outputData.clear();
     m_argumentNames.clear();
+    m_computedInputVersions.clear();
+    m_skipUnchangedInputs = Plato::Get::Bool(aOperationDataMng, "SkipUnchangedInputs", false);
 
     const int tNumSubOperations = aOperationDataMng.getNumOperations();
     for(int tSubOperationIndex = 0; tSubOperationIndex < tNumSubOperations; tSubOperationIndex++)
@@ -101,6 +101,8 @@ Operation::
 sendInput()
 /******************************************************************************/
 {
+  // inputs are usually transmitted by the stage already, so unchanged fields are skipped
+  Plato::SharedField::skipUnchangedTransfers(m_inputData);
   for( SharedData* sd : m_inputData )
     sd->transmitData();
 }
@@ -111,6 +113,7 @@ Operation::
 sendOutput()
 /******************************************************************************/
 {
+  Plato::SharedField::skipUnchangedTransfers(m_outputData);
   for( SharedData* sd : m_outputData )
     sd->transmitData();
 }
@@ -149,6 +152,10 @@ compute()
 {
   if(m_performer)
   {
+     if( inputsUnchangedSinceCompute() )
+     {
+       return;
+     }
      for( auto p : m_parameters )
      {
        m_performer->importData(p.first, *(p.second));
@@ -157,6 +164,44 @@ compute()
   }
 }
 
+/******************************************************************************/
+bool
+Operation::
+inputsUnchangedSinceCompute()
+/******************************************************************************/
+{
+  if( m_skipUnchangedInputs == false )
+  {
+    return false;
+  }
+
+  // imported versions only count transfers that moved data and agree on every rank,
+  // so all ranks of the performer make the same decision
+  std::vector<unsigned long long> tVersions;
+  for( SharedData* sd : m_inputData )
+  {
+    if( m_argumentNames.count(sd->myName()) == 0 )
+    {
+      continue;
+    }
+    auto tField = dynamic_cast<Plato::SharedField*>(sd);
+    if( tField == nullptr )
+    {
+      // values carry no version, so they always count as changed
+      m_computedInputVersions.clear();
+      return false;
+    }
+    tVersions.push_back(tField->getImportedVersion());
+  }
+
+  if( tVersions.empty() == false && tVersions == m_computedInputVersions )
+  {
+    return true;
+  }
+  m_computedInputVersions = tVersions;
+  return false;
+}
+
 /******************************************************************************/
 void
 Operation::
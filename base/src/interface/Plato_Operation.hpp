@@ -95,6 +95,7 @@ public:
     setParameterValue(std::string paramName, double paramValue)
     {
         m_parameters[paramName]->setData({1,paramValue});
+        m_computedInputVersions.clear();
     }
 
     void setPerformer(std::shared_ptr<Performer> aPerformer);
@@ -108,6 +109,7 @@ public:
         aArchive & boost::serialization::make_nvp("InputData", m_inputData);
         aArchive & boost::serialization::make_nvp("OutputData", m_outputData);
         aArchive & boost::serialization::make_nvp("Parameters", m_parameters);
+        aArchive & boost::serialization::make_nvp("SkipUnchangedInputs", m_skipUnchangedInputs);
     } 
 
     class Parameter : public Plato::SharedData {
@@ -154,6 +156,8 @@ protected:
                      const std::vector<Plato::SharedData*>& aSharedData,
                      std::vector<Plato::SharedData*>& aLocalData);
 
+    bool inputsUnchangedSinceCompute();
+
     std::map<std::string,Plato::SharedData*> m_parameters;
 
     std::shared_ptr<Performer> m_performer;
@@ -164,6 +168,10 @@ protected:
     std::vector<Plato::SharedData*> m_outputData;
 
     std::multimap<std::string, std::string> m_argumentNames;
+
+    /// Skip the compute when none of the performer's input fields changed since its last compute.
+    bool m_skipUnchangedInputs = false;
+    std::vector<unsigned long long> m_computedInputVersions;
 };
 } // End namespace Plato
 
@@ -100,6 +100,8 @@ initialize(const Plato::OperationInputDataMng & aOperationDataMng,
     m_inputData.clear();
     m_outputData.clear();
     m_argumentNames.clear();
+    m_computedInputVersions.clear();
+    m_skipUnchangedInputs = Plato::Get::Bool(aOperationDataMng, "SkipUnchangedInputs", false);
 
     m_performerName = aOperationDataMng.getPerformerName();
     m_operationName = aOperationDataMng.getOperationName(m_performerName);
@@ -51,9 +51,11 @@
 #include "Plato_Operation.hpp"
 #include "Plato_OperationFactory.hpp"
 #include "Plato_SharedData.hpp"
+#include "Plato_SharedField.hpp"
 #include "Plato_Performer.hpp"
 #include "Plato_Exceptions.hpp"
 #include "Plato_Utils.hpp"
+#include "Plato_Parser.hpp"
 #include "Plato_StageInputDataMng.hpp"
 #include "Plato_OperationInputDataMng.hpp"
 
@@ -69,7 +71,8 @@ namespace Plato
 Stage::Stage(const Plato::StageInputDataMng & aStageInputData,
              const std::shared_ptr<Plato::Performer> aPerformer,
              const std::vector<Plato::SharedData*>& aSharedData) :
-        m_name(aStageInputData.getStageName())
+        m_name(aStageInputData.getStageName()),
+        m_batchTransmission(Plato::Get::Bool(aStageInputData, "BatchTransmission", false))
 /******************************************************************************/
 {
     initializeSharedData(aStageInputData, aSharedData);
@@ -171,6 +174,19 @@ void Stage::initializeSharedData(const Plato::StageInputDataMng & aStageInputDat
         }
     }
 
+    if(m_batchTransmission)
+    {
+        this->initializeBatches();
+    }
+}
+
+/******************************************************************************/
+void Stage::initializeBatches()
+/******************************************************************************/
+{
+    m_inputBatch.initialize(m_inputData);
+    m_outputBatch.initialize(m_outputData);
+    m_batchesInitialized = true;
 }
 
 /******************************************************************************/
@@ -201,9 +217,22 @@ std::vector<std::string> Stage::getOutputDataNames() const
 void Stage::begin()
 /******************************************************************************/
 {
-    for(Plato::SharedData* tSharedData : m_inputData)
+    if(m_batchTransmission)
+    {
+        if(m_batchesInitialized == false)
+        {
+            this->initializeBatches();
+        }
+        // operations wait only on the inputs they use, see waitForData
+        m_inputBatch.post();
+    }
+    else
     {
-        tSharedData->transmitData();
+        Plato::SharedField::skipUnchangedTransfers(m_inputData);
+        for(Plato::SharedData* tSharedData : m_inputData)
+        {
+            tSharedData->transmitData();
+        }
     }
     // reset to first operation
     currentOperationIndex = 0;
@@ -227,9 +256,29 @@ Stage::getNextOperation()
 void Stage::end()
 /******************************************************************************/
 {
-    for(Plato::SharedData* tSharedData : m_outputData)
+    if(m_batchTransmission)
+    {
+        m_inputBatch.waitAll();
+        m_outputBatch.post();
+        m_outputBatch.waitAll();
+    }
+    else
+    {
+        Plato::SharedField::skipUnchangedTransfers(m_outputData);
+        for(Plato::SharedData* tSharedData : m_outputData)
+        {
+            tSharedData->transmitData();
+        }
+    }
+}
+
+/******************************************************************************/
+void Stage::waitForData(const std::vector<std::string> & aNames)
+/******************************************************************************/
+{
+    if(m_batchTransmission)
     {
-        tSharedData->transmitData();
+        m_inputBatch.wait(aNames);
     }
 }
 
@@ -56,6 +56,7 @@
 
 #include "Plato_Operation.hpp"
 #include "Plato_SharedData.hpp"
+#include "Plato_SharedDataBatch.hpp"
 #include "Plato_SerializationHeaders.hpp"
 
 namespace Plato
@@ -86,6 +87,13 @@ public:
     void begin();
     void end();
 
+    /******************************************************************************//**
+     * \brief Wait on pending batched transmissions of the named shared data. No-op
+     * unless the stage uses batch transmission.
+     * \param [in] aNames shared data names
+    **********************************************************************************/
+    void waitForData(const std::vector<std::string> & aNames);
+
     std::string getName() const
     {
         return m_name;
@@ -104,11 +112,13 @@ public:
         aArchive & boost::serialization::make_nvp("InputData",m_inputData);
         aArchive & boost::serialization::make_nvp("OutputData",m_outputData);
         aArchive & boost::serialization::make_nvp("CurrentOperationIndex",currentOperationIndex);
+        aArchive & boost::serialization::make_nvp("BatchTransmission",m_batchTransmission);
     }
 
 private:
     void initializeSharedData(const Plato::StageInputDataMng & aStageInputData,
                               const std::vector<Plato::SharedData*>& aSharedData);
+    void initializeBatches();
 
     std::string m_name;
     std::vector<Plato::Operation*> m_operations;
@@ -116,6 +126,12 @@ private:
     std::vector<Plato::SharedData*> m_outputData;
 
     int currentOperationIndex = 0;
+
+    bool m_batchTransmission = false;
+    // batches are not archived; a loaded stage builds them on its first begin()
+    bool m_batchesInitialized = false;
+    Plato::SharedDataBatch m_inputBatch;
+    Plato::SharedDataBatch m_outputBatch;
 };
 
 } // End namespace Plato
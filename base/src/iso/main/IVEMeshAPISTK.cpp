@@ -61,6 +61,7 @@
 #include <stk_io/StkMeshIoBroker.hpp>
 #include <stk_mesh/base/Types.hpp>
 #include <stk_mesh/base/FieldRestriction.hpp>
+#include <stk_mesh/base/FEMHelpers.hpp>
 #ifdef BUILD_IN_SIERRA
 #include <stk_mesh/base/MeshBuilder.hpp>
 #endif
@@ -892,6 +893,146 @@ bool IVEMeshAPISTK::read_exodus_mesh( std::string &meshfile, std::string &fieldn
   return true;
 }
 
+bool IVEMeshAPISTK::build_mesh_from_data( const IVEMeshData &mesh_data, std::string &fieldname,
+                                          std::string &outputFieldsString )
+{
+  // element blocks
+  std::vector<stk::mesh::Part*> block_parts;
+  for(size_t b=0; b<mesh_data.blocks.size(); ++b)
+  {
+    const IVEBlockData &block = mesh_data.blocks[b];
+    stk::topology block_top = stk::topology::HEX_8;
+    if(block.topology == "TET4")
+      block_top = stk::topology::TET_4;
+    else if(block.topology != "HEX8")
+    {
+      std::cout << "Unsupported element type " << block.topology << " in block " << block.id << "." << std::endl;
+      return false;
+    }
+    std::string block_name = "block_" + std::to_string(block.id);
+    stk::mesh::Part *block_part = &mMetaData->declare_part_with_topology(block_name, block_top);
+    stk::io::put_io_part_attribute(*block_part);
+    block_parts.push_back(block_part);
+  }
+
+  // coordinates and the fields carried by the mesh data
+#ifdef BUILD_IN_SIERRA // GLAZE1
+  mCoordsField = (stk::mesh::Field<double>*)(&(mMetaData->
+                declare_field<double>(stk::topology::NODE_RANK, "coordinates")));
+  stk::mesh::put_field_on_entire_mesh(*mCoordsField, mMetaData->spatial_dimension());
+#else
+  mCoordsField = (stk::mesh::Field<double, stk::mesh::Cartesian>*)(&(mMetaData->
+                declare_field<stk::mesh::Field<double, stk::mesh::Cartesian> >
+                            (stk::topology::NODE_RANK, "coordinates")));
+  stk::mesh::put_field_on_entire_mesh(*mCoordsField);
+#endif
+  mMetaData->set_coordinate_field(mCoordsField);
+
+  std::map<std::string, std::vector<double> >::const_iterator it;
+  for(it = mesh_data.nodal_fields.begin(); it != mesh_data.nodal_fields.end(); ++it)
+  {
+#ifdef BUILD_IN_SIERRA // GLAZE1
+    stk::mesh::Field<double> *cur_field = &mMetaData->declare_field<double>(stk::topology::NODE_RANK, it->first, 1);
+#else
+    stk::mesh::Field<double> *cur_field = &mMetaData->declare_field<stk::mesh::Field<double> >(stk::topology::NODE_RANK, it->first, 1);
+#endif
+    stk::mesh::put_field_on_entire_mesh(*cur_field);
+  }
+  for(it = mesh_data.element_fields.begin(); it != mesh_data.element_fields.end(); ++it)
+  {
+#ifdef BUILD_IN_SIERRA // GLAZE1
+    stk::mesh::Field<double> *cur_field = &mMetaData->declare_field<double>(stk::topology::ELEMENT_RANK, it->first, 1);
+#else
+    stk::mesh::Field<double> *cur_field = &mMetaData->declare_field<stk::mesh::Field<double> >(stk::topology::ELEMENT_RANK, it->first, 1);
+#endif
+    stk::mesh::put_field_on_entire_mesh(*cur_field);
+  }
+
+  get_output_fields(outputFieldsString);
+
+  prepare_to_create_tris();
+
+  mMetaData->commit();
+
+  // elements and the nodes they reference, then the nodes shared with other processors
+  mBulkData->modification_begin();
+  for(size_t b=0; b<mesh_data.blocks.size(); ++b)
+  {
+    const IVEBlockData &block = mesh_data.blocks[b];
+    stk::mesh::EntityIdVector elem_node_ids(block.nodes_per_elem);
+    for(size_t e=0; e<block.elem_ids.size(); ++e)
+    {
+      for(int n=0; n<block.nodes_per_elem; ++n)
+        elem_node_ids[n] = mesh_data.node_ids[block.connectivity[e*block.nodes_per_elem+n]];
+      stk::mesh::declare_element(*mBulkData, *block_parts[b], block.elem_ids[e], elem_node_ids);
+    }
+  }
+  for(size_t i=0; i<mesh_data.shared_nodes.size(); ++i)
+  {
+    stk::mesh::Entity cur_node = mBulkData->get_entity(stk::topology::NODE_RANK,
+                                                       mesh_data.node_ids[mesh_data.shared_nodes[i].first]);
+    if(mBulkData->is_valid(cur_node))
+      mBulkData->add_node_sharing(cur_node, mesh_data.shared_nodes[i].second);
+  }
+  mBulkData->modification_end();
+
+  // field values
+  const size_t num_nodes = mesh_data.node_ids.size();
+  for(size_t i=0; i<num_nodes; ++i)
+  {
+    stk::mesh::Entity cur_node = mBulkData->get_entity(stk::topology::NODE_RANK, mesh_data.node_ids[i]);
+    if(!mBulkData->is_valid(cur_node))
+      continue;
+    double* node_coords = stk::mesh::field_data(*mCoordsField, cur_node);
+    node_coords[0] = mesh_data.coordinates[3*i];
+    node_coords[1] = mesh_data.coordinates[3*i+1];
+    node_coords[2] = mesh_data.coordinates[3*i+2];
+    for(it = mesh_data.nodal_fields.begin(); it != mesh_data.nodal_fields.end(); ++it)
+    {
+#ifdef BUILD_IN_SIERRA // GLAZE1
+      stk::mesh::Field<double> *cur_field = mMetaData->get_field<double>(stk::topology::NODE_RANK, it->first);
+#else
+      stk::mesh::Field<double> *cur_field = mMetaData->get_field<stk::mesh::Field<double> >(stk::topology::NODE_RANK, it->first);
+#endif
+      double* vals = stk::mesh::field_data(*cur_field, cur_node);
+      vals[0] = it->second[i];
+    }
+  }
+  size_t elem_offset = 0;
+  for(size_t b=0; b<mesh_data.blocks.size(); ++b)
+  {
+    const IVEBlockData &block = mesh_data.blocks[b];
+    for(size_t e=0; e<block.elem_ids.size(); ++e)
+    {
+      stk::mesh::Entity cur_elem = mBulkData->get_entity(stk::topology::ELEMENT_RANK, block.elem_ids[e]);
+      for(it = mesh_data.element_fields.begin(); it != mesh_data.element_fields.end(); ++it)
+      {
+#ifdef BUILD_IN_SIERRA // GLAZE1
+        stk::mesh::Field<double> *cur_field = mMetaData->get_field<double>(stk::topology::ELEMENT_RANK, it->first);
+#else
+        stk::mesh::Field<double> *cur_field = mMetaData->get_field<stk::mesh::Field<double> >(stk::topology::ELEMENT_RANK, it->first);
+#endif
+        double* vals = stk::mesh::field_data(*cur_field, cur_elem);
+        vals[0] = it->second[elem_offset+e];
+      }
+    }
+    elem_offset += block.elem_ids.size();
+  }
+
+#ifdef BUILD_IN_SIERRA // GLAZE1
+  mIsoField = mMetaData->get_field<double>(stk::topology::NODE_RANK, fieldname);
+#else
+  mIsoField = mMetaData->get_field<stk::mesh::Field<double> >(stk::topology::NODE_RANK, fieldname);
+#endif
+  if(!mIsoField)
+  {
+    std::cout << "Failed to find " << fieldname << " nodal variable." << std::endl;
+    return false;
+  }
+
+  return true;
+}
+
 void IVEMeshAPISTK::export_my_mesh()
 {
   int p_rank = mBulkData->parallel_rank();
@@ -56,6 +56,7 @@
 #define IVEMeshAPISTK_____HPP
 
 #include "IVEMeshAPI.hpp"
+#include "IVEMeshData.hpp"
 #include "IsoVector.hpp"
 #include <vector>
 #include <map>
@@ -340,6 +341,8 @@ public:
   bool read_exodus_mesh(std::string &meshfile, std::string &fieldname, 
                         std::string &outputFieldsString,
                         int input_file_is_spread, int time_step);
+  bool build_mesh_from_data(const IVEMeshData &mesh_data, std::string &fieldname,
+                            std::string &outputFieldsString);
   void write_exodus_mesh(std::string &meshfile, int output_method, int iso_only);
   void set_comm(stk::ParallelMachine* comm) { mComm = comm; }
   stk::ParallelMachine* get_comm() { return mComm; }
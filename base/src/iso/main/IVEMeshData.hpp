@@ -0,0 +1,81 @@
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+//
+// *************************************************************************
+//@HEADER
+*/
+
+//-------------------------------------------------------------------------
+// Filename      : IVEMeshData.hpp
+//
+// Description   : a IVEMeshData is a plain, self contained copy of a
+//                 distributed hex or tet mesh and its nodal/element fields.
+//                 It lets a caller hand an in-memory mesh to the
+//                 IsoVolumeExtractionTool without an exodus round trip.
+//
+// Creation Date : 10/17/2026
+//-------------------------------------------------------------------------
+
+#ifndef IVEMeshData_____HPP
+#define IVEMeshData_____HPP
+
+#include <map>
+#include <string>
+#include <vector>
+#include <utility>
+
+struct IVEBlockData
+{
+  int id; // exodus block id, the block is named "block_<id>"
+  std::string topology; // "HEX8" or "TET4"
+  int nodes_per_elem;
+  std::vector<int> connectivity; // local (zero based) node indices, nodes_per_elem per element
+  std::vector<long> elem_ids; // global (one based) element ids
+};
+
+struct IVEMeshData
+{
+  std::vector<long> node_ids; // global (one based) node ids of the owned and ghosted nodes
+  std::vector<double> coordinates; // x, y, z of each local node
+  std::vector<std::pair<int, int> > shared_nodes; // (local node, sharing processor)
+  std::vector<IVEBlockData> blocks;
+  std::map<std::string, std::vector<double> > nodal_fields; // one value per local node
+  std::map<std::string, std::vector<double> > element_fields; // one value per element, blocks in order
+};
+
+#endif // IVEMeshData_____HPP
@@ -45,6 +45,8 @@
 #include <algorithm>
 #include <iostream>
 #include <cmath>
+#include <thread>
+#include <cstdint>
 
 bool boundary_equal(BoundaryNodeInfo bni1, BoundaryNodeInfo bni2)
 {
@@ -79,6 +81,163 @@ bool duplicate_equal(BoundaryNodeInfo bni1, BoundaryNodeInfo bni2)
   return false;
 }
 
+MeshEdgeTable::MeshEdgeTable() :
+  mMask(0)
+{
+  rehash(64);
+}
+
+void MeshEdgeTable::reserve(size_t num_edges)
+{
+  mEdges.reserve(num_edges);
+  size_t num_slots = mSlots.size();
+  while(num_slots < 2*num_edges)
+    num_slots *= 2;
+  if(num_slots != mSlots.size())
+    rehash(num_slots);
+}
+
+size_t MeshEdgeTable::first_slot(const IVEHandle &min_node, const IVEHandle &max_node) const
+{
+  std::uint64_t hash = min_node * 0x9E3779B97F4A7C15ULL;
+  hash ^= max_node + 0x7F4A7C159E3779B9ULL + (hash << 6) + (hash >> 2);
+  hash ^= hash >> 29;
+  return hash & mMask;
+}
+
+MeshEdge* MeshEdgeTable::find(const IVEHandle &n1, const IVEHandle &n2)
+{
+  IVEHandle min_node = n1 < n2 ? n1 : n2;
+  IVEHandle max_node = n1 < n2 ? n2 : n1;
+  for(size_t slot = first_slot(min_node, max_node); mSlots[slot] != 0; slot = (slot+1) & mMask)
+  {
+    MeshEdge &edge = mEdges[mSlots[slot]-1];
+    if(edge.min_id_node == min_node && edge.max_id_node == max_node)
+      return &edge;
+  }
+  return NULL;
+}
+
+void MeshEdgeTable::insert(const IVEHandle &n1, const IVEHandle &n2, const IVEHandle &mid_node)
+{
+  IVEHandle min_node = n1 < n2 ? n1 : n2;
+  IVEHandle max_node = n1 < n2 ? n2 : n1;
+  size_t slot = first_slot(min_node, max_node);
+  for(; mSlots[slot] != 0; slot = (slot+1) & mMask)
+  {
+    const MeshEdge &edge = mEdges[mSlots[slot]-1];
+    if(edge.min_id_node == min_node && edge.max_id_node == max_node)
+      return;
+  }
+
+  MeshEdge edge;
+  edge.min_id_node = min_node;
+  edge.max_id_node = max_node;
+  edge.mid_node = mid_node;
+  mEdges.push_back(edge);
+  mSlots[slot] = mEdges.size();
+
+  // keep the load factor at or below one half
+  if(2*mEdges.size() > mSlots.size())
+    rehash(2*mSlots.size());
+}
+
+void MeshEdgeTable::rehash(size_t num_slots)
+{
+  mSlots.assign(num_slots, 0);
+  mMask = num_slots-1;
+  for(size_t i=0; i<mEdges.size(); ++i)
+  {
+    size_t slot = first_slot(mEdges[i].min_id_node, mEdges[i].max_id_node);
+    while(mSlots[slot] != 0)
+      slot = (slot+1) & mMask;
+    mSlots[slot] = i+1;
+  }
+}
+
+IsoVolumeExtractionTool::IsoVolumeExtractionTool() :
+  mMinx(0.0), mMiny(0.0), mMinz(0.0), mMaxx(0.0), mMaxy(0.0), mMaxz(0.0),
+  mAverageEdgeLength(0.0),
+  mNumThreads(1)
+{
+}
+
+// Gathers the element nodes, nodal values and exterior faces.  This only
+// reads the input mesh so the elements are split over threads; creating
+// nodes and tris afterwards stays serial and in element order so the output
+// does not depend on the number of threads.
+void IsoVolumeExtractionTool::gather_element_sweep_data(const std::vector<IVEHandle> &elem_list,
+                                                        bool hex,
+                                                        std::map<IVEHandle,double> &nodal_vars,
+                                                        double lower_bound,
+                                                        IVEMeshAPI *mesh_api,
+                                                        std::vector<ElementSweepData> &elem_data)
+{
+  size_t num_elems = elem_list.size();
+  elem_data.resize(num_elems);
+
+  auto gather_range = [&](size_t begin, size_t end)
+  {
+    for(size_t a=begin; a<end; ++a)
+    {
+      IVEHandle cur_elem = elem_list[a];
+      ElementSweepData &data = elem_data[a];
+      data.exterior_faces = 0;
+      if(hex)
+      {
+        mesh_api->hex_nodes(cur_elem, data.nodes);
+        for(int b=0; b<8; b++)
+        {
+          std::map<IVEHandle,double>::const_iterator it = nodal_vars.find(data.nodes[b]);
+          data.vals[b] = (it != nodal_vars.end()) ? it->second : 0.0;
+        }
+        for(int i=0; i<6; i++)
+        {
+          IVEHandle face_nodes[4];
+          mesh_api->hex_quad_nodes(cur_elem, i, face_nodes);
+          if(!mesh_api->get_connected_hex(cur_elem, face_nodes[0], face_nodes[1], face_nodes[2], face_nodes[3]))
+            data.exterior_faces |= (1 << i);
+        }
+      }
+      else
+      {
+        mesh_api->tet_nodes(cur_elem, data.nodes);
+        for(int b=0; b<4; b++)
+          data.vals[b] = mesh_api->get_nodal_iso_field_variable(data.nodes[b]);
+        // faces 012, 013, 023 and 123; faces with every value below the
+        // band never produce boundary tris so their neighbors are not needed
+        static const int face_nodes[4][3] = {{0,1,2}, {0,1,3}, {0,2,3}, {1,2,3}};
+        for(int i=0; i<4; i++)
+        {
+          const int *f = face_nodes[i];
+          if(data.vals[f[0]] < lower_bound && data.vals[f[1]] < lower_bound && data.vals[f[2]] < lower_bound)
+            continue;
+          if(!mesh_api->get_connected_tet(cur_elem, data.nodes[f[0]], data.nodes[f[1]], data.nodes[f[2]]))
+            data.exterior_faces |= (1 << i);
+        }
+      }
+    }
+  };
+
+  size_t num_threads = std::min((size_t)mNumThreads, num_elems/1024 + 1);
+  if(num_threads <= 1)
+  {
+    gather_range(0, num_elems);
+    return;
+  }
+
+  size_t elems_per_thread = (num_elems + num_threads - 1) / num_threads;
+  std::vector<std::thread> threads;
+  for(size_t t=0; t<num_threads; ++t)
+  {
+    size_t begin = std::min(num_elems, t*elems_per_thread);
+    size_t end = std::min(num_elems, begin + elems_per_thread);
+    threads.push_back(std::thread(gather_range, begin, end));
+  }
+  for(size_t t=0; t<threads.size(); ++t)
+    threads[t].join();
+}
+
 void IsoVolumeExtractionTool::build_iso_volume_tris_from_hexes(const std::vector<IVEHandle> &hex_list,
                                                                const double &iso_value,
                                                                const double &min_edge_length,
@@ -167,7 +326,11 @@ void IsoVolumeExtractionTool::build_iso_volume_tris_from_hexes(const std::vector
   std::vector<IVEHandle> boundary_elements;
   mesh_api->get_attached_elements(shared_boundary_nodes, boundary_elements);
 
-  std::multimap<IVEHandle, MeshEdge*> edge_map;
+  std::vector<ElementSweepData> hex_data;
+  gather_element_sweep_data(hex_list, true, adjusted_nodal_vars, iso_value - value_tol, mesh_api, hex_data);
+
+  MeshEdgeTable edge_map;
+  edge_map.reserve(3*num_hexes);
   std::map<IVEHandle, IVEHandle> node_map;
   create_nodes_on_processor_boundaries(adjusted_nodal_vars, edge_map, node_map, iso_value, mesh_api, mesh_api_out, true, value_tol,
                                        shared_boundary_nodes, boundary_elements);
@@ -175,22 +338,12 @@ void IsoVolumeExtractionTool::build_iso_volume_tris_from_hexes(const std::vector
   for(size_t a=0; a<num_hexes; a++)
   {
     IVEHandle cur_hex = hex_list[a];
-    IVEHandle hex_node_list[8];
-    mesh_api->hex_nodes(cur_hex, hex_node_list);
-    double vals[8];
-    for(int b=0; b<8; b++)
-      vals[b] = adjusted_nodal_vars[hex_node_list[b]];
+    const ElementSweepData &data = hex_data[a];
     
     std::set<IVEHandle> dummy_set;
     std::vector<BoundaryNodeInfo> dummy_list;
-    create_interior_tris_for_hex(cur_hex, hex_node_list, vals, iso_value, edge_map, node_map, optimized_tris, mesh_api, mesh_api_out, false, dummy_list, dummy_set);
-    create_boundary_tris_for_hex(cur_hex, adjusted_nodal_vars, edge_map, node_map, fixed_tris, iso_value, mesh_api, mesh_api_out, false, dummy_list, shared_boundary_nodes);
-  }
-
-  for(std::map<IVEHandle, MeshEdge*>::iterator it_del = edge_map.begin(); it_del != edge_map.end(); ++it_del)
-  {
-      delete it_del->second;
-      it_del->second = NULL;
+    create_interior_tris_for_hex(cur_hex, data.nodes, data.vals, iso_value, edge_map, node_map, optimized_tris, mesh_api, mesh_api_out, false, dummy_list, dummy_set);
+    create_boundary_tris_for_hex(cur_hex, data.exterior_faces, adjusted_nodal_vars, edge_map, node_map, fixed_tris, iso_value, mesh_api, mesh_api_out, false, dummy_list, shared_boundary_nodes);
   }
 }
 
@@ -263,7 +416,11 @@ void IsoVolumeExtractionTool::build_iso_volume_tris_from_tets(const std::vector<
   std::vector<IVEHandle> boundary_elements;
   mesh_api->get_attached_elements(shared_boundary_nodes, boundary_elements);
 
-  std::multimap<IVEHandle, MeshEdge*> edge_map;
+  std::vector<ElementSweepData> tet_data;
+  gather_element_sweep_data(tet_list, false, nodal_vars, iso_value - value_tol, mesh_api, tet_data);
+
+  MeshEdgeTable edge_map;
+  edge_map.reserve(2*num_tets);
   std::map<IVEHandle,IVEHandle> node_map;
   create_nodes_on_processor_boundaries(nodal_vars, edge_map, node_map, iso_value, mesh_api, mesh_api_out, false, value_tol,
                                        shared_boundary_nodes, boundary_elements);
@@ -271,16 +428,11 @@ void IsoVolumeExtractionTool::build_iso_volume_tris_from_tets(const std::vector<
   std::set<IVEHandle> dummy_set;
   std::vector<BoundaryNodeInfo> dummy_list1, dummy_list2;
   for (size_t g=0; g<num_tets; g++)
-    process_tet(tet_list[g], fixed_tris, optimized_tris, iso_value, value_tol, edge_map, node_map, mesh_api, mesh_api_out, false, dummy_list1, dummy_list2, dummy_set);
-
-  for(std::map<IVEHandle, MeshEdge*>::iterator it_del = edge_map.begin(); it_del != edge_map.end(); ++it_del) {
-      delete it_del->second;
-      it_del->second = NULL;
-  }
+    process_tet(tet_list[g], tet_data[g], fixed_tris, optimized_tris, iso_value, value_tol, edge_map, node_map, mesh_api, mesh_api_out, false, dummy_list1, dummy_list2, dummy_set);
 }
 
 void IsoVolumeExtractionTool::create_nodes_on_processor_boundaries(std::map<IVEHandle,double> &nodal_vars,
-                                                    std::multimap<IVEHandle,MeshEdge*> &edge_map,
+                                                    MeshEdgeTable &edge_map,
                                                     std::map<IVEHandle,IVEHandle> &node_map,
                                                     double iso_value,
                                                     IVEMeshAPI *mesh_api,
@@ -298,28 +450,25 @@ void IsoVolumeExtractionTool::create_nodes_on_processor_boundaries(std::map<IVEH
     return;
 */
 
+  std::vector<ElementSweepData> boundary_elem_data;
+  gather_element_sweep_data(boundary_elements, hex, nodal_vars, iso_value - value_tol, mesh_api, boundary_elem_data);
+
   std::vector<BoundaryNodeInfo> edge_node_info, duplicate_node_info;
   for(size_t i=0; i<boundary_elements.size(); ++i)
   {
     IVEHandle cur_elem = boundary_elements[i];
+    const ElementSweepData &data = boundary_elem_data[i];
     std::vector<IVEHandle> dummy_tri_list, dummy_tri_list2;
     if(hex)
     {
-      IVEHandle node_list[8];
-      mesh_api->hex_nodes(cur_elem, node_list);
-      double vals[8];
-      for(int b=0; b<8; b++)
-        vals[b] = nodal_vars[node_list[b]];
-      create_interior_tris_for_hex(cur_elem, node_list, vals, iso_value, edge_map, node_map, 
+      create_interior_tris_for_hex(cur_elem, data.nodes, data.vals, iso_value, edge_map, node_map, 
            dummy_tri_list, mesh_api, mesh_api_out, true, edge_node_info, shared_boundary_nodes);
-      create_boundary_tris_for_hex(cur_elem, nodal_vars, edge_map, node_map, dummy_tri_list, 
+      create_boundary_tris_for_hex(cur_elem, data.exterior_faces, nodal_vars, edge_map, node_map, dummy_tri_list, 
            iso_value, mesh_api, mesh_api_out, true, duplicate_node_info, shared_boundary_nodes);
     }
     else
     {
-      IVEHandle node_list[4];
-      mesh_api->tet_nodes(cur_elem, node_list);
-      process_tet(cur_elem, dummy_tri_list, dummy_tri_list2, iso_value, value_tol, edge_map, 
+      process_tet(cur_elem, data, dummy_tri_list, dummy_tri_list2, iso_value, value_tol, edge_map, 
            node_map, mesh_api, mesh_api_out, true, edge_node_info, duplicate_node_info, 
            shared_boundary_nodes);
     }
@@ -401,10 +550,7 @@ void IsoVolumeExtractionTool::create_nodes_on_processor_boundaries(std::map<IVEH
       {
         if(dup_it->existing_node_local_id == bni.existing_node_id)
         {
-          MeshEdge *me = new MeshEdge;
-          me->max_id_node = bni.max_node;
-          me->mid_node = dup_it->new_node;
-          edge_map.insert(std::multimap<IVEHandle,MeshEdge*>::value_type(bni.min_node, me));
+          edge_map.insert(bni.min_node, bni.max_node, dup_it->new_node);
           break;
         }
         dup_it++;
@@ -419,19 +565,17 @@ void IsoVolumeExtractionTool::create_nodes_on_processor_boundaries(std::map<IVEH
   for(size_t i=0; i<mid_edge_infos.size(); ++i)
   {
     BoundaryNodeInfo &bni = mid_edge_infos[i];
-    MeshEdge *me = new MeshEdge;
-    me->max_id_node = bni.max_node;
-    me->mid_node = bni.new_node;
-    edge_map.insert(std::multimap<IVEHandle,MeshEdge*>::value_type(bni.min_node, me));
+    edge_map.insert(bni.min_node, bni.max_node, bni.new_node);
   }
 }
 
 void IsoVolumeExtractionTool::process_tet(const IVEHandle &tet,
+                                          const ElementSweepData &tet_data,
                                           std::vector<IVEHandle> &fixed_tris,
                                           std::vector<IVEHandle> &optimized_tris,
                                           const double &iso_value,
                                           const double &value_tol,
-                                          std::multimap<IVEHandle,MeshEdge*> &edge_map,
+                                          MeshEdgeTable &edge_map,
                                           std::map<IVEHandle,IVEHandle> &node_map,
                                           IVEMeshAPI *mesh_api,
                                           IVEMeshAPI *mesh_api_out,
@@ -453,8 +597,7 @@ void IsoVolumeExtractionTool::process_tet(const IVEHandle &tet,
   /* printf("iso_value %f\n",iso_value); */
   double lower_bound = iso_value - value_tol;
   double upper_bound = iso_value + value_tol;
-  IVEHandle tet_nodes[4];
-  mesh_api->tet_nodes(tet, tet_nodes);
+  const IVEHandle *tet_nodes = tet_data.nodes;
   std::vector<IVEHandle> tmp_tri_nodes;
   std::vector<IVEHandle> nodes_used_in_tris;
   double vals[4];
@@ -489,7 +632,7 @@ void IsoVolumeExtractionTool::process_tet(const IVEHandle &tet,
   IVEHandle ec31 = 0;
   IVEHandle ec32 = 0;
   for(int i=0; i<4; i++)
-    vals[i] = mesh_api->get_nodal_iso_field_variable(tet_nodes[i]);
+    vals[i] = tet_data.vals[i];
   
   v0 = vals[0]; v1 = vals[1]; v2 = vals[2]; v3 = vals[3];
   
@@ -735,19 +878,19 @@ void IsoVolumeExtractionTool::process_tet(const IVEHandle &tet,
 
   // Face 012
   create_boundary_tris_for_tet(tet, n0, n1, n2, v0, v1, v2, ec01, ec12, ec20,
-                               fixed_tris, upper_bound, lower_bound, node_map, mesh_api, mesh_api_out,
+                               (tet_data.exterior_faces & 1) != 0, fixed_tris, upper_bound, lower_bound, node_map, mesh_api, mesh_api_out,
                                only_create_boundary_node_info, duplicate_node_info, boundary_nodes, outwardNormal[3]);
   // Face 013
   create_boundary_tris_for_tet(tet, n0, n1, n3, v0, v1, v3, ec01, ec31, ec30,
-                               fixed_tris, upper_bound, lower_bound, node_map, mesh_api, mesh_api_out,
+                               (tet_data.exterior_faces & 2) != 0, fixed_tris, upper_bound, lower_bound, node_map, mesh_api, mesh_api_out,
                                only_create_boundary_node_info, duplicate_node_info, boundary_nodes, outwardNormal[2]);
   // Face 023
   create_boundary_tris_for_tet(tet, n0, n2, n3, v0, v2, v3, ec20, ec32, ec30,
-                               fixed_tris, upper_bound, lower_bound, node_map, mesh_api, mesh_api_out,
+                               (tet_data.exterior_faces & 4) != 0, fixed_tris, upper_bound, lower_bound, node_map, mesh_api, mesh_api_out,
                                only_create_boundary_node_info, duplicate_node_info, boundary_nodes, outwardNormal[1]);
   // Face 123
   create_boundary_tris_for_tet(tet, n1, n2, n3, v1, v2, v3, ec12, ec32, ec31,
-                               fixed_tris, upper_bound, lower_bound, node_map, mesh_api, mesh_api_out,
+                               (tet_data.exterior_faces & 8) != 0, fixed_tris, upper_bound, lower_bound, node_map, mesh_api, mesh_api_out,
                                only_create_boundary_node_info, duplicate_node_info, boundary_nodes, outwardNormal[0]);
 }
 
@@ -854,6 +997,7 @@ void IsoVolumeExtractionTool::create_boundary_tris_for_tet(const IVEHandle &cur_
                                                            const IVEHandle &ec01,
                                                            const IVEHandle &ec12,
                                                            const IVEHandle &ec20,
+                                                           bool exterior_face,
                                                            std::vector<IVEHandle> &fixed_tris,
                                                            const double &upper_bound,
                                                            const double &lower_bound,
@@ -871,8 +1015,7 @@ void IsoVolumeExtractionTool::create_boundary_tris_for_tet(const IVEHandle &cur_
   if(v0 > upper_bound || v1 > upper_bound || v2 > upper_bound)
   {
     // Something is positive so we need to do further checking.
-    IVEHandle other_tet = mesh_api->get_connected_tet(cur_tet, n0, n1, n2);
-    if(!other_tet)
+    if(exterior_face)
     {
       if(v0 >= lower_bound && v1 >= lower_bound && v2 >= lower_bound)
       {
@@ -1206,9 +1349,8 @@ void IsoVolumeExtractionTool::create_boundary_tris_for_tet(const IVEHandle &cur_
                        boundary_nodes.find(n1) != boundary_nodes.end() &&
                        boundary_nodes.find(n2) != boundary_nodes.end());
 */
-    IVEHandle other_tet = mesh_api->get_connected_tet(cur_tet, n0, n1, n2);
-    if(!other_tet)
-    //if(!all_shared && !other_tet)
+    if(exterior_face)
+    //if(!all_shared && exterior_face)
     {
       if(boundary_info)
       {
@@ -1271,7 +1413,7 @@ void IsoVolumeExtractionTool::create_interior_tris_for_hex(IVEHandle hex,
                                                            const IVEHandle hex_nodes[8],
                                                            const double *vals,
                                                            const double &isolevel,
-                                                           std::multimap<IVEHandle, MeshEdge*> &edge_map,
+                                                           MeshEdgeTable &edge_map,
                                                            std::map<IVEHandle,IVEHandle> &node_map,
                                                            std::vector<IVEHandle> &optimized_tris,
                                                            IVEMeshAPI *mesh_api,
@@ -1784,8 +1926,9 @@ void IsoVolumeExtractionTool::create_interior_tris_for_hex(IVEHandle hex,
 }
 
 void IsoVolumeExtractionTool::create_boundary_tris_for_hex(const IVEHandle &cur_hex,
+                                                           const unsigned char &exterior_faces,
                                                            std::map<IVEHandle,double> &nodal_var_map,
-                                                           std::multimap<IVEHandle,MeshEdge*> &edge_map,
+                                                           MeshEdgeTable &edge_map,
                                                            std::map<IVEHandle,IVEHandle> &node_map,
                                                            std::vector<IVEHandle> &fixed_tris,
                                                            const double &iso_level,
@@ -1797,15 +1940,11 @@ void IsoVolumeExtractionTool::create_boundary_tris_for_hex(const IVEHandle &cur_
 {
   for(int i=0; i<6; i++)
   {
-    IVEHandle face_nodes[4];
-    mesh_api->hex_quad_nodes(cur_hex, i, face_nodes);
-
-    if(!mesh_api->get_connected_hex(cur_hex,
-                                    face_nodes[0],
-                                    face_nodes[1],
-                                    face_nodes[2],
-                                    face_nodes[3]))
+    if(exterior_faces & (1 << i))
     {
+      IVEHandle face_nodes[4];
+      mesh_api->hex_quad_nodes(cur_hex, i, face_nodes);
+
       double vals[4];
       for(int j=0; j<4; j++)
         vals[j] = nodal_var_map[face_nodes[j]];
@@ -1976,7 +2115,7 @@ IVEHandle IsoVolumeExtractionTool::get_mid_node(const IVEHandle &n1,
                                               const double &val1,
                                               const double &val2,
                                               const double &iso_val,
-                                              std::multimap<IVEHandle, MeshEdge*> &edge_map,
+                                              MeshEdgeTable &edge_map,
                                               std::map<IVEHandle, IVEHandle> &node_map,
                                               IVEMeshAPI *mesh_api,
                                               IVEMeshAPI *mesh_api_out,
@@ -2063,7 +2202,7 @@ IVEHandle IsoVolumeExtractionTool::get_mid_node(const IVEHandle &n1,
   }
   else
   {
-    MeshEdge *me = find_mesh_edge(n1, n2, edge_map);
+    MeshEdge *me = edge_map.find(n1, n2);
     if(me)
       ret = me->mid_node;
     else
@@ -2080,20 +2219,7 @@ IVEHandle IsoVolumeExtractionTool::get_mid_node(const IVEHandle &n1,
           mesh_api->transfer_output_fields(n1, n1, new_node, 0.0, mesh_api_out);
           node_map[n1] = new_node;
         }
-        me = new MeshEdge;
-        int min_id;
-        if(n1 < n2)
-        {
-          me->max_id_node = n2;
-          min_id = n1;
-        }
-        else
-        {
-          me->max_id_node = n1;
-          min_id = n2;
-        }
-        me->mid_node = new_node;
-        edge_map.insert(std::multimap<IVEHandle,MeshEdge*>::value_type(min_id, me));
+        edge_map.insert(n1, n2, new_node);
         ret = new_node;
       }
       else if(val2 == iso_val)
@@ -2108,20 +2234,7 @@ IVEHandle IsoVolumeExtractionTool::get_mid_node(const IVEHandle &n1,
           mesh_api->transfer_output_fields(n2, n2, new_node, 0.0, mesh_api_out);
           node_map[n2] = new_node;
         }
-        me = new MeshEdge;
-        int min_id;
-        if(n1 < n2)
-        {
-          me->max_id_node = n2;
-          min_id = n1;
-        }
-        else
-        {
-          me->max_id_node = n1;
-          min_id = n2;
-        }
-        me->mid_node = new_node;
-        edge_map.insert(std::multimap<IVEHandle,MeshEdge*>::value_type(min_id, me));
+        edge_map.insert(n1, n2, new_node);
         ret = new_node;
       }
       else if(fabs(val1-val2) < 1e-6)
@@ -2142,49 +2255,10 @@ IVEHandle IsoVolumeExtractionTool::get_mid_node(const IVEHandle &n1,
         IsoVector new_pos = p1 + mu * (p2-p1);
         IVEHandle new_node = mesh_api_out->new_node(new_pos);
         mesh_api->transfer_output_fields(n1, n2, new_node, mu, mesh_api_out);
-        me = new MeshEdge;
-        int min_id;
-        if(n1 < n2)
-        {
-          me->max_id_node = n2;
-          min_id = n1;
-        }
-        else
-        {
-          me->max_id_node = n1;
-          min_id = n2;
-        }
-        me->mid_node = new_node;
-        edge_map.insert(std::multimap<IVEHandle,MeshEdge*>::value_type(min_id, me));
+        edge_map.insert(n1, n2, new_node);
         ret = new_node;
       }
     }
   }
   return ret;
 }
-
-MeshEdge* IsoVolumeExtractionTool::find_mesh_edge(const IVEHandle &n1,
-                                                  const IVEHandle &n2,
-                                                  std::multimap<IVEHandle,MeshEdge*> &edge_map)
-{
-  size_t min_id = n1;
-  IVEHandle other_node = n2;
-  if(n2 < min_id)
-  {
-    min_id = n2;
-    other_node = n1;
-  }
-  std::multimap<IVEHandle,MeshEdge*>::iterator itlow, ithi, it;
-  itlow = edge_map.lower_bound(min_id);
-  ithi = edge_map.upper_bound(min_id);
-  for(it=itlow; it!=ithi; ++it)
-  {
-    if(it->second->max_id_node == other_node)
-      return it->second;
-  }
-  return NULL;
-}
-
-
-
-
@@ -43,6 +43,7 @@
 #ifndef ISOVOLUMEEXTRACTIONTOOL_HPP
 #define ISOVOLUMEEXTRACTIONTOOL_HPP
 
+#include <cstddef>
 #include <vector>
 #include <map>
 #include <set>
@@ -50,8 +51,41 @@
 
 struct MeshEdge
 {
-  IVEHandle mid_node;
+  IVEHandle min_id_node;
   IVEHandle max_id_node;
+  IVEHandle mid_node;
+};
+
+// Open addressing hash of the cut mesh edges keyed by their (min,max) node
+// pair.  Edge records live in one pool rather than one allocation per edge.
+class MeshEdgeTable
+{
+public:
+  MeshEdgeTable();
+  void reserve(size_t num_edges);
+  // The returned pointer is only valid until the next insert.
+  MeshEdge* find(const IVEHandle &n1, const IVEHandle &n2);
+  // The first record inserted for an edge is kept.
+  void insert(const IVEHandle &n1, const IVEHandle &n2, const IVEHandle &mid_node);
+  size_t size() const { return mEdges.size(); }
+
+private:
+  size_t first_slot(const IVEHandle &min_node, const IVEHandle &max_node) const;
+  void rehash(size_t num_slots);
+
+  std::vector<MeshEdge> mEdges;
+  // one plus the index of the edge in mEdges, zero for an empty slot
+  std::vector<size_t> mSlots;
+  size_t mMask;
+};
+
+// Element data gathered before the serial sweep that creates nodes and tris.
+struct ElementSweepData
+{
+  IVEHandle nodes[8];
+  double vals[8];
+  // bit i is set if face i has no neighboring element
+  unsigned char exterior_faces;
 };
 
 class IsoVolumeExtractionTool
@@ -60,8 +94,15 @@ private:
 
       double mMinx, mMiny, mMinz, mMaxx, mMaxy, mMaxz;
       double mAverageEdgeLength;
+      int mNumThreads;
+  void gather_element_sweep_data(const std::vector<IVEHandle> &elem_list,
+                                 bool hex,
+                                 std::map<IVEHandle,double> &nodal_vars,
+                                 double lower_bound,
+                                 IVEMeshAPI *mesh_api,
+                                 std::vector<ElementSweepData> &elem_data);
   void create_nodes_on_processor_boundaries(std::map<IVEHandle,double> &nodal_vars,
-                                                    std::multimap<IVEHandle,MeshEdge*> &edge_map,
+                                                    MeshEdgeTable &edge_map,
                                                     std::map<IVEHandle,IVEHandle> &node_map,
                                                     double iso_value,
                                                     IVEMeshAPI *mesh_api,
@@ -74,7 +115,7 @@ private:
                                     const IVEHandle hex_nodes[8],
                                     const double *vals,
                                     const double &isolevel,
-                                    std::multimap<IVEHandle, MeshEdge*> &edge_map,
+                                    MeshEdgeTable &edge_map,
                                     std::map<IVEHandle,IVEHandle> &node_map,
                                     std::vector<IVEHandle> &optimized_tris,
                                     IVEMeshAPI *mesh_api,
@@ -83,8 +124,9 @@ private:
                                     std::vector<BoundaryNodeInfo> &boundary_node_info,
                                     std::set<IVEHandle> &boundary_nodes);
   void create_boundary_tris_for_hex(const IVEHandle &cur_hex,
+                                    const unsigned char &exterior_faces,
                                     std::map<IVEHandle,double> &nodal_var_map,
-                                    std::multimap<IVEHandle,MeshEdge*> &edge_map,
+                                    MeshEdgeTable &edge_map,
                                     std::map<IVEHandle,IVEHandle> &node_map,
                                     std::vector<IVEHandle> &fixed_tris,
                                     const double &iso_level,
@@ -103,6 +145,7 @@ private:
                                     const IVEHandle &ec01,
                                     const IVEHandle &ec12,
                                     const IVEHandle &ec20,
+                                    bool exterior_face,
                                     std::vector<IVEHandle> &fixed_tris,
                                     const double &zero_tol,
                                     const double &neg_zero_tol,
@@ -124,21 +167,19 @@ private:
                        const double &val1,
                        const double &val2,
                        const double &iso_val,
-                       std::multimap<IVEHandle, MeshEdge*> &edge_map,
+                       MeshEdgeTable &edge_map,
                        std::map<IVEHandle, IVEHandle> &node_map,
                        IVEMeshAPI *mesh_api,
                        IVEMeshAPI *mesh_api_out,
                        bool boundary_info,
                        BoundaryNodeInfo &bni);
-  MeshEdge* find_mesh_edge(const IVEHandle &n1,
-                           const IVEHandle &n2,
-                           std::multimap<IVEHandle,MeshEdge*> &edge_map);
   void process_tet(const IVEHandle &tet,
+                   const ElementSweepData &tet_data,
                    std::vector<IVEHandle> &fixed_tris,
                    std::vector<IVEHandle> &optimized_tris,
                    const double &iso_value,
                    const double &value_tol,
-                   std::multimap<IVEHandle,MeshEdge*> &edge_map,
+                   MeshEdgeTable &edge_map,
                    std::map<IVEHandle,IVEHandle> &node_map,
                    IVEMeshAPI *mesh_api,
                    IVEMeshAPI *mesh_api_out,
@@ -152,6 +193,7 @@ private:
   IVEHandle createOrientedTriOnBoundaryTet(IVEMeshAPI* mesh_api, IVEMeshAPI* mesh_api_out, IVEHandle tet, IVEHandle n0, IVEHandle n1, IVEHandle n2, IsoVector& outwardNormal);
 
 public:
+      IsoVolumeExtractionTool();
       double minx() { return mMinx; }
       double miny() { return mMiny; }
       double minz() { return mMinz; }
@@ -159,6 +201,7 @@ public:
       double maxy() { return mMaxy; }
       double maxz() { return mMaxz; }
       double average_edge_length() { return mAverageEdgeLength; }
+      int num_threads() { return mNumThreads; }
       void minx(double val) { mMinx = val; }
       void miny(double val) { mMiny = val; }
       void minz(double val) { mMinz = val; }
@@ -166,6 +209,7 @@ public:
       void maxy(double val) { mMaxy = val; }
       void maxz(double val) { mMaxz = val; }
       void average_edge_length(double average_edge_length) { mAverageEdgeLength = average_edge_length; }
+      void num_threads(int val) { mNumThreads = val < 1 ? 1 : val; }
   void build_iso_volume_tris_from_hexes(const std::vector<IVEHandle> &elem_list,
                                         const double &iso_value,
                                         const double &min_edge_length,
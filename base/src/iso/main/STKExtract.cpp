@@ -54,6 +54,8 @@
 
 #include <Ioss_SubSystem.h>
 
+#include <chrono>
+
 namespace iso
 {
 
@@ -63,6 +65,7 @@ STKExtract::STKExtract()
   mMeshAPIIn = nullptr;
   mMeshAPIOut = nullptr;
   mOutputSTL = 0; 
+  mNumThreads = 1;
 }
 
 STKExtract::~STKExtract()
@@ -174,6 +177,49 @@ bool STKExtract::create_mesh_apis_read_from_file(stk::ParallelMachine *comm,
   return true;
 }
 
+bool STKExtract::create_mesh_apis_from_data(stk::ParallelMachine *comm,
+                                            const IVEMeshData &meshData,
+                                            std::string meshOut,
+                                            std::string fieldName,
+                                            std::string outputFieldsString,
+                                            std::vector<std::string> requestedFormats,
+                                            double minEdgeLength,
+                                            double isoValue,
+                                            int levelSetData,
+                                            int outputMethod,
+                                            int isoOnly,
+                                            int timeStep)
+{
+  mComm = comm;
+  mMeshIn = "";
+  mMeshOut = meshOut;
+  mFieldName = fieldName;
+  mMeshAPIIn = NULL;
+  mMeshAPIOut = NULL;
+  mMinEdgeLength = minEdgeLength;
+  mIsoValue = isoValue;
+  mLevelSetData = levelSetData;
+  mOutputMethod = outputMethod;
+  mIsoOnly = isoOnly;
+  mReadSpreadFile = 1;
+  mTimeStep = timeStep;
+  mOutputFieldsString = outputFieldsString;
+  mRequestedFormats = requestedFormats;
+
+  // same layout as init_single_mesh_apis, but the input mesh is built from memory
+  mMeshAPIIn = new IVEMeshAPISTK(mComm);
+  mMeshAPIIn->prepare_as_source();
+
+  mMeshAPIIn->set_fixed_block_ids(mFixedBlocksString);
+
+  if(!mMeshAPIIn->build_mesh_from_data(meshData, mFieldName, mOutputFieldsString))
+    return false;
+
+  mMeshAPIOut = mMeshAPIIn;
+
+  return true;
+}
+
 bool STKExtract::create_mesh_apis_with_existing_stk_mesh(stk::ParallelMachine *comm,
                                                          const stk::mesh::BulkData *bulkData,
                                                          const stk::mesh::MetaData *metaData,
@@ -281,6 +327,7 @@ bool STKExtract::run_extraction(int iteration, int num_materials)
     bool level_set_data = mLevelSetData;
     std::vector<IVEHandle> fixed_tri_list, optimized_tri_list;
     IsoVolumeExtractionTool ive;
+    ive.num_threads(mNumThreads);
 
     mMeshAPIOut->bulk_data()->modification_begin();
     // Call the element specific functions for extracting the iso volume
@@ -622,7 +669,9 @@ bool STKExtract::run_private_stand_alone()
   bool level_set_data = mLevelSetData;
   std::vector<IVEHandle> fixed_tri_list, optimized_tri_list;
   IsoVolumeExtractionTool ive;
+  ive.num_threads(mNumThreads);
 
+  std::chrono::steady_clock::time_point extraction_start = std::chrono::steady_clock::now();
   mMeshAPIOut->bulk_data()->modification_begin();
 
   // Call the element specific functions for extracting the iso volume 
@@ -639,8 +688,10 @@ bool STKExtract::run_private_stand_alone()
 
 
   mMeshAPIOut->bulk_data()->modification_end();
+  double extraction_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - extraction_start).count();
 
-  std::cout << "Done extracting iso-volume. " << std::endl;
+  std::cout << "Done extracting iso-volume from " << total_num_elems << " elements with " << ive.num_threads()
+            << " thread(s) in " << extraction_time << " seconds." << std::endl;
 
   if(mOutputSTL)
   {
@@ -690,6 +741,7 @@ bool STKExtract::read_command_line( int argc, char *argv[])
   clp.setOption("output_fields",  &mOutputFieldsString, "specify the fields (commma separated, no spaces) to output in the output mesh.", false );
   clp.setOption("fixed_blocks",  &mFixedBlocksString, "specify the blocks that are fixed (commma separated, no spaces).", false );
   clp.setOption("output_stl",  &mOutputSTL, "specify output in stl format rather than exodus. Can only be used if --iso_only=1", false );
+  clp.setOption("num_threads",  &mNumThreads, "number of threads used to gather element data during extraction.", false );
 
   Teuchos::CommandLineProcessor::EParseCommandLineReturn parseReturn =
                      Teuchos::CommandLineProcessor::PARSE_SUCCESSFUL;
@@ -107,6 +107,18 @@
                              int isoOnly,
                              int readSpreadFile,
                              std::string outputFieldsString);
+      bool create_mesh_apis_from_data(stk::ParallelMachine *comm,
+                             const IVEMeshData &meshData,
+                             std::string meshOut,
+                             std::string fieldName,
+                             std::string outputFieldsString,
+                             std::vector<std::string> requestedFormats,
+                             double minEdgeLength,
+                             double isoValue,
+                             int levelSetData,
+                             int outputMethod,
+                             int isoOnly,
+                             int timeStep);
       bool run_stand_alone();
       bool run_extraction(int iteration, int num_materials);
       double minx() { return mMinx; }
@@ -116,6 +128,7 @@
       double maxy() { return mMaxy; }
       double maxz() { return mMaxz; }
       double average_edge_length() { return mAverageEdgeLength; }
+      int num_threads() { return mNumThreads; }
       void minx(double val) { mMinx = val; }
       void miny(double val) { mMiny = val; }
       void minz(double val) { mMinz = val; }
@@ -123,6 +136,7 @@
       void maxy(double val) { mMaxy = val; }
       void maxz(double val) { mMaxz = val; }
       void average_edge_length(double average_edge_length) { mAverageEdgeLength = average_edge_length; }
+      void num_threads(int val) { mNumThreads = val < 1 ? 1 : val; }
 
       std::vector<std::string> availableFormats() { return mAvailableFormats; }
 
@@ -152,6 +166,7 @@
       int mIsoOnly;
       int mTimeStep;
       int mOutputSTL;
+      int mNumThreads;
       IVEMeshAPISTK *mMeshAPIIn;
       IVEMeshAPISTK *mMeshAPIOut;
     };
@@ -67,6 +67,7 @@
 #include "Plato_Exceptions.hpp"
 #include "Plato_InitializeField.hpp"
 #include "Plato_OperationsUtilities.hpp"
+#include "Plato_RestartFileUtilities.hpp"
 
 #include <boost/archive/xml_oarchive.hpp>
 #include <boost/archive/xml_iarchive.hpp>
@@ -735,6 +736,19 @@ void InitializeField::getInitialValuesForPrimitivesLevelSet(const DistributedVec
 
 void InitializeField::getInitialValuesForRestart(const DistributedVector &field, std::vector<double> &aValues)
 {
+    // native restart files are read by global id, so the decomposition may differ from the one that wrote them
+    if(Plato::is_native_restart_file(mFileName))
+    {
+        const Epetra_BlockMap& tMap = field.getAssemblyEpetraVector()->Map();
+        std::vector<long long> tGlobalIds(field.MyLength());
+        for(int tIndex = 0; tIndex < field.MyLength(); ++tIndex)
+        {
+            tGlobalIds[tIndex] = tMap.GID(tIndex);
+        }
+        Plato::read_restart_field(mPlatoApp->getComm(), mFileName, mVariableName, tGlobalIds, aValues);
+        return;
+    }
+
 #ifdef STK_ENABLED
     bool IsInputFileSpread = true;
 
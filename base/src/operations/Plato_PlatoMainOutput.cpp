@@ -49,6 +49,12 @@
 #include <string>
 #include <cstdio>
 #include <cstdlib>
+#include <memory>
+#include <vector>
+#include <fstream>
+#include <algorithm>
+#include <dirent.h>
+#include <sys/stat.h>
 
 #ifdef ENABLE_ISO
 #include "STKExtract.hpp"
@@ -60,6 +66,9 @@
 #include "Plato_Utils.hpp"
 #include "Plato_PlatoMainOutput.hpp"
 #include "Plato_OperationsUtilities.hpp"
+#include "Plato_Console.hpp"
+#include "Plato_Exceptions.hpp"
+#include "Plato_RestartFileUtilities.hpp"
 #include <Plato_FreeFunctions.hpp>
 
 #include <boost/archive/xml_oarchive.hpp>
@@ -68,6 +77,142 @@ BOOST_CLASS_EXPORT_IMPLEMENT(Plato::PlatoMainOutput)
 
 namespace Plato
 {
+
+namespace
+{
+
+/******************************************************************************//**
+ * @brief Return the sorted names of the files in the working directory that start
+ *   with aPrefix and end with aSuffix, i.e. what 'ls <aPrefix>*<aSuffix>' lists
+ * @param [in] aPrefix file name prefix
+ * @param [in] aSuffix file name suffix
+ **********************************************************************************/
+std::vector<std::string> listWorkingDirectoryFiles(const std::string& aPrefix, const std::string& aSuffix)
+{
+    std::vector<std::string> tFileNames;
+    DIR* tDirectory = opendir(".");
+    if(tDirectory)
+    {
+        while(struct dirent* tEntry = readdir(tDirectory))
+        {
+            std::string tName(tEntry->d_name);
+            if(tName.size() >= aPrefix.size() + aSuffix.size() &&
+               tName.compare(0, aPrefix.size(), aPrefix) == 0 &&
+               tName.compare(tName.size() - aSuffix.size(), aSuffix.size(), aSuffix) == 0)
+            {
+                tFileNames.push_back(tName);
+            }
+        }
+        closedir(tDirectory);
+    }
+    std::sort(tFileNames.begin(), tFileNames.end());
+    return tFileNames;
+}
+
+/******************************************************************************//**
+ * @brief Return the most recently modified file name in the list, empty if none
+ * @param [in] aFileNames file names
+ **********************************************************************************/
+std::string newestFile(const std::vector<std::string>& aFileNames)
+{
+    std::string tNewest;
+    time_t tNewestTime = 0;
+    for(auto& tName : aFileNames)
+    {
+        struct stat tStatus;
+        if(stat(tName.c_str(), &tStatus) == 0 && (tNewest.empty() || tStatus.st_mtime > tNewestTime))
+        {
+            tNewest = tName;
+            tNewestTime = tStatus.st_mtime;
+        }
+    }
+    return tNewest;
+}
+
+}
+// namespace
+
+#ifdef ENABLE_ISO
+namespace
+{
+
+/******************************************************************************//**
+ * @brief Copy the PlatoMain mesh and the fields needed by the iso-surface extraction
+ * @param [in] aPlatoApp PLATO application
+ * @param [in] aIsoFieldName name of the nodal field that defines the iso-surface
+ * @param [in] aOutputData fields transferred to the iso-surface
+ * @param [out] aMeshData in-memory mesh description
+ **********************************************************************************/
+void buildIsoMeshData(PlatoApp* aPlatoApp,
+                      const std::string& aIsoFieldName,
+                      const std::vector<Plato::LocalArg>& aOutputData,
+                      IVEMeshData& aMeshData)
+{
+    LightMP* tLightMP = aPlatoApp->getLightMP();
+    DataMesh* tMesh = tLightMP->getMesh();
+    DataContainer* tDataContainer = tLightMP->getDataContainer();
+
+    const int tNumNodes = tMesh->getNumNodes();
+    const bool tHasZ = tMesh->getDimensions() == 3;
+    Real* tX = tMesh->getX();
+    Real* tY = tMesh->getY();
+    Real* tZ = tHasZ ? tMesh->getZ() : nullptr;
+    aMeshData.node_ids.assign(tMesh->nodeGlobalIds, tMesh->nodeGlobalIds + tNumNodes);
+    aMeshData.coordinates.resize(3 * tNumNodes);
+    for(int tNode = 0; tNode < tNumNodes; tNode++)
+    {
+        aMeshData.coordinates[3 * tNode] = tX[tNode];
+        aMeshData.coordinates[3 * tNode + 1] = tY[tNode];
+        aMeshData.coordinates[3 * tNode + 2] = tHasZ ? tZ[tNode] : 0.0;
+    }
+
+    for(int tMap = 0; tMap < tMesh->numNodeCommMaps; tMap++)
+    {
+        for(int tIndex = 0; tIndex < tMesh->nodeCmapNodeCnts[tMap]; tIndex++)
+        {
+            aMeshData.shared_nodes.push_back(std::make_pair(tMesh->commNodeIds[tMap][tIndex], tMesh->commNodeProcIds[tMap][tIndex]));
+        }
+    }
+
+    int tElementOffset = 0;
+    for(int tBlock = 0; tBlock < tMesh->getNumElemBlks(); tBlock++)
+    {
+        IVEBlockData tBlockData;
+        tBlockData.id = tMesh->getBlockId(tBlock);
+        tBlockData.topology = tMesh->getElemTypeInBlk(tBlock);
+        tBlockData.nodes_per_elem = tMesh->getNnpeInBlk(tBlock);
+        const int tNumElements = tMesh->getNumElemInBlk(tBlock);
+        int* tConnectivity = tMesh->getElemToNodeConnInBlk(tBlock);
+        tBlockData.connectivity.assign(tConnectivity, tConnectivity + tNumElements * tBlockData.nodes_per_elem);
+        tBlockData.elem_ids.assign(tMesh->elemGlobalIds + tElementOffset, tMesh->elemGlobalIds + tElementOffset + tNumElements);
+        tElementOffset += tNumElements;
+        aMeshData.blocks.push_back(tBlockData);
+    }
+
+    // nodal fields are read from the data container so that ghost values match what WriteOutput writes
+    std::vector<Plato::LocalArg> tFields = aOutputData;
+    tFields.push_back(Plato::LocalArg {Plato::data::layout_t::SCALAR_FIELD, aIsoFieldName});
+    for(auto& tField : tFields)
+    {
+        if(tField.mLayout == Plato::data::layout_t::SCALAR_FIELD)
+        {
+            DistributedVector* tVector = aPlatoApp->getNodeField(tField.mName);
+            Real* tData = nullptr;
+            tDataContainer->getVariable(tVector->getDataIndices()[0], tData);
+            aMeshData.nodal_fields[tField.mName].assign(tData, tData + tNumNodes);
+        }
+        else if(tField.mLayout == Plato::data::layout_t::ELEMENT_FIELD)
+        {
+            double* tData = aPlatoApp->getElementFieldData(tField.mName);
+            aMeshData.element_fields[tField.mName].assign(tData, tData + tMesh->getNumElems());
+        }
+    }
+}
+
+}
+// namespace
+#endif
+
 PlatoMainOutput::PlatoMainOutput(const std::string& aBaseName,
                                  const std::string& aDiscretization,
                                  const std::string& aRestartFieldName,
@@ -113,6 +258,8 @@ PlatoMainOutput::PlatoMainOutput(PlatoApp* aPlatoApp, Plato::InputData& aNode) :
     mRestartFieldName = "control";
     if(aNode.size<std::string>("RestartFieldName"))
         mRestartFieldName = Plato::Get::String(aNode, "RestartFieldName");
+    std::string tDefaultRestartFormat("exodus");
+    mRestartFormat = Plato::Get::String(aNode, "RestartFormat", tDefaultRestartFormat);
     if(aNode.size<std::string>("OutputFrequency"))
         mOutputFrequency = Plato::Get::Int(aNode, "OutputFrequency");
     if(aNode.size<std::string>("MaxIterations"))
@@ -152,10 +299,42 @@ PlatoMainOutput::PlatoMainOutput(PlatoApp* aPlatoApp, Plato::InputData& aNode) :
     mBaseName = Plato::Get::String(tSurfaceExtractionNode, "BaseName", tDefaultName);
 
     mAppendIterationCount = Plato::Get::Bool(tSurfaceExtractionNode, "AppendIterationCount", /*defaultValue=*/true);
+
+    // asynchronous extraction works on an in-memory copy of the mesh and fields
+    mInMemoryExtraction = Plato::Get::Bool(tSurfaceExtractionNode, "InMemory", /*defaultValue=*/false);
+    mAsynchronousExtraction = Plato::Get::Bool(tSurfaceExtractionNode, "Asynchronous", /*defaultValue=*/false);
+    mExtractionNumThreads = Plato::Get::Int(tSurfaceExtractionNode, "NumThreads", /*defaultValue=*/1);
+    if(mExtractionNumThreads < 1)
+    {
+        throw Plato::ParsingException("PlatoMainOutput: SurfaceExtraction NumThreads must be at least 1.");
+    }
+    if(mAsynchronousExtraction)
+    {
+        mInMemoryExtraction = true;
+        if(!this->isAsynchronousExtractionSupported())
+        {
+            int tMyRank = 0;
+            MPI_Comm_rank(mPlatoApp->getComm(), &tMyRank);
+            if(tMyRank == 0)
+            {
+                Plato::Console::Alert("PlatoMainOutput: MPI_THREAD_MULTIPLE is not provided, iso-surface extraction will run synchronously.");
+            }
+        }
+    }
 }
 
 PlatoMainOutput::~PlatoMainOutput()
 {
+    if(mExtractionThread.joinable())
+    {
+        mExtractionThread.join();
+    }
+    int tIsFinalized = 0;
+    MPI_Finalized(&tIsFinalized);
+    if(mExtractionComm != MPI_COMM_NULL && !tIsFinalized)
+    {
+        MPI_Comm_free(&mExtractionComm);
+    }
 }
 
 void PlatoMainOutput::getArguments(std::vector<Plato::LocalArg>& aLocalArgs)
@@ -191,14 +370,6 @@ void PlatoMainOutput::extractIsoSurface(int aIteration)
         output_filename += tIterationNumberString;
     }
     output_filename += ".exo";
-    iso::STKExtract ex;
-    std::string input_filename = "platomain.exo";
-    int num_procs = 0;
-    MPI_Comm_size(mPlatoApp->getComm(), &num_procs);
-    if(num_procs == 1)
-    {
-        input_filename += ".1.0";
-    }
 
     std::string tOutputFields = "";
     for(size_t i=0; i<mOutputData.size(); ++i)
@@ -209,6 +380,22 @@ void PlatoMainOutput::extractIsoSurface(int aIteration)
             tOutputFields += ",";
         }
     }
+
+    if(mInMemoryExtraction)
+    {
+        this->extractIsoSurfaceInMemory(aIteration, output_filename, tOutputFields, tIterationNumberString);
+        return;
+    }
+
+    iso::STKExtract ex;
+    std::string input_filename = "platomain.exo";
+    int num_procs = 0;
+    MPI_Comm_size(mPlatoApp->getComm(), &num_procs);
+    if(num_procs == 1)
+    {
+        input_filename += ".1.0";
+    }
+
     if(ex.create_mesh_apis_read_from_file((stk::ParallelMachine*)(&(mPlatoApp->getComm())), // MPI_Comm
                     input_filename,// input filename
                     output_filename,// output filename
@@ -223,23 +410,151 @@ void PlatoMainOutput::extractIsoSurface(int aIteration)
                     1,// read spread file
                     aIteration))// time step/iteration
     {
+        ex.num_threads(mExtractionNumThreads);
         ex.run_extraction(aIteration, 1);
     }
     int my_rank = 0;
     MPI_Comm_rank(mPlatoApp->getComm(), &my_rank);
     if(my_rank == 0)
     {
-        FILE *fp = fopen("last_time_step.txt", "w");
-        if(fp)
+        this->writeLastTimeStepFile(tIterationNumberString);
+    }
+#endif
+}
+
+void PlatoMainOutput::extractIsoSurfaceInMemory(int aIteration,
+                                                const std::string & aOutputFilename,
+                                                const std::string & aOutputFields,
+                                                const std::string & aIterationString)
+{
+#ifdef ENABLE_ISO
+    // copy the mesh and fields now; the optimizer may overwrite them while a background extraction runs
+    auto tMeshData = std::make_shared<IVEMeshData>();
+    buildIsoMeshData(mPlatoApp, "Topology", mOutputData, *tMeshData);
+
+    int tMyRank = 0;
+    MPI_Comm_rank(mPlatoApp->getComm(), &tMyRank);
+    const bool tRunAsynchronously = mAsynchronousExtraction && this->isAsynchronousExtractionSupported();
+    stk::ParallelMachine* tComm = (stk::ParallelMachine*)(&(mPlatoApp->getComm()));
+    if(tRunAsynchronously)
+    {
+        // the extraction thread communicates on its own communicator so its collectives
+        // never match the ones issued by the next optimization iteration
+        if(mExtractionComm == MPI_COMM_NULL)
+        {
+            MPI_Comm_dup(mPlatoApp->getComm(), &mExtractionComm);
+        }
+        tComm = &mExtractionComm;
+    }
+
+    auto tExtract = [this, tMeshData, tComm, aIteration, aOutputFilename, aOutputFields, aIterationString, tMyRank]()
+    {
+        iso::STKExtract ex;
+        if(ex.create_mesh_apis_from_data(tComm, // MPI_Comm
+                        *tMeshData,// in-memory mesh and fields
+                        aOutputFilename,// output filename
+                        "Topology",// iso field name
+                        aOutputFields,// names of fields to output
+                        mRequestedFormats,// names of formats to write
+                        1e-5,// min edge length
+                        0.5,// iso value
+                        0,// level_set data?
+                        mOutputMethod,// epu results
+                        1,// iso_only
+                        aIteration))// time step/iteration
+        {
+            ex.num_threads(mExtractionNumThreads);
+            ex.run_extraction(aIteration, 1);
+        }
+        if(tMyRank == 0)
         {
-            fprintf(fp, "%s\n", tIterationNumberString.c_str());
-            fclose(fp);
-            Plato::system("ls Iteration*.exo >> last_time_step.txt");
+            this->writeLastTimeStepFile(aIterationString);
         }
+    };
+
+    if(tRunAsynchronously)
+    {
+        mExtractionThread = std::thread([this, tExtract]()
+        {
+            try
+            {
+                tExtract();
+            }
+            catch(...)
+            {
+                mExtractionError = std::current_exception();
+            }
+        });
+    }
+    else
+    {
+        tExtract();
     }
 #endif
 }
 
+void PlatoMainOutput::waitForIsoSurfaceExtraction()
+{
+    if(mExtractionThread.joinable())
+    {
+        mExtractionThread.join();
+    }
+    if(mExtractionError)
+    {
+        std::exception_ptr tError = mExtractionError;
+        mExtractionError = nullptr;
+        std::rethrow_exception(tError);
+    }
+}
+
+bool PlatoMainOutput::isAsynchronousExtractionSupported() const
+{
+    int tProvided = MPI_THREAD_SINGLE;
+    MPI_Query_thread(&tProvided);
+    return tProvided == MPI_THREAD_MULTIPLE;
+}
+
+void PlatoMainOutput::writeNativeRestart(int aIteration)
+{
+    // owned entries of the overlap vector, i.e. the values WriteOutput sees
+    DistributedVector* tField = mPlatoApp->getNodeField(mRestartFieldName);
+    const Epetra_BlockMap& tOverlapMap = tField->getAssemblyEpetraVector()->Map();
+    const Epetra_BlockMap& tOwnedMap = tField->getEpetraVector()->Map();
+    Real* tData = nullptr;
+    tField->ExtractView(&tData);
+
+    std::vector<long long> tGlobalIds;
+    std::vector<double> tValues;
+    for(int tIndex = 0; tIndex < tField->MyLength(); tIndex++)
+    {
+        const int tGlobalId = tOverlapMap.GID(tIndex);
+        if(tOwnedMap.MyGID(tGlobalId))
+        {
+            tGlobalIds.push_back(tGlobalId);
+            tValues.push_back(tData[tIndex]);
+        }
+    }
+
+    const std::string tFileName = "restart_" + std::to_string(aIteration) + ".plato";
+    Plato::write_restart_field(mPlatoApp->getComm(), tFileName, mRestartFieldName, aIteration, tGlobalIds, tValues);
+}
+
+void PlatoMainOutput::writeLastTimeStepFile(const std::string & aIterationString)
+{
+    FILE *tFile = fopen("last_time_step.txt", "w");
+    if(tFile == nullptr)
+    {
+        return;
+    }
+    fprintf(tFile, "%s\n", aIterationString.c_str());
+
+    for(auto& tName : listWorkingDirectoryFiles("Iteration", ".exo"))
+    {
+        fprintf(tFile, "%s\n", tName.c_str());
+    }
+    fclose(tFile);
+}
+
 void PlatoMainOutput::operator()()
 {
     // time operation
@@ -253,6 +568,9 @@ void PlatoMainOutput::operator()()
     tTime += 1.0;
     tLightMP->setCurrentTime(tTime);
     int tIntegerTime = (int)tTime;
+
+    // the exodus library is not thread safe; finish a pending extraction before writing
+    this->waitForIsoSurfaceExtraction();
     tLightMP->WriteOutput();
     int tMyRank = 0;
     MPI_Comm_rank(mPlatoApp->getComm(), &tMyRank);
@@ -263,7 +581,11 @@ void PlatoMainOutput::operator()()
             this->extractIsoSurface(tIntegerTime);
 
             // Write restart file
-            if((tMyRank == 0) && mWriteRestart)
+            if(mWriteRestart && mRestartFormat == "native")
+            {
+                this->writeNativeRestart(tIntegerTime);
+            }
+            else if((tMyRank == 0) && mWriteRestart)
             {
                 std::ostringstream tTheCommand;
                 std::string tInputFilename = "platomain.exo.1.0";
@@ -284,36 +606,29 @@ void PlatoMainOutput::operator()()
         }
         else if(mDiscretization == "levelset")
         {
+            if(mWriteRestart && mRestartFormat == "native")
+            {
+                this->writeNativeRestart(tIntegerTime);
+            }
             if((tMyRank == 0) && mWriteRestart)
             {
-                std::string tListCommand = "ls -t IterationHistory* > junk.txt";
-                Plato::system(tListCommand.c_str());
-                FILE *tFile = fopen("junk.txt", "r");
-                if(tFile)
+                // keep the newest iso-surface history file as this iteration's output
+                std::vector<std::string> tHistoryFiles = listWorkingDirectoryFiles("IterationHistory", "");
+                std::string tLastHistFileName = newestFile(tHistoryFiles);
+                std::string tIterationString = "";
+                buildIterationNumberString(tIntegerTime, tIterationString);
+                if(!tLastHistFileName.empty())
+                {
+                    std::string tNewFilename = "Iteration" + tIterationString + ".exo";
+                    std::ifstream tSource(tLastHistFileName, std::ios::binary);
+                    std::ofstream tDestination(tNewFilename, std::ios::binary);
+                    tDestination << tSource.rdbuf();
+                }
+                for(auto& tName : tHistoryFiles)
                 {
-                    char tLastHistFileName[200] = " ";
-                    auto tTrash = fscanf(tFile, "%s", tLastHistFileName);
-                    Plato::Utils::ignore_unused(tTrash);
-                    fclose(tFile);
-                    std::string tNewFilename = "Iteration";
-                    std::string tIterationString = "";
-                    buildIterationNumberString(tIntegerTime, tIterationString);
-                    tNewFilename += tIterationString;
-                    tNewFilename += ".exo";
-                    std::string tCopyCommand = "cp ";
-                    tCopyCommand += tLastHistFileName;
-                    tCopyCommand += " ";
-                    tCopyCommand += tNewFilename;
-                    Plato::system(tCopyCommand.c_str());
-                    Plato::system("rm -f IterationHistory*");
-                    tFile = fopen("last_time_step.txt", "w");
-                    if(tFile)
-                    {
-                        fprintf(tFile, "%s\n", tIterationString.c_str());
-                        fclose(tFile);
-                        Plato::system("ls Iteration*.exo >> last_time_step.txt");
-                    }
+                    std::remove(tName.c_str());
                 }
+                this->writeLastTimeStepFile(tIterationString);
             }
         }
     }
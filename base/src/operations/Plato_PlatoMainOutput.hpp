@@ -48,6 +48,11 @@
 
 #pragma once
 
+#include <mpi.h>
+
+#include <thread>
+#include <exception>
+
 #include "Plato_LocalOperation.hpp"
 
 namespace Plato
@@ -108,9 +113,13 @@ public:
       aArchive & boost::serialization::make_nvp("Discretization",mDiscretization);
       aArchive & boost::serialization::make_nvp("WriteRestart",mWriteRestart);
       aArchive & boost::serialization::make_nvp("RestartFieldName",mRestartFieldName);
+      aArchive & boost::serialization::make_nvp("RestartFormat",mRestartFormat);
       aArchive & boost::serialization::make_nvp("BaseName",mBaseName);
       aArchive & boost::serialization::make_nvp("AppendIterationCount",mAppendIterationCount);
       aArchive & boost::serialization::make_nvp("RequestedFormats",mRequestedFormats);
+      aArchive & boost::serialization::make_nvp("InMemoryExtraction",mInMemoryExtraction);
+      aArchive & boost::serialization::make_nvp("AsynchronousExtraction",mAsynchronousExtraction);
+      aArchive & boost::serialization::make_nvp("ExtractionNumThreads",mExtractionNumThreads);
     }
 
 private:
@@ -120,6 +129,45 @@ private:
      **********************************************************************************/
     void extractIsoSurface(int aIteration);
 
+    /******************************************************************************//**
+     * @brief Extract iso-surface from the in-memory mesh and fields, skipping the
+     *   platomain.exo round trip. If asynchronous extraction is enabled, the mesh and
+     *   fields are copied and the extraction runs on a background thread.
+     * @param [in] aIteration current optimization iteration
+     * @param [in] aOutputFilename iso-surface output file name
+     * @param [in] aOutputFields comma separated names of the fields to output
+     * @param [in] aIterationString zero padded iteration string
+     **********************************************************************************/
+    void extractIsoSurfaceInMemory(int aIteration,
+                                   const std::string & aOutputFilename,
+                                   const std::string & aOutputFields,
+                                   const std::string & aIterationString);
+
+    /******************************************************************************//**
+     * @brief Wait for a pending asynchronous iso-surface extraction, rethrow its error if any
+     **********************************************************************************/
+    void waitForIsoSurfaceExtraction();
+
+    /******************************************************************************//**
+     * @brief Return true if the MPI library allows the extraction thread to communicate
+     *   while the main thread keeps optimizing, i.e. MPI_THREAD_MULTIPLE is provided
+     **********************************************************************************/
+    bool isAsynchronousExtractionSupported() const;
+
+    /******************************************************************************//**
+     * @brief Collectively write the restart field to restart_<iteration>.plato, see
+     *   Plato::write_restart_field
+     * @param [in] aIteration current optimization iteration
+     **********************************************************************************/
+    void writeNativeRestart(int aIteration);
+
+    /******************************************************************************//**
+     * @brief Write last_time_step.txt: the iteration string followed by the names of
+     *   the Iteration*.exo files in the working directory
+     * @param [in] aIterationString zero padded iteration string
+     **********************************************************************************/
+    void writeLastTimeStepFile(const std::string & aIterationString);
+
     /******************************************************************************//**
      * @brief build a string based on the current iteration
      * @param [in] aCurIteration current optimization iteration
@@ -136,9 +184,17 @@ private:
     std::string mDiscretization = "density"; /*!< topology representation, density or levelset */
     bool mWriteRestart; /*!< flag - write restart file */
     std::string mRestartFieldName; /*!< name of field to put in restart file */
+    std::string mRestartFormat = "exodus"; /*!< restart file format: exodus (epu/algebra) or native */
     std::string mBaseName; /*!< output file base name */
     bool mAppendIterationCount; /*!< flag - append optimization iteration count */
     std::vector<std::string> mRequestedFormats; /*!< names of formats to write */
+    bool mInMemoryExtraction = false; /*!< flag - extract iso-surface from the in-memory mesh */
+    bool mAsynchronousExtraction = false; /*!< flag - run in-memory extraction on a background thread */
+    int mExtractionNumThreads = 1; /*!< number of threads used to gather element data during extraction */
+
+    std::thread mExtractionThread; /*!< background iso-surface extraction */
+    std::exception_ptr mExtractionError; /*!< error raised by the background extraction */
+    MPI_Comm mExtractionComm = MPI_COMM_NULL; /*!< duplicate of the PlatoMain communicator used by the background extraction */
 };
 // class PlatoMainOutput
 
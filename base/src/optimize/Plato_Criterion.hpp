@@ -50,6 +50,7 @@
 #define PLATO_CRITERION_HPP_
 
 #include <memory>
+#include <vector>
 
 namespace Plato
 {
@@ -89,6 +90,23 @@ public:
     ***********************************************************************************/
     virtual ScalarType value(const Plato::MultiVector<ScalarType, OrdinalType> & aControl) = 0;
 
+    /******************************************************************************//**
+     * Evaluate criterion function at a batch of controls. The default implementation
+     * evaluates the controls one at a time; criteria able to evaluate several controls
+     * concurrently should override it.
+     * @param [in] aControls: batch of control, i.e. design, variables
+     * @param [in/out] aOutput: criterion values, one per control
+    ***********************************************************************************/
+    virtual void values(const std::vector<std::shared_ptr<Plato::MultiVector<ScalarType, OrdinalType>>> & aControls,
+                        std::vector<ScalarType> & aOutput)
+    {
+        aOutput.resize(aControls.size());
+        for(size_t tIndex = 0; tIndex < aControls.size(); tIndex++)
+        {
+            aOutput[tIndex] = this->value(*aControls[tIndex]);
+        }
+    }
+
     /******************************************************************************//**
      * Evaluate criterion function gradient
      * @param [in] aControl: control, i.e. design, variables
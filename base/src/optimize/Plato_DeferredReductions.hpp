@@ -0,0 +1,299 @@
+/*
+ * Plato_DeferredReductions.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+//
+// *************************************************************************
+//@HEADER
+*/
+
+
+#ifndef PLATO_DEFERREDREDUCTIONS_HPP_
+#define PLATO_DEFERREDREDUCTIONS_HPP_
+
+#include <vector>
+#include <cassert>
+
+#include "Plato_Vector.hpp"
+#include "Plato_MultiVector.hpp"
+#include "Plato_ReductionOperations.hpp"
+
+namespace Plato
+{
+
+/******************************************************************************//**
+ * @brief Queue of independent global reductions evaluated with a single collective.
+ *
+ * Each add function computes this process' contribution immediately, so work vectors
+ * may be reused between calls, and returns a handle. A call to evaluate reduces every
+ * queued contribution at once; the results are then available through get. Contributions
+ * are kept apart from the results, so more reductions may be queued after evaluate and
+ * the next evaluate reduces every queued contribution exactly once.
+ *
+ * Example:
+ *   Plato::DeferredReductions<ScalarType, OrdinalType> tReductions(*mControlReductionOps);
+ *   const OrdinalType tNorm = tReductions.addDot(tGradient, tGradient);
+ *   const OrdinalType tMax = tReductions.addMax(tControl);
+ *   tReductions.evaluate();
+ *   std::sqrt(tReductions.get(tNorm));
+**********************************************************************************/
+template<typename ScalarType, typename OrdinalType = size_t>
+class DeferredReductions
+{
+public:
+    /******************************************************************************//**
+     * @brief Constructor
+     * @param [in] aReductions reduction operations used to compute and reduce contributions
+    **********************************************************************************/
+    explicit DeferredReductions(const Plato::ReductionOperations<ScalarType, OrdinalType> & aReductions) :
+            mIsEvaluated(false),
+            mReductions(aReductions),
+            mSums(),
+            mMaxes(),
+            mSumResults(),
+            mMaxResults(),
+            mHandles()
+    {
+    }
+
+    /******************************************************************************//**
+     * @brief Destructor
+    **********************************************************************************/
+    ~DeferredReductions()
+    {
+    }
+
+    /******************************************************************************//**
+     * @brief Queue global sum of all the elements in the container
+     * @param [in] aInput array of elements
+     * @return handle to the result
+    **********************************************************************************/
+    OrdinalType addSum(const Plato::Vector<ScalarType, OrdinalType> & aInput)
+    {
+        return (this->addLocalSum(mReductions.localSum(aInput)));
+    }
+
+    /******************************************************************************//**
+     * @brief Queue global sum of all the elements in the multi-vector
+     * @param [in] aInput multi-vector
+     * @return handle to the result
+    **********************************************************************************/
+    OrdinalType addSum(const Plato::MultiVector<ScalarType, OrdinalType> & aInput)
+    {
+        ScalarType tLocalSum = 0;
+        const OrdinalType tNumVectors = aInput.getNumVectors();
+        for(OrdinalType tIndex = 0; tIndex < tNumVectors; tIndex++)
+        {
+            tLocalSum += mReductions.localSum(aInput[tIndex]);
+        }
+        return (this->addLocalSum(tLocalSum));
+    }
+
+    /******************************************************************************//**
+     * @brief Queue global inner product
+     * @param [in] aInputOne array of elements
+     * @param [in] aInputTwo array of elements
+     * @return handle to the result
+    **********************************************************************************/
+    OrdinalType addDot(const Plato::Vector<ScalarType, OrdinalType> & aInputOne,
+                       const Plato::Vector<ScalarType, OrdinalType> & aInputTwo)
+    {
+        return (this->addLocalSum(mReductions.localDot(aInputOne, aInputTwo)));
+    }
+
+    /******************************************************************************//**
+     * @brief Queue global inner product of two multi-vectors, i.e. the sum over all vectors
+     * @param [in] aInputOne multi-vector
+     * @param [in] aInputTwo multi-vector
+     * @return handle to the result
+    **********************************************************************************/
+    OrdinalType addDot(const Plato::MultiVector<ScalarType, OrdinalType> & aInputOne,
+                       const Plato::MultiVector<ScalarType, OrdinalType> & aInputTwo)
+    {
+        assert(aInputOne.getNumVectors() == aInputTwo.getNumVectors());
+
+        ScalarType tLocalInnerProduct = 0;
+        const OrdinalType tNumVectors = aInputOne.getNumVectors();
+        for(OrdinalType tIndex = 0; tIndex < tNumVectors; tIndex++)
+        {
+            tLocalInnerProduct += mReductions.localDot(aInputOne[tIndex], aInputTwo[tIndex]);
+        }
+        return (this->addLocalSum(tLocalInnerProduct));
+    }
+
+    /******************************************************************************//**
+     * @brief Queue global maximum element in range
+     * @param [in] aInput array of elements
+     * @return handle to the result
+    **********************************************************************************/
+    OrdinalType addMax(const Plato::Vector<ScalarType, OrdinalType> & aInput)
+    {
+        return (this->addLocalMax(mReductions.localMax(aInput)));
+    }
+
+    /******************************************************************************//**
+     * @brief Queue global minimum element in range
+     * @param [in] aInput array of elements
+     * @return handle to the result
+    **********************************************************************************/
+    OrdinalType addMin(const Plato::Vector<ScalarType, OrdinalType> & aInput)
+    {
+        return (this->addLocalMin(mReductions.localMin(aInput)));
+    }
+
+    /******************************************************************************//**
+     * @brief Queue global sum of a value already computed by this process
+     * @param [in] aLocalValue this process' contribution
+     * @return handle to the result
+    **********************************************************************************/
+    OrdinalType addLocalSum(const ScalarType & aLocalValue)
+    {
+        mIsEvaluated = false;
+        mSums.push_back(aLocalValue);
+        mHandles.push_back(Entry{false, false, static_cast<OrdinalType>(mSums.size() - 1u)});
+        return (static_cast<OrdinalType>(mHandles.size() - 1u));
+    }
+
+    /******************************************************************************//**
+     * @brief Queue global maximum of a value already computed by this process
+     * @param [in] aLocalValue this process' contribution
+     * @return handle to the result
+    **********************************************************************************/
+    OrdinalType addLocalMax(const ScalarType & aLocalValue)
+    {
+        mIsEvaluated = false;
+        mMaxes.push_back(aLocalValue);
+        mHandles.push_back(Entry{true, false, static_cast<OrdinalType>(mMaxes.size() - 1u)});
+        return (static_cast<OrdinalType>(mHandles.size() - 1u));
+    }
+
+    /******************************************************************************//**
+     * @brief Queue global minimum of a value already computed by this process
+     * @param [in] aLocalValue this process' contribution
+     * @return handle to the result
+    **********************************************************************************/
+    OrdinalType addLocalMin(const ScalarType & aLocalValue)
+    {
+        // min(x) = -max(-x), so minimums share the maximum reduction
+        const OrdinalType tHandle = this->addLocalMax(-aLocalValue);
+        mHandles[tHandle].mIsNegated = true;
+        return (tHandle);
+    }
+
+    /******************************************************************************//**
+     * @brief Reduce all queued contributions with one collective
+    **********************************************************************************/
+    void evaluate()
+    {
+        if(mIsEvaluated == false)
+        {
+            mSumResults = mSums;
+            mMaxResults = mMaxes;
+            mReductions.reduce(mSumResults, mMaxResults);
+            mIsEvaluated = true;
+        }
+    }
+
+    /******************************************************************************//**
+     * @brief Return global result of a queued reduction
+     * @param [in] aHandle handle returned by an add function
+     * @return global result
+    **********************************************************************************/
+    ScalarType get(const OrdinalType & aHandle) const
+    {
+        assert(mIsEvaluated == true);
+        assert(aHandle < mHandles.size());
+        const Entry & tEntry = mHandles[aHandle];
+        if(tEntry.mIsMax == false)
+        {
+            return (mSumResults[tEntry.mIndex]);
+        }
+        return (tEntry.mIsNegated ? -mMaxResults[tEntry.mIndex] : mMaxResults[tEntry.mIndex]);
+    }
+
+    /******************************************************************************//**
+     * @brief Return number of queued reductions
+     * @return number of queued reductions
+    **********************************************************************************/
+    OrdinalType size() const
+    {
+        return (mHandles.size());
+    }
+
+    /******************************************************************************//**
+     * @brief Remove all queued reductions
+    **********************************************************************************/
+    void clear()
+    {
+        mIsEvaluated = false;
+        mSums.clear();
+        mMaxes.clear();
+        mSumResults.clear();
+        mMaxResults.clear();
+        mHandles.clear();
+    }
+
+private:
+    struct Entry
+    {
+        bool mIsMax; /*!< result lives in the maximum buffer */
+        bool mIsNegated; /*!< minimum stored as the maximum of the negated value */
+        OrdinalType mIndex; /*!< index into the sum or maximum buffer */
+    };
+
+    bool mIsEvaluated; /*!< queued contributions have been reduced */
+    const Plato::ReductionOperations<ScalarType, OrdinalType> & mReductions; /*!< reduction operations interface */
+    std::vector<ScalarType> mSums; /*!< packed contributions to global sums */
+    std::vector<ScalarType> mMaxes; /*!< packed contributions to global maximums */
+    std::vector<ScalarType> mSumResults; /*!< global sums computed by the last evaluate */
+    std::vector<ScalarType> mMaxResults; /*!< global maximums computed by the last evaluate */
+    std::vector<Entry> mHandles; /*!< location of each queued reduction */
+
+private:
+    DeferredReductions(const Plato::DeferredReductions<ScalarType, OrdinalType> &);
+    Plato::DeferredReductions<ScalarType, OrdinalType> & operator=(const Plato::DeferredReductions<ScalarType, OrdinalType> &);
+};
+// class DeferredReductions
+
+} // namespace Plato
+
+#endif /* PLATO_DEFERREDREDUCTIONS_HPP_ */
@@ -80,6 +80,7 @@ public:
     Diagnostics() :
         mDidHessianTestPassed(false),
         mDidGradientTestPassed(false),
+        mUseBatchedEvaluations(false),
         mFinalSuperscript(8),
         mInitialSuperscript(1),
         mRandomNumLowerBound(0.05),
@@ -176,6 +177,18 @@ public:
         mInitialSuperscript = aInput;
     }
 
+    /******************************************************************************//**
+     * @brief Evaluate all the perturbed controls of the finite difference gradient check
+     * with a single batched criterion evaluation, so criteria able to evaluate several
+     * controls concurrently do so. Every perturbed control is stored up front, i.e. four
+     * control copies per finite difference step.  Default value is set to false.
+     * @param [in] aInput flag (true = batched evaluations & false = serial evaluations)
+    **********************************************************************************/
+    void setUseBatchedEvaluations(const bool & aInput)
+    {
+        mUseBatchedEvaluations = aInput;
+    }
+
     /******************************************************************************//**
      * @brief Check if criterion's analytical gradient is correctly implemented by the
      * application.  The test is based on a four-point finite difference approximation.
@@ -217,42 +230,30 @@ public:
         aCriterion.gradient(aControl, *tGradient);
         this->checkValues(*tGradient, "CRITERION GRADIENT");
 
+        // Criterion values at x + \epsilon\Delta{x}, x - \epsilon\Delta{x}, x + 2\epsilon\Delta{x} and x - 2\epsilon\Delta{x}
+        // for each step size, where x denotes the control vector and \Delta{x} denotes the step.
+        std::vector<ScalarType> tPerturbedValues;
+        if(mUseBatchedEvaluations == true)
+        {
+            this->evaluatePerturbedControlsInBatch(aCriterion, aControl, *tStep, tPerturbedValues);
+        }
+        else
+        {
+            this->evaluatePerturbedControls(aCriterion, aControl, *tStep, tPerturbedValues);
+        }
+
         std::vector<ScalarType> tApproximationErrors;
         std::vector<ScalarType> tFiniteDiffApprox;
         const ScalarType tTruthGradientDotStep = Plato::dot(*tGradient, *tStep);
-        std::shared_ptr<Plato::MultiVector<ScalarType, OrdinalType>> tWork = aControl.create();
-        this->checkDimensions(*tWork, "CONTROL WORK");
-
         for(int tIndex = mInitialSuperscript; tIndex <= mFinalSuperscript; tIndex++)
         {
-            // Compute \hat{x} = x + \epsilon\Delta{x}, where x denotes the control vector and \Delta{x} denotes the step.
             ScalarType tEpsilon = static_cast<ScalarType>(1) /
                     std::pow(static_cast<ScalarType>(10), tIndex);
-            Plato::update(static_cast<ScalarType>(1), aControl, static_cast<ScalarType>(0), *tWork);
-            Plato::update(tEpsilon, *tStep, static_cast<ScalarType>(1), *tWork);
-            ScalarType tObjectiveValueAtPlusEpsilon = aCriterion.value(*tWork);
-            this->checkValues(tObjectiveValueAtPlusEpsilon, "CRITERION VALUE");
-
-            // Compute \hat{x} = x - \epsilon\Delta{x}, where x denotes the control vector and \Delta{x} denotes the step.
-            Plato::update(static_cast<ScalarType>(1), aControl, static_cast<ScalarType>(0), *tWork);
-            ScalarType tMultiplier = static_cast<ScalarType>(-1) * tEpsilon;
-            Plato::update(tMultiplier, *tStep, static_cast<ScalarType>(1), *tWork);
-            ScalarType tObjectiveValueAtMinusEpsilon = aCriterion.value(*tWork);
-            this->checkValues(tObjectiveValueAtMinusEpsilon, "CRITERION VALUE");
-
-            // Compute \hat{x} = x + 2\epsilon\Delta{x}, where x denotes the control vector and \Delta{x} denotes the step.
-            Plato::update(static_cast<ScalarType>(1), aControl, static_cast<ScalarType>(0), *tWork);
-            tMultiplier = static_cast<ScalarType>(2) * tEpsilon;
-            Plato::update(tMultiplier, *tStep, static_cast<ScalarType>(1), *tWork);
-            ScalarType tObjectiveValueAtPlusTwoEpsilon = aCriterion.value(*tWork);
-            this->checkValues(tObjectiveValueAtPlusTwoEpsilon, "CRITERION VALUE");
-
-            // Compute \hat{x} = x - 2\epsilon\Delta{x}, where x denotes the control vector and \Delta{x} denotes the step.
-            Plato::update(static_cast<ScalarType>(1), aControl, static_cast<ScalarType>(0), *tWork);
-            tMultiplier = static_cast<ScalarType>(-2) * tEpsilon;
-            Plato::update(tMultiplier, *tStep, static_cast<ScalarType>(1), *tWork);
-            ScalarType tObjectiveValueAtMinusTwoEpsilon = aCriterion.value(*tWork);
-            this->checkValues(tObjectiveValueAtMinusTwoEpsilon, "CRITERION VALUE");
+            const size_t tOffset = mNumPerturbationsPerStep * static_cast<size_t>(tIndex - mInitialSuperscript);
+            const ScalarType tObjectiveValueAtPlusEpsilon = tPerturbedValues[tOffset];
+            const ScalarType tObjectiveValueAtMinusEpsilon = tPerturbedValues[tOffset + 1];
+            const ScalarType tObjectiveValueAtPlusTwoEpsilon = tPerturbedValues[tOffset + 2];
+            const ScalarType tObjectiveValueAtMinusTwoEpsilon = tPerturbedValues[tOffset + 3];
 
             // Compute objective value approximation via a five point stencil finite difference procedure
             ScalarType tObjectiveAppx = (-tObjectiveValueAtPlusTwoEpsilon
@@ -405,6 +406,103 @@ private:
         }
     }
 
+    /******************************************************************************//**
+     * @brief Compute perturbed control \hat{x} = x + \alpha\Delta{x}, where x denotes the
+     * control vector and \Delta{x} denotes the step.
+     * @param [in] aControl 2D container of control, i.e. optimization, variables
+     * @param [in] aStep 2D container with finite difference step
+     * @param [in] aMultiplier multiplier on finite difference step
+     * @param [in/out] aOutput 2D container with perturbed control
+    **********************************************************************************/
+    void perturb(const Plato::MultiVector<ScalarType, OrdinalType> & aControl,
+                 const Plato::MultiVector<ScalarType, OrdinalType> & aStep,
+                 const ScalarType & aMultiplier,
+                 Plato::MultiVector<ScalarType, OrdinalType> & aOutput)
+    {
+        Plato::update(static_cast<ScalarType>(1), aControl, static_cast<ScalarType>(0), aOutput);
+        Plato::update(aMultiplier, aStep, static_cast<ScalarType>(1), aOutput);
+    }
+
+    /******************************************************************************//**
+     * @brief Return the step multipliers of the finite difference stencil, i.e.
+     * \epsilon, -\epsilon, 2\epsilon and -2\epsilon, for a given superscript.
+     * @param [in] aSuperscript superscript used to compute the finite difference step
+     * @return step multipliers
+    **********************************************************************************/
+    std::vector<ScalarType> getStencilMultipliers(const int & aSuperscript) const
+    {
+        const ScalarType tEpsilon = static_cast<ScalarType>(1) / std::pow(static_cast<ScalarType>(10), aSuperscript);
+        std::vector<ScalarType> tMultipliers = { tEpsilon, static_cast<ScalarType>(-1) * tEpsilon,
+            static_cast<ScalarType>(2) * tEpsilon, static_cast<ScalarType>(-2) * tEpsilon };
+        return (tMultipliers);
+    }
+
+    /******************************************************************************//**
+     * @brief Evaluate criterion at every perturbed control, one control at a time.
+     * @param [in/out] aCriterion interface to application's criterion
+     * @param [in] aControl 2D container of control, i.e. optimization, variables
+     * @param [in] aStep 2D container with finite difference step
+     * @param [out] aOutput criterion values, four per finite difference step
+    **********************************************************************************/
+    void evaluatePerturbedControls(Plato::Criterion<ScalarType, OrdinalType> & aCriterion,
+                                   const Plato::MultiVector<ScalarType, OrdinalType> & aControl,
+                                   const Plato::MultiVector<ScalarType, OrdinalType> & aStep,
+                                   std::vector<ScalarType> & aOutput)
+    {
+        aOutput.clear();
+        std::shared_ptr<Plato::MultiVector<ScalarType, OrdinalType>> tWork = aControl.create();
+        this->checkDimensions(*tWork, "CONTROL WORK");
+        for(int tIndex = mInitialSuperscript; tIndex <= mFinalSuperscript; tIndex++)
+        {
+            std::vector<ScalarType> tMultipliers = this->getStencilMultipliers(tIndex);
+            for(size_t tStencilIndex = 0; tStencilIndex < tMultipliers.size(); tStencilIndex++)
+            {
+                this->perturb(aControl, aStep, tMultipliers[tStencilIndex], *tWork);
+                ScalarType tValue = aCriterion.value(*tWork);
+                this->checkValues(tValue, "CRITERION VALUE");
+                aOutput.push_back(tValue);
+            }
+        }
+    }
+
+    /******************************************************************************//**
+     * @brief Build every perturbed control up front and evaluate them with a single
+     * batched criterion evaluation.
+     * @param [in/out] aCriterion interface to application's criterion
+     * @param [in] aControl 2D container of control, i.e. optimization, variables
+     * @param [in] aStep 2D container with finite difference step
+     * @param [out] aOutput criterion values, four per finite difference step
+    **********************************************************************************/
+    void evaluatePerturbedControlsInBatch(Plato::Criterion<ScalarType, OrdinalType> & aCriterion,
+                                          const Plato::MultiVector<ScalarType, OrdinalType> & aControl,
+                                          const Plato::MultiVector<ScalarType, OrdinalType> & aStep,
+                                          std::vector<ScalarType> & aOutput)
+    {
+        std::vector<std::shared_ptr<Plato::MultiVector<ScalarType, OrdinalType>>> tControls;
+        for(int tIndex = mInitialSuperscript; tIndex <= mFinalSuperscript; tIndex++)
+        {
+            std::vector<ScalarType> tMultipliers = this->getStencilMultipliers(tIndex);
+            for(size_t tStencilIndex = 0; tStencilIndex < tMultipliers.size(); tStencilIndex++)
+            {
+                std::shared_ptr<Plato::MultiVector<ScalarType, OrdinalType>> tWork = aControl.create();
+                this->checkDimensions(*tWork, "CONTROL WORK");
+                this->perturb(aControl, aStep, tMultipliers[tStencilIndex], *tWork);
+                tControls.push_back(tWork);
+            }
+        }
+
+        aOutput.clear();
+        aCriterion.values(tControls, aOutput);
+        if(aOutput.size() != tControls.size())
+        {
+            THROWERR("NUMBER OF CRITERION VALUES DOES NOT MATCH NUMBER OF PERTURBED CONTROLS\n")
+        }
+        for(size_t tIndex = 0; tIndex < aOutput.size(); tIndex++)
+        {
+            this->checkValues(aOutput[tIndex], "CRITERION VALUE");
+        }
+    }
+
     /******************************************************************************//**
      * @brief Evaluate criterion's analytical gradient
      * @param [in] aControl 2D container of control, i.e. optimization, variables
@@ -464,9 +562,11 @@ private:
 private:
     bool mDidHessianTestPassed; /*!< flag: true = Hessian check passed & false = Hessian check did not pass */
     bool mDidGradientTestPassed; /*!< flag: true = gradient check passed & false = gradient check did not pass */
+    bool mUseBatchedEvaluations; /*!< flag: true = evaluate perturbed controls in a single batch & false = one at a time */
 
     int mFinalSuperscript; /*!< superscript on measure used to compute the final finite difference step */
     int mInitialSuperscript; /*!< superscript on measure used to compute the initial finite difference step */
+    static constexpr size_t mNumPerturbationsPerStep = 4; /*!< number of perturbed controls per finite difference step */
 
     ScalarType mRandomNumLowerBound; /*!< lower bound on random number generator */
     ScalarType mRandomNumUpperBound; /*!< upper bound on random number generator */
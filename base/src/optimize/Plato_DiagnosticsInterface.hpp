@@ -95,6 +95,8 @@ public:
         tDiagnostics.setFinalSuperscript(tFinalSuperscript);
         int tInitialSuperscript = mInputData.getDerivativeCheckerInitialSuperscript();
         tDiagnostics.setInitialSuperscript(tInitialSuperscript);
+        bool tBatchedEvaluations = mInputData.getDerivativeCheckerBatchedEvaluations();
+        tDiagnostics.setUseBatchedEvaluations(tBatchedEvaluations);
 
         // ********* ENFORCE BOUNDS ********* //
         Plato::HostBounds<ScalarType, OrdinalType> tProjector;
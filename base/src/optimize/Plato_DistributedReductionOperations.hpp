@@ -74,7 +74,10 @@ public:
      * @param [in] MPI communicator (default = MPI_COMM_WORLD)
     **********************************************************************************/
     DistributedReductionOperations(MPI_Comm aComm = MPI_COMM_WORLD) :
-            mComm(aComm)
+            mComm(aComm),
+            mPackedOp(MPI_OP_NULL),
+            mPackedType(MPI_DATATYPE_NULL),
+            mPackedTypeLength(0)
     {
     }
 
@@ -83,6 +86,16 @@ public:
     **********************************************************************************/
     virtual ~DistributedReductionOperations()
     {
+        int tIsFinalized = 0;
+        MPI_Finalized(&tIsFinalized);
+        if(tIsFinalized == 0)
+        {
+            this->freePackedType();
+            if(mPackedOp != MPI_OP_NULL)
+            {
+                MPI_Op_free(&mPackedOp);
+            }
+        }
     }
 
     /******************************************************************************//**
@@ -197,6 +210,129 @@ public:
         aOutput.mOutputIndex = tOutput.mIndex % tMyNumElements;
     }
 
+    /******************************************************************************//**
+     * @brief Returns this rank's maximum element, i.e. before the reduction across ranks.
+     * @param [in] aInput array of elements
+     * @return local maximum value
+    **********************************************************************************/
+    ScalarType localMax(const Plato::Vector<ScalarType, OrdinalType> & aInput) const
+    {
+        assert(aInput.size() > 0);
+
+        ScalarType tLocalMaxValue = aInput[0];
+        const OrdinalType tSize = aInput.size();
+        for(OrdinalType tIndex = 1; tIndex < tSize; tIndex++)
+        {
+            tLocalMaxValue = std::max(tLocalMaxValue, aInput[tIndex]);
+        }
+        return (tLocalMaxValue);
+    }
+
+    /******************************************************************************//**
+     * @brief Returns this rank's minimum element, i.e. before the reduction across ranks.
+     * @param [in] aInput array of elements
+     * @return local minimum value
+    **********************************************************************************/
+    ScalarType localMin(const Plato::Vector<ScalarType, OrdinalType> & aInput) const
+    {
+        assert(aInput.size() > 0);
+
+        ScalarType tLocalMinValue = aInput[0];
+        const OrdinalType tSize = aInput.size();
+        for(OrdinalType tIndex = 1; tIndex < tSize; tIndex++)
+        {
+            tLocalMinValue = std::min(tLocalMinValue, aInput[tIndex]);
+        }
+        return (tLocalMinValue);
+    }
+
+    /******************************************************************************//**
+     * @brief Returns the sum of this rank's elements, i.e. before the reduction across ranks.
+     * @param [in] aInput array of elements
+     * @return local sum
+    **********************************************************************************/
+    ScalarType localSum(const Plato::Vector<ScalarType, OrdinalType> & aInput) const
+    {
+        ScalarType tLocalSum = 0;
+        const OrdinalType tSize = aInput.size();
+        for(OrdinalType tIndex = 0; tIndex < tSize; tIndex++)
+        {
+            tLocalSum += aInput[tIndex];
+        }
+        return (tLocalSum);
+    }
+
+    /******************************************************************************//**
+     * @brief Returns the inner product of this rank's elements, i.e. before the reduction across ranks.
+     * @param [in] aInputOne array of elements
+     * @param [in] aInputTwo array of elements
+     * @return local inner product
+    **********************************************************************************/
+    ScalarType localDot(const Plato::Vector<ScalarType, OrdinalType> & aInputOne,
+                        const Plato::Vector<ScalarType, OrdinalType> & aInputTwo) const
+    {
+        assert(aInputOne.size() == aInputTwo.size());
+
+        ScalarType tLocalInnerProduct = 0;
+        const OrdinalType tSize = aInputOne.size();
+        for(OrdinalType tIndex = 0; tIndex < tSize; tIndex++)
+        {
+            tLocalInnerProduct += aInputOne[tIndex] * aInputTwo[tIndex];
+        }
+        return (tLocalInnerProduct);
+    }
+
+    /******************************************************************************//**
+     * @brief Reduces packed local sums and maximums across ranks with a single MPI_Allreduce.
+     * @param [in/out] aSums local contributions to global sums
+     * @param [in/out] aMaxes local contributions to global maximums
+     *
+     * If both sums and maximums are requested, the buffer is packed as [number of sums,
+     * sums, maximums] and sent as one contiguous element so a user-defined operation can
+     * apply MPI_SUM and MPI_MAX to its two parts. The operation and the contiguous type
+     * are created on first use and kept until the buffer length changes.
+    **********************************************************************************/
+    void reduce(std::vector<ScalarType> & aSums, std::vector<ScalarType> & aMaxes) const
+    {
+        if(aSums.empty() && aMaxes.empty())
+        {
+            return;
+        }
+        if(aMaxes.empty())
+        {
+            MPI_Allreduce(MPI_IN_PLACE, aSums.data(), aSums.size(), MPI_DOUBLE, MPI_SUM, mComm);
+            return;
+        }
+        if(aSums.empty())
+        {
+            MPI_Allreduce(MPI_IN_PLACE, aMaxes.data(), aMaxes.size(), MPI_DOUBLE, MPI_MAX, mComm);
+            return;
+        }
+
+        const OrdinalType tNumSums = aSums.size();
+        std::vector<ScalarType> tBuffer(1u + tNumSums + aMaxes.size());
+        tBuffer[0] = static_cast<ScalarType>(tNumSums);
+        std::copy(aSums.begin(), aSums.end(), tBuffer.begin() + 1u);
+        std::copy(aMaxes.begin(), aMaxes.end(), tBuffer.begin() + 1u + tNumSums);
+
+        if(mPackedOp == MPI_OP_NULL)
+        {
+            MPI_Op_create(&DistributedReductionOperations::sumAndMax, 1 /* commutative */, &mPackedOp);
+        }
+        if(mPackedTypeLength != tBuffer.size())
+        {
+            this->freePackedType();
+            MPI_Type_contiguous(tBuffer.size(), MPI_DOUBLE, &mPackedType);
+            MPI_Type_commit(&mPackedType);
+            mPackedTypeLength = tBuffer.size();
+        }
+
+        MPI_Allreduce(MPI_IN_PLACE, tBuffer.data(), 1, mPackedType, mPackedOp, mComm);
+
+        std::copy(tBuffer.begin() + 1u, tBuffer.begin() + 1u + tNumSums, aSums.begin());
+        std::copy(tBuffer.begin() + 1u + tNumSums, tBuffer.end(), aMaxes.begin());
+    }
+
     /******************************************************************************//**
      * @brief Returns a copy of a ReductionOperations instance
      * @return copy of this instance
@@ -220,8 +356,52 @@ public:
         return (tNumRanks);
     }
 
+private:
+    /******************************************************************************//**
+     * @brief Free the cached contiguous type used by reduce
+    **********************************************************************************/
+    void freePackedType() const
+    {
+        if(mPackedType != MPI_DATATYPE_NULL)
+        {
+            MPI_Type_free(&mPackedType);
+            mPackedTypeLength = 0;
+        }
+    }
+
+    /******************************************************************************//**
+     * @brief User-defined MPI operation for buffers packed by reduce: sums the first
+     *        part and takes the maximum of the second part of each element.
+    **********************************************************************************/
+    static void sumAndMax(void* aInput, void* aInputOutput, int* aLength, MPI_Datatype* aType)
+    {
+        int tTypeSize = 0;
+        MPI_Type_size(*aType, &tTypeSize);
+        const int tNumEntries = tTypeSize / static_cast<int>(sizeof(double));
+
+        const double* tInput = static_cast<const double*>(aInput);
+        double* tInputOutput = static_cast<double*>(aInputOutput);
+        for(int tElement = 0; tElement < *aLength; tElement++)
+        {
+            const double* tMyInput = tInput + tElement * tNumEntries;
+            double* tMyInputOutput = tInputOutput + tElement * tNumEntries;
+            const int tNumSums = static_cast<int>(tMyInput[0]);
+            for(int tIndex = 1; tIndex <= tNumSums; tIndex++)
+            {
+                tMyInputOutput[tIndex] += tMyInput[tIndex];
+            }
+            for(int tIndex = tNumSums + 1; tIndex < tNumEntries; tIndex++)
+            {
+                tMyInputOutput[tIndex] = std::max(tMyInputOutput[tIndex], tMyInput[tIndex]);
+            }
+        }
+    }
+
 private:
     MPI_Comm mComm; /*!< MPI communicator */
+    mutable MPI_Op mPackedOp; /*!< cached sum-and-max operation used by reduce */
+    mutable MPI_Datatype mPackedType; /*!< cached contiguous type of the packed reduce buffer */
+    mutable size_t mPackedTypeLength; /*!< number of doubles in mPackedType */
 
 private:
     DistributedReductionOperations(const Plato::DistributedReductionOperations<ScalarType, OrdinalType> &);
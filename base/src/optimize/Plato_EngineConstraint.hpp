@@ -57,7 +57,9 @@
 #include "Plato_Criterion.hpp"
 #include "Plato_MultiVector.hpp"
 #include "Plato_DataFactory.hpp"
+#include "Plato_LinearAlgebra.hpp"
 #include "Plato_DistributedVector.hpp"
+#include "Plato_EngineCriterionSlots.hpp"
 #include "Plato_OptimizerEngineStageData.hpp"
 
 namespace Plato
@@ -85,7 +87,8 @@ public:
             mHessianTimesVector(std::vector<ScalarType>(aDataFactory.getNumControls())),
             mInterface(aInterface),
             mEngineInputData(aInputData),
-            mParameterList(std::make_shared<Teuchos::ParameterList>())
+            mParameterList(std::make_shared<Teuchos::ParameterList>()),
+            mValueSlots()
     {
     }
 
@@ -105,7 +108,8 @@ public:
             mHessianTimesVector(),
             mInterface(aInterface),
             mEngineInputData(aInputData),
-            mParameterList(std::make_shared<Teuchos::ParameterList>())
+            mParameterList(std::make_shared<Teuchos::ParameterList>()),
+            mValueSlots()
     {
     }
 
@@ -186,6 +190,36 @@ public:
         return (tOutput);
     }
 
+    /******************************************************************************//**
+     * @brief Evaluate third-party application constraint at a batch of controls
+     * @param [in] aControls batch of 2D containers of optimization variables
+     * @param [out] aOutput constraint residuals, one per control
+     *
+     * If the value stage sets EvaluationSlots, the controls are evaluated concurrently
+     * through its input/output shared data pairs, e.g. one per performer group.
+     * Otherwise, the controls are evaluated one at a time.
+    **********************************************************************************/
+    void values(const std::vector<std::shared_ptr<Plato::MultiVector<ScalarType, OrdinalType>>> & aControls,
+                std::vector<ScalarType> & aOutput)
+    {
+        assert(mInterface != nullptr);
+        const std::string tMyStageName = mEngineInputData.getConstraintValueStageName(mMyConstraintID);
+        mValueSlots.initialize(mInterface, tMyStageName, mEngineInputData.getControlNames(), mEngineInputData.getConstraintValueName(mMyConstraintID));
+        if(mValueSlots.getNumSlots() == static_cast<OrdinalType>(0))
+        {
+            Plato::Criterion<ScalarType, OrdinalType>::values(aControls, aOutput);
+            return;
+        }
+        mValueSlots.evaluate(mInterface, *mParameterList, aControls, aOutput);
+
+        const ScalarType tConstraintTarget = mEngineInputData.getConstraintNormalizedTargetValue(mMyConstraintID);
+        const ScalarType tConstraintReferenceValue = mEngineInputData.getConstraintReferenceValue(mMyConstraintID);
+        for(OrdinalType tIndex = 0; tIndex < aOutput.size(); tIndex++)
+        {
+            aOutput[tIndex] = (aOutput[tIndex] / tConstraintReferenceValue) - tConstraintTarget;
+        }
+    }
+
     /******************************************************************************//**
      * @brief Compute the gradient of one or multiple third-party application constraints
      * @param [in] aControl const reference to 2D container of optimization variables
@@ -294,6 +328,7 @@ private:
     Plato::Interface* mInterface; /*!< PLATO Engine interface */
     Plato::OptimizerEngineStageData mEngineInputData; /*!< Parsed input data */
     std::shared_ptr<Teuchos::ParameterList> mParameterList; /*!< parameter list with data to be communicated through the PLATO Engine interface */
+    Plato::EngineCriterionSlots<ScalarType, OrdinalType> mValueSlots; /*!< evaluation slots of the value stage */
 
 private:
     EngineConstraint(const Plato::EngineConstraint<ScalarType, OrdinalType>&);
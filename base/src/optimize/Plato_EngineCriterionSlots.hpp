@@ -0,0 +1,352 @@
+/*
+ //@HEADER
+ // *************************************************************************
+ //   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+ //                    Solutions of Sandia, LLC (NTESS).
+ //
+ // Under the terms of Contract DE-NA0003525 with NTESS,
+ // the U.S. Government retains certain rights in this software.
+ //
+ // Redistribution and use in source and binary forms, with or without
+ // modification, are permitted provided that the following conditions are
+ // met:
+ //
+ // 1. Redistributions of source code must retain the above copyright
+ // notice, this list of conditions and the following disclaimer.
+ //
+ // 2. Redistributions in binary form must reproduce the above copyright
+ // notice, this list of conditions and the following disclaimer in the
+ // documentation and/or other materials provided with the distribution.
+ //
+ // 3. Neither the name of the Sandia Corporation nor the names of the
+ // contributors may be used to endorse or promote products derived from
+ // this software without specific prior written permission.
+ //
+ // THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+ // EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ // IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+ // PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+ // CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+ // EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ // PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ // PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ // LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ // NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ // SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ //
+ // Questions? Contact the Plato team (plato3D-help@sandia.gov)
+ //
+ // *************************************************************************
+ //@HEADER
+*/
+
+/*
+ * Plato_EngineCriterionSlots.hpp
+ *
+ *  Created on: Oct 17, 2026
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <cassert>
+#include <algorithm>
+
+#include "Plato_Macros.hpp"
+#include "Plato_Parser.hpp"
+#include "Plato_Vector.hpp"
+#include "Plato_Interface.hpp"
+#include "Plato_MultiVector.hpp"
+#include "Plato_StageInputDataMng.hpp"
+
+namespace Plato
+{
+
+/******************************************************************************//**
+ * @brief Evaluate a batch of controls through the evaluation slots of a criterion
+ * value stage, i.e. the stage's input/output shared data pairs. Each slot is typically
+ * served by its own performer group, so one stage call evaluates as many controls
+ * as the stage has slots. Batches larger than the number of slots are evaluated in
+ * fixed rounds of one stage call each; there is no dynamic queue, so a round lasts
+ * as long as its slowest slot. Every slot's operation runs in every round unless it
+ * sets SkipUnchangedInputs, in which case slots left unused in the final round skip
+ * their compute.
+**********************************************************************************/
+template<typename ScalarType, typename OrdinalType = size_t>
+class EngineCriterionSlots
+{
+public:
+    /******************************************************************************//**
+     * @brief Default constructor
+    **********************************************************************************/
+    EngineCriterionSlots() :
+            mIsParsed(false),
+            mNumSlots(0),
+            mStageName(),
+            mInputNames(),
+            mOutputNames(),
+            mSlotControls(),
+            mSlotValues()
+    {
+    }
+
+    /******************************************************************************//**
+     * @brief Destructor
+    **********************************************************************************/
+    ~EngineCriterionSlots()
+    {
+    }
+
+    /******************************************************************************//**
+     * @brief Use the first input/output pairs of a stage as evaluation slots
+     * @param [in] aStageDataMng stage data manager
+     * @param [in] aStageName stage name
+     * @param [in] aNumSlots number of evaluation slots
+    **********************************************************************************/
+    void initialize(const Plato::StageInputDataMng & aStageDataMng, const std::string & aStageName, const OrdinalType & aNumSlots)
+    {
+        assert(aNumSlots <= static_cast<OrdinalType>(aStageDataMng.getNumInputs(aStageName)));
+        assert(aNumSlots <= static_cast<OrdinalType>(aStageDataMng.getNumOutputs(aStageName)));
+        mIsParsed = true;
+        mNumSlots = aNumSlots;
+        mStageName = aStageName;
+        mInputNames.clear();
+        mOutputNames.clear();
+        for(OrdinalType tSlotIndex = 0; tSlotIndex < mNumSlots; tSlotIndex++)
+        {
+            mInputNames.push_back(aStageDataMng.getInput(aStageName, tSlotIndex));
+            mOutputNames.push_back(aStageDataMng.getOutput(aStageName, tSlotIndex));
+        }
+        mSlotControls.assign(mNumSlots, std::vector<ScalarType>());
+        mSlotValues.assign(mNumSlots, static_cast<ScalarType>(0));
+    }
+
+    /******************************************************************************//**
+     * @brief Set the evaluation slots of a criterion value stage from the interface
+     * input data, once per stage. Stages have evaluation slots only if their block sets
+     * EvaluationSlots to true. The first input/output pair must be the control and the
+     * criterion value the optimizer sends, the other inputs must share the control's
+     * layout and size, and every output must be a scalar Global shared data.
+     * @param [in] aInterface PLATO Engine interface
+     * @param [in] aStageName criterion value stage name
+     * @param [in] aControlNames names of the control vectors
+     * @param [in] aValueName name of the criterion value
+    **********************************************************************************/
+    void initialize(Plato::Interface* aInterface,
+                    const std::string & aStageName,
+                    const std::vector<std::string> & aControlNames,
+                    const std::string & aValueName)
+    {
+        if(mIsParsed == true && mStageName == aStageName)
+        {
+            return;
+        }
+        mIsParsed = true;
+        mNumSlots = 0;
+        mStageName = aStageName;
+
+        assert(aInterface != nullptr);
+        Plato::InputData tInputData = aInterface->getInputData();
+        Plato::StageInputDataMng tStageDataMng;
+        auto tStages = tInputData.template getByName<Plato::InputData>("Stage");
+        for(auto tStageNode = tStages.begin(); tStageNode != tStages.end(); ++tStageNode)
+        {
+            if(tStageNode->template get<std::string>("Name") == aStageName)
+            {
+                if(Plato::Get::Bool(*tStageNode, "EvaluationSlots") == false)
+                {
+                    return;
+                }
+                Plato::Parse::parseStageData(*tStageNode, tStageDataMng);
+                break;
+            }
+        }
+        if(tStageDataMng.getNumStages() == 0)
+        {
+            return;
+        }
+
+        const OrdinalType tNumInputs = tStageDataMng.getNumInputs(aStageName);
+        if(tNumInputs < static_cast<OrdinalType>(2) || tNumInputs != static_cast<OrdinalType>(tStageDataMng.getNumOutputs(aStageName)))
+        {
+            THROWERR("STAGE WITH NAME = " + aStageName + " SETS EVALUATION SLOTS BUT DOES NOT HAVE SEVERAL INPUT/OUTPUT PAIRS\n")
+        }
+        if(aControlNames.size() != 1u)
+        {
+            THROWERR("STAGE WITH NAME = " + aStageName + " SETS EVALUATION SLOTS, WHICH ONLY SUPPORT ONE CONTROL VECTOR\n")
+        }
+        if(tStageDataMng.getInput(aStageName, 0) != aControlNames[0] || tStageDataMng.getOutput(aStageName, 0) != aValueName)
+        {
+            THROWERR("STAGE WITH NAME = " + aStageName + " SETS EVALUATION SLOTS, ITS FIRST INPUT/OUTPUT PAIR MUST BE "
+                     + aControlNames[0] + " AND " + aValueName + "\n")
+        }
+
+        const Plato::InputData tControlNode = this->getSharedDataNode(tInputData, aControlNames[0]);
+        for(OrdinalType tSlotIndex = 0; tSlotIndex < tNumInputs; tSlotIndex++)
+        {
+            const std::string & tInputName = tStageDataMng.getInput(aStageName, tSlotIndex);
+            const Plato::InputData tInputNode = this->getSharedDataNode(tInputData, tInputName);
+            if(Plato::Get::String(tInputNode, "Layout", true) != Plato::Get::String(tControlNode, "Layout", true)
+               || Plato::Get::Int(tInputNode, "Size", 1) != Plato::Get::Int(tControlNode, "Size", 1))
+            {
+                THROWERR("EVALUATION SLOT INPUT " + tInputName + " OF STAGE WITH NAME = " + aStageName
+                         + " DOES NOT HAVE THE LAYOUT AND SIZE OF CONTROL " + aControlNames[0] + "\n")
+            }
+
+            const std::string & tOutputName = tStageDataMng.getOutput(aStageName, tSlotIndex);
+            const Plato::InputData tOutputNode = this->getSharedDataNode(tInputData, tOutputName);
+            if(Plato::Get::String(tOutputNode, "Layout", true) != "GLOBAL" || Plato::Get::Int(tOutputNode, "Size", 1) != 1)
+            {
+                THROWERR("EVALUATION SLOT OUTPUT " + tOutputName + " OF STAGE WITH NAME = " + aStageName
+                         + " IS NOT A SCALAR GLOBAL SHARED DATA\n")
+            }
+        }
+
+        this->initialize(tStageDataMng, aStageName, tNumInputs);
+    }
+
+    /******************************************************************************//**
+     * @brief Return number of evaluation slots, zero if the stage has none
+     * @return number of evaluation slots
+    **********************************************************************************/
+    OrdinalType getNumSlots() const
+    {
+        return (mNumSlots);
+    }
+
+    /******************************************************************************//**
+     * @brief Evaluate the stage at a batch of controls, one stage call per round
+     * @param [in] aInterface PLATO Engine interface
+     * @param [in] aParameterList parameter list with data communicated through the interface
+     * @param [in] aControls batch of controls
+     * @param [out] aOutput criterion values, one per control
+     *
+     * Slots past the last control of the final round keep the control of the previous
+     * round, so their inputs are unchanged and their values are not imported. Their
+     * operations still run unless they set SkipUnchangedInputs.
+    **********************************************************************************/
+    void evaluate(Plato::Interface* aInterface,
+                  Teuchos::ParameterList & aParameterList,
+                  const std::vector<const Plato::Vector<ScalarType, OrdinalType>*> & aControls,
+                  std::vector<ScalarType> & aOutput)
+    {
+        assert(aInterface != nullptr);
+        if(mNumSlots == static_cast<OrdinalType>(0))
+        {
+            THROWERR("STAGE WITH NAME = " + mStageName + " HAS NO EVALUATION SLOTS\n")
+        }
+
+        const OrdinalType tNumControls = aControls.size();
+        aOutput.resize(tNumControls);
+        std::vector<std::string> tStageNames(1, mStageName);
+        for(OrdinalType tFirstControl = 0; tFirstControl < tNumControls; tFirstControl += mNumSlots)
+        {
+            const OrdinalType tNumControlsInRound = std::min(mNumSlots, tNumControls - tFirstControl);
+            this->setSlots(aControls, tFirstControl, tNumControlsInRound, aParameterList);
+            aInterface->compute(tStageNames, aParameterList);
+
+            for(OrdinalType tSlotIndex = 0; tSlotIndex < tNumControlsInRound; tSlotIndex++)
+            {
+                aOutput[tFirstControl + tSlotIndex] = mSlotValues[tSlotIndex];
+            }
+        }
+    }
+
+    /******************************************************************************//**
+     * @brief Evaluate the stage at a batch of single-vector controls
+     * @param [in] aInterface PLATO Engine interface
+     * @param [in] aParameterList parameter list with data communicated through the interface
+     * @param [in] aControls batch of controls
+     * @param [out] aOutput criterion values, one per control
+    **********************************************************************************/
+    void evaluate(Plato::Interface* aInterface,
+                  Teuchos::ParameterList & aParameterList,
+                  const std::vector<std::shared_ptr<Plato::MultiVector<ScalarType, OrdinalType>>> & aControls,
+                  std::vector<ScalarType> & aOutput)
+    {
+        const OrdinalType tCONTROL_VECTOR_INDEX = 0;
+        std::vector<const Plato::Vector<ScalarType, OrdinalType>*> tControls;
+        for(const std::shared_ptr<Plato::MultiVector<ScalarType, OrdinalType>> & tControl : aControls)
+        {
+            if(tControl->getNumVectors() != static_cast<OrdinalType>(1))
+            {
+                THROWERR("STAGE WITH NAME = " + mStageName + " HAS EVALUATION SLOTS, WHICH ONLY SUPPORT ONE CONTROL VECTOR\n")
+            }
+            tControls.push_back(&(*tControl)[tCONTROL_VECTOR_INDEX]);
+        }
+        this->evaluate(aInterface, aParameterList, tControls, aOutput);
+    }
+
+private:
+    /******************************************************************************//**
+     * @brief Return the SharedData block with the given name
+     * @param [in] aInputData interface input data
+     * @param [in] aName shared data name
+     * @return shared data block
+    **********************************************************************************/
+    Plato::InputData getSharedDataNode(const Plato::InputData & aInputData, const std::string & aName) const
+    {
+        for(auto tNode : aInputData.getByName<Plato::InputData>("SharedData"))
+        {
+            if(Plato::Get::String(tNode, "Name") == aName)
+            {
+                return (tNode);
+            }
+        }
+        THROWERR("SHARED DATA WITH NAME = " + aName + " IS NOT DEFINED\n")
+    }
+
+    /******************************************************************************//**
+     * @brief Set views to the controls and criterion values of the evaluation slots
+     * @param [in] aControls batch of controls
+     * @param [in] aFirstControl index of the control assigned to the first slot
+     * @param [in] aNumControlsInRound number of controls evaluated in this round
+     * @param [in/out] aParameterList parameter list with data communicated through the interface
+    **********************************************************************************/
+    void setSlots(const std::vector<const Plato::Vector<ScalarType, OrdinalType>*> & aControls,
+                  const OrdinalType & aFirstControl,
+                  const OrdinalType & aNumControlsInRound,
+                  Teuchos::ParameterList & aParameterList)
+    {
+        for(OrdinalType tSlotIndex = 0; tSlotIndex < mNumSlots; tSlotIndex++)
+        {
+            // a slot that has never been used is fed the round's last control so every
+            // performer group receives a valid control
+            const bool tIsUsed = tSlotIndex < aNumControlsInRound;
+            if(tIsUsed || mSlotControls[tSlotIndex].empty())
+            {
+                const OrdinalType tControlIndex = aFirstControl + std::min(tSlotIndex, aNumControlsInRound - 1);
+                const Plato::Vector<ScalarType, OrdinalType> & tMyControl = *aControls[tControlIndex];
+                mSlotControls[tSlotIndex].resize(tMyControl.size());
+                for(OrdinalType tIndex = 0; tIndex < tMyControl.size(); tIndex++)
+                {
+                    mSlotControls[tSlotIndex][tIndex] = tMyControl[tIndex];
+                }
+            }
+            aParameterList.set(mInputNames[tSlotIndex], mSlotControls[tSlotIndex].data());
+
+            mSlotValues[tSlotIndex] = 0;
+            aParameterList.set(mOutputNames[tSlotIndex], &mSlotValues[tSlotIndex]);
+        }
+    }
+
+private:
+    bool mIsParsed; /*!< flag: true = evaluation slots set & false = evaluation slots not set */
+    OrdinalType mNumSlots; /*!< number of stage input/output pairs, i.e. controls evaluated per stage call */
+    std::string mStageName; /*!< criterion value stage name */
+
+    std::vector<std::string> mInputNames; /*!< control shared data names, one per slot */
+    std::vector<std::string> mOutputNames; /*!< criterion value shared data names, one per slot */
+    std::vector<std::vector<ScalarType>> mSlotControls; /*!< controls assigned to the evaluation slots */
+    std::vector<ScalarType> mSlotValues; /*!< criterion values of the evaluation slots */
+
+private:
+    EngineCriterionSlots(const Plato::EngineCriterionSlots<ScalarType, OrdinalType>&);
+    Plato::EngineCriterionSlots<ScalarType, OrdinalType> & operator=(const Plato::EngineCriterionSlots<ScalarType, OrdinalType>&);
+};
+// class EngineCriterionSlots
+
+}
+// namespace Plato
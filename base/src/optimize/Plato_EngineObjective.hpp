@@ -58,6 +58,7 @@
 #include "Plato_DataFactory.hpp"
 #include "Plato_MultiVector.hpp"
 #include "Plato_DistributedVector.hpp"
+#include "Plato_EngineCriterionSlots.hpp"
 #include "Plato_OptimizerEngineStageData.hpp"
 #include "Plato_OptimizerInterface.hpp"
 
@@ -84,7 +85,8 @@ public:
             mHessianTimesVector(std::vector<ScalarType>(aDataFactory.getNumControls())),
             mInterface(aInterface),
             mEngineInputData(aInputData),
-            mParameterList(std::make_shared<Teuchos::ParameterList>())
+            mParameterList(std::make_shared<Teuchos::ParameterList>()),
+            mValueSlots()
     {
 
         // This data is used to manage the serial and nesting
@@ -111,7 +113,8 @@ public:
             mHessianTimesVector(),
             mInterface(aInterface),
             mEngineInputData(aInputData),
-            mParameterList(std::make_shared<Teuchos::ParameterList>())
+            mParameterList(std::make_shared<Teuchos::ParameterList>()),
+            mValueSlots()
     {
         // This data is used to manage the serial and nesting
         // optimization when calling the value method.
@@ -216,6 +219,29 @@ public:
     **********************************************************************************/
     ScalarType value(const Plato::MultiVector<ScalarType, OrdinalType> & aControl);
 
+    /******************************************************************************//**
+     * @brief Evaluate third-party application objective at a batch of controls
+     * @param [in] aControls batch of 2D containers of optimization variables
+     * @param [out] aOutput objective values, one per control
+     *
+     * If the value stage sets EvaluationSlots, the controls are evaluated concurrently
+     * through its input/output shared data pairs, e.g. one per performer group.
+     * Otherwise, and with nested optimization, the controls are evaluated one at a time.
+    **********************************************************************************/
+    void values(const std::vector<std::shared_ptr<Plato::MultiVector<ScalarType, OrdinalType>>> & aControls,
+                std::vector<ScalarType> & aOutput)
+    {
+        assert(mInterface != nullptr);
+        const std::string tMyStageName = mEngineInputData.getObjectiveValueStageName();
+        mValueSlots.initialize(mInterface, tMyStageName, mEngineInputData.getControlNames(), mEngineInputData.getObjectiveValueOutputName());
+        if(mHasInnerLoop == true || mValueSlots.getNumSlots() == static_cast<OrdinalType>(0))
+        {
+            Plato::Criterion<ScalarType, OrdinalType>::values(aControls, aOutput);
+            return;
+        }
+        mValueSlots.evaluate(mInterface, *mParameterList, aControls, aOutput);
+    }
+
     /******************************************************************************//**
      * @brief Compute the gradient of one or multiple third-party application objectives
      * @param [in] aControl const reference to 2D container of optimization variables
@@ -344,6 +370,7 @@ private:
     Plato::Interface* mInterface; /*!< PLATO Engine interface */
     Plato::OptimizerEngineStageData mEngineInputData; /*!< Parsed input data */
     std::shared_ptr<Teuchos::ParameterList> mParameterList; /*!< parameter list with data to be communicated through the PLATO Engine interface */
+    Plato::EngineCriterionSlots<ScalarType, OrdinalType> mValueSlots; /*!< evaluation slots of the value stage */
 
     /******************************************************************************//**
      * @brief string containing the optimizer name - Optional
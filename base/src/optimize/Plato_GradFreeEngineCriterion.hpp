@@ -50,13 +50,16 @@
 
 #include <vector>
 #include <memory>
+#include <algorithm>
 
 #include "Plato_Stage.hpp"
+#include "Plato_Macros.hpp"
 #include "Plato_Vector.hpp"
 #include "Plato_Interface.hpp"
 #include "Plato_MultiVector.hpp"
 #include "Plato_StageInputDataMng.hpp"
 #include "Plato_GradFreeCriterion.hpp"
+#include "Plato_EngineCriterionSlots.hpp"
 #include "Plato_OptimizerEngineStageData.hpp"
 
 namespace Plato
@@ -64,6 +67,15 @@ namespace Plato
 
 /******************************************************************************//**
  * @brief PLATO Engine interface for gradient free criterion
+ *
+ * Particles are evaluated through the evaluation slots of the criterion stage, i.e.
+ * the stage's input/output shared data pairs. Each slot is typically served by its
+ * own performer group. If the swarm has more particles than the stage has slots,
+ * the particles are evaluated in fixed rounds, so the swarm size is not
+ * tied to the number of performer groups listed in the stage. Stages run synchronously
+ * on every performer, so each round takes one stage call and waits for its slowest
+ * slot. Operations that set SkipUnchangedInputs skip the compute of slots left unused
+ * in the final round.
 **********************************************************************************/
 template<typename ScalarType, typename OrdinalType = size_t>
 class GradFreeEngineCriterion : public Plato::GradFreeCriterion<ScalarType, OrdinalType>
@@ -86,6 +98,7 @@ public:
             mNumParticles(aNumParticles),
             mParticles(),
             mCriterionValues(),
+            mSlots(),
             mInterface(aInterface),
             mStageDataMng(aStageDataMng),
             mParameterList(std::make_shared<Teuchos::ParameterList>())
@@ -137,95 +150,52 @@ public:
                Plato::Vector<ScalarType, OrdinalType> & aOutput)
     {
         assert(mInterface != nullptr);
-        this->exportParticlesSharedData(aControl);
-        this->exportCriteriaSharedData();
-        this->compute();
-        this->importCriterionSharedData(aOutput);
-    }
-
-private:
-    /******************************************************************************//**
-     * @brief Allocate class member containers
-    **********************************************************************************/
-    void initialize()
-    {
-        mParticles.resize(mNumParticles);
-        mCriterionValues.resize(mNumParticles);
-
-        const OrdinalType tNumValues = 1;
-        for(OrdinalType tIndex = 0; tIndex < mNumParticles; tIndex++)
+        assert(mNumParticles == aControl.getNumVectors());
+        assert(mNumParticles == aOutput.size());
+        for(OrdinalType tParticleIndex = 0; tParticleIndex < mNumParticles; tParticleIndex++)
         {
-            mParticles[tIndex].resize(mNumControls);
-            mCriterionValues[tIndex].resize(tNumValues);
+            assert(aControl[tParticleIndex].size() == mNumControls);
+            mParticles[tParticleIndex] = &aControl[tParticleIndex];
         }
-    }
-
-    /******************************************************************************//**
-     * @brief Compute gradient free criterion
-    **********************************************************************************/
-    void compute()
-    {
-        std::string tMyStageName = mStageDataMng.getStageName();
-        std::vector<std::string> tStageNames;
-        tStageNames.push_back(tMyStageName);
-        mInterface->compute(tStageNames, *mParameterList);
-    }
+        mSlots.evaluate(mInterface, *mParameterList, mParticles, mCriterionValues);
 
-    /******************************************************************************//**
-     * @brief Export particles to applications (e.g. simulation driver)
-     * @param [in] aControl 2D container of optimization variables
-    **********************************************************************************/
-    void exportParticlesSharedData(const Plato::MultiVector<ScalarType, OrdinalType> & aControl)
-    {
-        std::string tMyStageName = mStageDataMng.getStageName();
         for(OrdinalType tParticleIndex = 0; tParticleIndex < mNumParticles; tParticleIndex++)
         {
-            const Plato::Vector<ScalarType> & tMyControls = aControl[tParticleIndex];
-            assert(mNumParticles == mParticles.size());
-            assert(tMyControls.size() == mParticles[tParticleIndex].size());
-
-            const OrdinalType tNumControls = tMyControls.size();
-            for(OrdinalType tControlIndex = 0; tControlIndex < tNumControls; tControlIndex++)
-            {
-                mParticles[tParticleIndex][tControlIndex] = tMyControls[tControlIndex];
-            }
-
-            std::string tMySharedDataName = mStageDataMng.getInput(tMyStageName, tParticleIndex);
-            mParameterList->set(tMySharedDataName, mParticles[tParticleIndex].data());
+            const ScalarType tNormalizedValue = mCriterionValues[tParticleIndex] / mReferenceValue;
+            aOutput[tParticleIndex] = tNormalizedValue - mTargetValue;
         }
     }
 
     /******************************************************************************//**
-     * @brief Export criterion values to application (e.g. simulation driver)
+     * @brief Return number of evaluation slots, i.e. particles evaluated per stage call
+     * @return number of evaluation slots
     **********************************************************************************/
-    void exportCriteriaSharedData()
+    OrdinalType getNumSlots() const
     {
-        std::string tMyStageName = mStageDataMng.getStageName();
-        for(OrdinalType tParticleIndex = 0; tParticleIndex < mNumParticles; tParticleIndex++)
-        {
-            assert(mNumParticles == mCriterionValues.size());
-            std::fill(mCriterionValues[tParticleIndex].begin(), mCriterionValues[tParticleIndex].end(), 0.0);
-            std::string tMySharedDataName = mStageDataMng.getOutput(tMyStageName, tParticleIndex);
-            mParameterList->set(tMySharedDataName, mCriterionValues[tParticleIndex].data());
-        }
+        return (mSlots.getNumSlots());
     }
 
+private:
     /******************************************************************************//**
-     * @brief Import criteria values from application (e.g. simulation driver)
-     * @param [in] aOutput 1D container of criterion values
+     * @brief Allocate class member containers
     **********************************************************************************/
-    void importCriterionSharedData(Plato::Vector<ScalarType, OrdinalType> & aOutput)
+    void initialize()
     {
-        assert(mNumParticles == aOutput.size());
-        assert(aOutput.size() == mCriterionValues.size());
-
-        const OrdinalType tCRITERION_VALUES_INDEX = 0;
-        for(OrdinalType tParticleIndex = 0; tParticleIndex < mNumParticles; tParticleIndex++)
+        const std::string & tMyStageName = mStageDataMng.getStageName();
+        const OrdinalType tNumInputs = mStageDataMng.getNumInputs(tMyStageName);
+        if(tNumInputs == static_cast<OrdinalType>(0))
         {
-            const ScalarType tNormalizedValue = mCriterionValues[tParticleIndex][tCRITERION_VALUES_INDEX] / mReferenceValue;
-            aOutput[tParticleIndex] = tNormalizedValue - mTargetValue;
-
+            THROWERR("GRADIENT FREE CRITERION STAGE WITH NAME = " + tMyStageName + " HAS NO INPUTS\n")
         }
+        if(tNumInputs != static_cast<OrdinalType>(mStageDataMng.getNumOutputs(tMyStageName)))
+        {
+            THROWERR("GRADIENT FREE CRITERION STAGE WITH NAME = " + tMyStageName + " HAS A DIFFERENT NUMBER OF INPUTS AND OUTPUTS\n")
+        }
+        const OrdinalType tNumSlots = std::max(static_cast<OrdinalType>(1), std::min(tNumInputs, mNumParticles));
+        mSlots.initialize(mStageDataMng, tMyStageName, tNumSlots);
+
+        mParticles.resize(mNumParticles);
+        mCriterionValues.resize(mNumParticles);
     }
 
 private:
@@ -235,8 +205,9 @@ private:
     OrdinalType mNumControls; /*!< local number of controls */
     OrdinalType mNumParticles; /*!< local number of particles */
 
-    std::vector<std::vector<ScalarType>> mParticles; /*!< set of particles */
-    std::vector<std::vector<ScalarType>> mCriterionValues; /*!< set of criterion values */
+    std::vector<const Plato::Vector<ScalarType, OrdinalType>*> mParticles; /*!< views to the particles */
+    std::vector<ScalarType> mCriterionValues; /*!< criterion values, one per particle */
+    Plato::EngineCriterionSlots<ScalarType, OrdinalType> mSlots; /*!< evaluation slots of the criterion stage */
 
     Plato::Interface* mInterface; /*!< interface to data motion coordinator */
     Plato::StageInputDataMng mStageDataMng; /*!< criterion stage data manager */
@@ -482,12 +482,8 @@ private:
         this->updateCurrentState(tControlUpdated);
         // Compute active and inactive set
         mDataMng->computeActiveAndInactiveSet();
-        // Compute stationarity measure
-        mDataMng->computeStationarityMeasure();
-        // Compute norm of projected gradient
-        mDataMng->computeNormProjectedGradient();
-        // Compute control stagnation measure
-        mDataMng->computeControlStagnationMeasure();
+        // Compute stationarity measure, norm of projected gradient and control stagnation measure
+        mDataMng->computeStoppingMeasures();
         // Compute objective stagnation measure
         mDataMng->computeObjectiveStagnationMeasure();
         // compute gradient inexactness bound for next trust region sub-problem solve
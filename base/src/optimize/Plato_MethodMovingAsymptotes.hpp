@@ -62,6 +62,7 @@
 #include "Plato_MethodMovingAsymptotesIO.hpp"
 #include "Plato_MethodMovingAsymptotesDataMng.hpp"
 #include "Plato_MethodMovingAsymptotesCriterion.hpp"
+#include "Plato_MethodMovingAsymptotesDualSolver.hpp"
 #include "Plato_MethodMovingAsymptotesOperations.hpp"
 
 namespace Plato
@@ -99,10 +100,12 @@ public:
         mConstraints(aConstraints),
         mMMAData(std::make_shared<Plato::ApproximationFunctionData<ScalarType, OrdinalType>>(aDataFactory)),
         mUserRequestedIpoptSubproblemOptimizer(true),
+        mUserRequestedDualSubproblemOptimizer(false),
         mDataMng(std::make_shared<Plato::MethodMovingAsymptotesDataMng<ScalarType, OrdinalType>>(aDataFactory)),
         mOperations(std::make_shared<Plato::MethodMovingAsymptotesOperations<ScalarType, OrdinalType>>(aDataFactory)),
         mConstrAppxFuncList(std::make_shared<Plato::CriterionList<ScalarType, OrdinalType>>()),
-        mTimer(Teuchos::TimeMonitor::getNewTimer("PlatoMain: MMA Optimizer"))
+        mTimer(Teuchos::TimeMonitor::getNewTimer("PlatoMain: MMA Optimizer")),
+        mDataFactory(aDataFactory)
     {
         this->initialize(aDataFactory);
     }
@@ -207,6 +210,7 @@ public:
             mConstrAppxFuncs[tIndex]->setObjFuncAppxFuncMultiplier(0.0);
             mConstrAppxFuncs[tIndex]->setConstraintAppxFuncMultiplier(0.0);
         }
+        mIsBoundConstrained = true;
     }
 
     /******************************************************************************//**
@@ -245,6 +249,15 @@ public:
         mUserRequestedIpoptSubproblemOptimizer = aInput;
     }
 
+    /******************************************************************************//**
+     * @brief Set whether to use the dual method to solve the MMA subproblem
+     * @param [in] aInput bool = true for the dual method; takes precedence over IPOPT and KSAL
+    **********************************************************************************/
+    void setWhetherToUseDualForMMASubproblem(const bool& aInput)
+    {
+        mUserRequestedDualSubproblemOptimizer = aInput;
+    }
+
     /******************************************************************************//**
      * @brief Set maximum number of trust region iterations
      * @param [in] aInput maximum number of trust region iterations
@@ -512,6 +525,21 @@ private:
         mSubProblemSolverKSAL->setMaxNumOuterIterations(mMaxNumSubProblemIterations);
         mSubProblemSolverKSAL->setPenaltyParameterScaleFactor(mAugLagPenaltyMultiplier);
         mSubProblemSolverKSAL->setMaxNumTrustRegionSubProblemIterations(mMaxNumTrustRegionIterations);
+
+        if (mUserRequestedDualSubproblemOptimizer)
+        {
+            // the dual solver and its trial controls are only allocated when requested
+            if (mSubProblemSolverDual == nullptr)
+            {
+                mSubProblemSolverDual = std::make_shared<Plato::MethodMovingAsymptotesDualSolver<ScalarType, OrdinalType>>(mDataFactory);
+            }
+            mSubProblemSolverDual->setMaxNumIterations(mMaxNumSubProblemIterations);
+            mSubProblemSolverDual->setFeasibilityTolerance(mSubProblemFeasibilityTolerance);
+            if (mIsBoundConstrained)
+            {
+                mSubProblemSolverDual->disableConstraints();
+            }
+        }
     }
 
     /******************************************************************************//**
@@ -752,7 +780,7 @@ private:
     **********************************************************************************/
     void solveSubProblem()
     {
-        if (!mIpoptAvailableForSubproblem && mUserRequestedIpoptSubproblemOptimizer)
+        if (!mIpoptAvailableForSubproblem && mUserRequestedIpoptSubproblemOptimizer && !mUserRequestedDualSubproblemOptimizer)
         {
             PRINTERR("User Requested IPOPT for MMA subproblem but PlatoEngine was not built with IPOPT!\n")
             std::cout << std::flush;
@@ -761,7 +789,13 @@ private:
         Teuchos::TimeMonitor LocalTimer(*mTimer);
         double tStartTime = mTimer->wallTime();
         std::string tSubproblemSolverString = "";
-        if (mIpoptAvailableForSubproblem && mUserRequestedIpoptSubproblemOptimizer)
+        if (mUserRequestedDualSubproblemOptimizer)
+        {
+            mSubProblemSolverDual->solve(*mDataMng);
+            mSubProblemSolverDual->getSolution(mDataMng->getCurrentControls());
+            tSubproblemSolverString = "DUAL, " + std::to_string(mSubProblemSolverDual->getNumIterations()) + " Newton Iterations";
+        }
+        else if (mIpoptAvailableForSubproblem && mUserRequestedIpoptSubproblemOptimizer)
         {
             tSubproblemSolverString = "IPOPT";
 #ifdef ENABLE_IPOPT_FOR_MMA_SUBPROBLEM
@@ -879,6 +913,8 @@ private:
 
     std::shared_ptr<Plato::ApproximationFunctionData<ScalarType, OrdinalType>> mMMAData; /*!< structure with approximation function's data */
     bool mUserRequestedIpoptSubproblemOptimizer;
+    bool mUserRequestedDualSubproblemOptimizer; /*!< solve MMA subproblem with the dual method (default=false) */
+    bool mIsBoundConstrained = false; /*!< constraints are ignored, see enableBoundConstrainedOptimization */
 #ifdef ENABLE_IPOPT_FOR_MMA_SUBPROBLEM
     const bool mIpoptAvailableForSubproblem = true;
     std::shared_ptr<Plato::IpoptMMASubproblemSolver<ScalarType, OrdinalType>> mSubProblemSolverIPOPT; /*!< MMA subproblem IPOPT solver */
@@ -886,6 +922,7 @@ private:
     const bool mIpoptAvailableForSubproblem = false;
 #endif
     std::shared_ptr<Plato::AugmentedLagrangian<ScalarType, OrdinalType>> mSubProblemSolverKSAL; /*!< MMA subproblem KSAL solver */
+    std::shared_ptr<Plato::MethodMovingAsymptotesDualSolver<ScalarType, OrdinalType>> mSubProblemSolverDual; /*!< MMA subproblem dual solver */
     std::shared_ptr<Plato::MethodMovingAsymptotesDataMng<ScalarType, OrdinalType>> mDataMng; /*!< MMA data manager */
     std::shared_ptr<Plato::MethodMovingAsymptotesOperations<ScalarType, OrdinalType>> mOperations; /*!< interface to MMA core operations */
 
@@ -894,6 +931,7 @@ private:
     std::vector<std::shared_ptr<Plato::MethodMovingAsymptotesCriterion<ScalarType, OrdinalType>>> mConstrAppxFuncs; /*!< list of constraint criteria approximation function */
 
     Teuchos::RCP<Teuchos::Time> mTimer;
+    std::shared_ptr<Plato::DataFactory<ScalarType, OrdinalType>> mDataFactory; /*!< data factory, allocates the dual solver on request */
 
 private:
     MethodMovingAsymptotes(const Plato::MethodMovingAsymptotes<ScalarType, OrdinalType> & aRhs);
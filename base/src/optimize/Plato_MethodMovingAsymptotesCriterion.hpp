@@ -56,6 +56,7 @@
 #include "Plato_Criterion.hpp"
 #include "Plato_DataFactory.hpp"
 #include "Plato_LinearAlgebra.hpp"
+#include "Plato_DeferredReductions.hpp"
 
 namespace Plato
 {
@@ -270,8 +271,12 @@ private:
             }
         }
 
-        const ScalarType tTermOne = mControlReductionOps->sum(*mControlWork1);
-        const ScalarType tTermTwo = mControlReductionOps->sum(*mControlWork2);
+        Plato::DeferredReductions<ScalarType, OrdinalType> tReductions(*mControlReductionOps);
+        const OrdinalType tTermOneHandle = tReductions.addSum(*mControlWork1);
+        const OrdinalType tTermTwoHandle = tReductions.addSum(*mControlWork2);
+        tReductions.evaluate();
+        const ScalarType tTermOne = tReductions.get(tTermOneHandle);
+        const ScalarType tTermTwo = tReductions.get(tTermTwoHandle);
         const ScalarType tOutput = (mObjFuncAppxFuncMultiplier * tTermOne)
             + (mConstraintAppxFuncMultiplier * (mCurrentNormalizedCriterionValue - tTermTwo));
 
@@ -56,6 +56,7 @@
 #include "Plato_DataFactory.hpp"
 #include "Plato_LinearAlgebra.hpp"
 #include "Plato_MultiVectorList.hpp"
+#include "Plato_DeferredReductions.hpp"
 
 namespace Plato
 {
@@ -730,8 +731,7 @@ public:
     void computeStoppingMeasures()
     {
         this->computeFeasibilityMeasure();
-        this->computeNormObjectiveGradient();
-        this->computeControlStagnationMeasure();
+        this->computeNormObjectiveGradientAndControlStagnation();
         this->computeObjectiveStagnationMeasure();
     }
 
@@ -751,28 +751,31 @@ public:
     }
 
     /******************************************************************************//**
-     * @brief Compute norm of the objective function gradient
+     * @brief Compute norm of the objective function gradient and control stagnation
+     *        measure. The reductions are independent, so they share one collective.
     **********************************************************************************/
-    void computeNormObjectiveGradient()
+    void computeNormObjectiveGradientAndControlStagnation()
     {
-        mNormObjectiveGradient = Plato::norm(*mCurrentObjectiveGradient);
-    }
+        Plato::DeferredReductions<ScalarType, OrdinalType> tReductions(*mControlReductionOps);
+        const OrdinalType tNormHandle = tReductions.addDot(*mCurrentObjectiveGradient, *mCurrentObjectiveGradient);
 
-    /******************************************************************************//**
-     * @brief Compute control stagnation measure
-    **********************************************************************************/
-    void computeControlStagnationMeasure()
-    {
         OrdinalType tNumVectors = mCurrentControls->getNumVectors();
-        std::vector<ScalarType> tStorage(tNumVectors, std::numeric_limits<ScalarType>::min());
+        std::vector<OrdinalType> tStagnationHandles(tNumVectors);
         for(OrdinalType tIndex = 0; tIndex < tNumVectors; tIndex++)
         {
             mControlWork->update(static_cast<ScalarType>(1), (*mCurrentControls)[tIndex], static_cast<ScalarType>(0));
             mControlWork->update(static_cast<ScalarType>(-1), (*mPreviousControls)[tIndex], static_cast<ScalarType>(1));
             mControlWork->modulus();
-            tStorage[tIndex] = mControlReductionOps->max(*mControlWork);
+            tStagnationHandles[tIndex] = tReductions.addMax(*mControlWork);
+        }
+        tReductions.evaluate();
+
+        mNormObjectiveGradient = std::sqrt(tReductions.get(tNormHandle));
+        mControlStagnationMeasure = std::numeric_limits<ScalarType>::min();
+        for(OrdinalType tIndex = 0; tIndex < tNumVectors; tIndex++)
+        {
+            mControlStagnationMeasure = std::max(mControlStagnationMeasure, tReductions.get(tStagnationHandles[tIndex]));
         }
-        mControlStagnationMeasure = *std::max_element(tStorage.begin(), tStorage.end());
     }
 
     /******************************************************************************//**
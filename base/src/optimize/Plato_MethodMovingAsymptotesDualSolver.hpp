@@ -0,0 +1,633 @@
+/*
+//@HEADER
+// *************************************************************************
+//   Plato Engine v.1.0: Copyright 2018, National Technology & Engineering
+//                    Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+// 1. Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright
+// notice, this list of conditions and the following disclaimer in the
+// documentation and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the Sandia Corporation nor the names of the
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY SANDIA CORPORATION "AS IS" AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL SANDIA CORPORATION OR THE
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+// LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+// NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+// SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact the Plato team (plato3D-help@sandia.gov)
+//
+// *************************************************************************
+//@HEADER
+*/
+
+/*
+ * Plato_MethodMovingAsymptotesDualSolver.hpp
+ *
+ *  Created on: Oct 17, 2026
+ */
+
+#pragma once
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <vector>
+#include <algorithm>
+
+#include "Plato_DataFactory.hpp"
+#include "Plato_LinearAlgebra.hpp"
+#include "Plato_DeferredReductions.hpp"
+#include "Plato_MethodMovingAsymptotesDataMng.hpp"
+
+namespace Plato
+{
+
+/******************************************************************************//**
+ * @brief Dual solver for the Method of Moving Asymptotes (MMA) subproblem, see Svanberg,
+ * Krister. "The method of moving asymptotes - a new method for structural optimization."
+ * International journal for numerical methods in engineering 24.2 (1987): 359-373.
+ *
+ * The MMA subproblem is separable. Thus, for a given set of Lagrange multipliers, the
+ * Lagrangian
+ *
+ * /f$L(\mathbf{x},\lambda) = \sum_{j=1}^{N}\left( \frac{P_j}{u_j - x_j} + \frac{Q_j}{x_j - l_j}
+ *   \right) - \lambda^{T}\mathbf{b}/f$, where /f$P_j = p_{0j} + \sum_{i=1}^{M}\lambda_i p_{ij}/f$
+ *   and /f$Q_j = q_{0j} + \sum_{i=1}^{M}\lambda_i q_{ij}/f$,
+ *
+ * is minimized in closed form,
+ *
+ * /f$x_j(\lambda) = \frac{\sqrt{P_j}l_j + \sqrt{Q_j}u_j}{\sqrt{P_j} + \sqrt{Q_j}}/f$,
+ *
+ * projected onto the subproblem bounds. The concave dual function /f$W(\lambda) =
+ * L(\mathbf{x}(\lambda),\lambda)/f$ is maximized over /f$\lambda\geq{0}/f$ with a projected
+ * Newton method. As in Svanberg's formulation, each constraint is relaxed with an elastic
+ * variable /f$y_i\geq{0}/f$ penalized by /f$c\,y_i + \frac{1}{2}y_i^2/f$. Thus, the dual
+ * function stays bounded, and the solver returns a least-infeasible point, whenever the
+ * approximated constraints can not be satisfied within the subproblem bounds. Since
+ * /f$y_i(\lambda) = \max(0, \lambda_i - c)/f$, the elastic variables are inactive for
+ * multipliers below the penalty /f$c/f$.
+ *
+ * The dual function, its gradient and its Hessian are computed in one fused
+ * pass over the controls and reduced with one collective; hence, a Newton iteration whose
+ * full step is accepted costs one pass over the controls and one collective.
+ *
+ * Nomenclature:
+ *
+ * /f$p_{0j}, q_{0j}/f$: objective approximation function coefficients
+ * /f$p_{ij}, q_{ij}/f$: i-th constraint approximation function coefficients
+ * /f$b_i/f$: /f$\sum_{j=1}^{N}\left( \frac{p_{ij}}{u_j - x_j^k} + \frac{q_{ij}}{x_j^k - l_j}
+ *   \right) - g_i(\mathbf{x}^k)/f$, where /f$g_i/f$ is the i-th normalized constraint
+ * /f$u_j, l_j/f$: upper and lower asymptote j-th value
+ * /f$c/f$: infeasibility penalty (default = 1000)
+***********************************************************************************/
+template<typename ScalarType, typename OrdinalType = size_t>
+class MethodMovingAsymptotesDualSolver
+{
+public:
+    /******************************************************************************//**
+     * @brief Constructor
+     * @param [in] aDataFactory factory used to allocate internal metadata
+    **********************************************************************************/
+    explicit MethodMovingAsymptotesDualSolver(const std::shared_ptr<Plato::DataFactory<ScalarType, OrdinalType>> &aDataFactory) :
+        mIsConstraintsEnabled(true),
+        mNumIterations(0),
+        mNumDualEvaluations(0),
+        mMaxNumIterations(100),
+        mMaxNumLineSearchIterations(50),
+        mDualValue(0),
+        mTrialDualValue(0),
+        mDualResidual(0),
+        mFeasibilityTolerance(1e-8),
+        mSufficientIncrease(1e-4),
+        mInfeasibilityPenalty(1e3),
+        mTrialControls(aDataFactory->control().create()),
+        mControlReductionOps(aDataFactory->getControlReductionOperations().create())
+    {
+    }
+
+    /******************************************************************************//**
+     * @brief Destructor
+    **********************************************************************************/
+    ~MethodMovingAsymptotesDualSolver()
+    {
+    }
+
+    /******************************************************************************//**
+     * @brief Return number of Newton iterations performed by the last solve
+     * @return number of Newton iterations
+    **********************************************************************************/
+    OrdinalType getNumIterations() const
+    {
+        return (mNumIterations);
+    }
+
+    /******************************************************************************//**
+     * @brief Return number of dual function evaluations, i.e. passes over the controls,
+     * performed by the last solve
+     * @return number of dual function evaluations
+    **********************************************************************************/
+    OrdinalType getNumDualEvaluations() const
+    {
+        return (mNumDualEvaluations);
+    }
+
+    /******************************************************************************//**
+     * @brief Return optimality measure of the dual problem at the last solution
+     * @return projected dual gradient norm, i.e. /f$\max_i|\min(\lambda_i, -\nabla{W}_i)|/f$
+    **********************************************************************************/
+    ScalarType getDualResidual() const
+    {
+        return (mDualResidual);
+    }
+
+    /******************************************************************************//**
+     * @brief Return Lagrange multiplier associated with a constraint
+     * @param [in] aIndex constraint index
+     * @return Lagrange multiplier
+    **********************************************************************************/
+    ScalarType getLagrangeMultiplier(const OrdinalType & aIndex) const
+    {
+        return (mMultipliers[aIndex]);
+    }
+
+    /******************************************************************************//**
+     * @brief Set maximum number of Newton iterations
+     * @param [in] aInput maximum number of Newton iterations
+    **********************************************************************************/
+    void setMaxNumIterations(const OrdinalType & aInput)
+    {
+        mMaxNumIterations = aInput;
+    }
+
+    /******************************************************************************//**
+     * @brief Set tolerance on the violation of the approximated constraints
+     * @param [in] aInput feasibility tolerance
+    **********************************************************************************/
+    void setFeasibilityTolerance(const ScalarType & aInput)
+    {
+        mFeasibilityTolerance = aInput;
+    }
+
+    /******************************************************************************//**
+     * @brief Ignore the constraints, i.e. solve the bound constrained subproblem
+    **********************************************************************************/
+    void disableConstraints()
+    {
+        mIsConstraintsEnabled = false;
+    }
+
+    /******************************************************************************//**
+     * @brief Solve MMA subproblem. The multipliers of the previous solve are used as
+     * initial guess.
+     * @param [in] aDataMng MMA data manager interface
+    **********************************************************************************/
+    void solve(const Plato::MethodMovingAsymptotesDataMng<ScalarType, OrdinalType>& aDataMng)
+    {
+        mNumIterations = 0;
+        mNumDualEvaluations = 0;
+        this->initialize(aDataMng);
+
+        this->evaluateDual(aDataMng, mMultipliers);
+        this->acceptTrial();
+        mDualResidual = this->computeDualResidual();
+        while(mDualResidual > mFeasibilityTolerance && mNumIterations < mMaxNumIterations)
+        {
+            this->computeNewtonStep();
+            mNumIterations++;
+            if(this->lineSearch(aDataMng) == false)
+            {
+                // restore the controls associated with the last accepted multipliers
+                this->evaluateDual(aDataMng, mMultipliers);
+                break;
+            }
+            mDualResidual = this->computeDualResidual();
+        }
+    }
+
+    /******************************************************************************//**
+     * @brief Gather MMA subproblem solution
+     * @param [out] aOutput 2D container of optimization variables
+    **********************************************************************************/
+    void getSolution(Plato::MultiVector<ScalarType, OrdinalType>& aOutput) const
+    {
+        Plato::update(static_cast<ScalarType>(1), *mTrialControls, static_cast<ScalarType>(0), aOutput);
+    }
+
+private:
+    /******************************************************************************//**
+     * @brief Allocate work arrays and compute the constant terms of the dual function
+     * @param [in] aDataMng MMA data manager interface
+    **********************************************************************************/
+    void initialize(const Plato::MethodMovingAsymptotesDataMng<ScalarType, OrdinalType>& aDataMng)
+    {
+        const OrdinalType tNumConstraints = mIsConstraintsEnabled ? aDataMng.getNumConstraints() : static_cast<OrdinalType>(0);
+        if(mMultipliers.size() != tNumConstraints)
+        {
+            mMultipliers.assign(tNumConstraints, static_cast<ScalarType>(0));
+        }
+        mTrialMultipliers.resize(tNumConstraints);
+        mStep.resize(tNumConstraints);
+        mWork.resize(tNumConstraints);
+        mRightHandSide.resize(tNumConstraints);
+        mGradient.resize(tNumConstraints);
+        mTrialGradient.resize(tNumConstraints);
+        mHessian.resize(tNumConstraints * tNumConstraints);
+        mTrialHessian.resize(tNumConstraints * tNumConstraints);
+        mConstraintP.resize(tNumConstraints);
+        mConstraintQ.resize(tNumConstraints);
+        this->computeRightHandSide(aDataMng);
+    }
+
+    /******************************************************************************//**
+     * @brief Gather pointers to the constraint approximation function coefficients
+     * @param [in] aDataMng MMA data manager interface
+     * @param [in] aVectorIndex control vector index
+    **********************************************************************************/
+    void gatherConstraintCoefficients(const Plato::MethodMovingAsymptotesDataMng<ScalarType, OrdinalType>& aDataMng,
+                                      const OrdinalType & aVectorIndex)
+    {
+        const OrdinalType tNumConstraints = mMultipliers.size();
+        for(OrdinalType tIndex = 0; tIndex < tNumConstraints; tIndex++)
+        {
+            mConstraintP[tIndex] = aDataMng.getConstraintAppxFunctionP(tIndex)[aVectorIndex].data();
+            mConstraintQ[tIndex] = aDataMng.getConstraintAppxFunctionQ(tIndex)[aVectorIndex].data();
+        }
+    }
+
+    /******************************************************************************//**
+     * @brief Compute /f$b_i/f$, i.e. the constant terms of the constraint approximation
+     * functions, with one pass over the controls and one collective
+     * @param [in] aDataMng MMA data manager interface
+    **********************************************************************************/
+    void computeRightHandSide(const Plato::MethodMovingAsymptotesDataMng<ScalarType, OrdinalType>& aDataMng)
+    {
+        const OrdinalType tNumConstraints = mMultipliers.size();
+        if(tNumConstraints == static_cast<OrdinalType>(0))
+        {
+            return;
+        }
+
+        std::fill(mRightHandSide.begin(), mRightHandSide.end(), static_cast<ScalarType>(0));
+        const Plato::MultiVector<ScalarType, OrdinalType> &tCurrentControls = aDataMng.getCurrentControls();
+        const OrdinalType tNumVectors = tCurrentControls.getNumVectors();
+        for(OrdinalType tVectorIndex = 0; tVectorIndex < tNumVectors; tVectorIndex++)
+        {
+            this->gatherConstraintCoefficients(aDataMng, tVectorIndex);
+            const ScalarType* tControls = tCurrentControls[tVectorIndex].data();
+            const ScalarType* tLowerAsymptotes = aDataMng.getLowerAsymptotes()[tVectorIndex].data();
+            const ScalarType* tUpperAsymptotes = aDataMng.getUpperAsymptotes()[tVectorIndex].data();
+
+            const OrdinalType tNumControls = tCurrentControls[tVectorIndex].size();
+            for(OrdinalType tControlIndex = 0; tControlIndex < tNumControls; tControlIndex++)
+            {
+                const ScalarType tInvUpperDiff = static_cast<ScalarType>(1) / (tUpperAsymptotes[tControlIndex] - tControls[tControlIndex]);
+                const ScalarType tInvLowerDiff = static_cast<ScalarType>(1) / (tControls[tControlIndex] - tLowerAsymptotes[tControlIndex]);
+                for(OrdinalType tIndex = 0; tIndex < tNumConstraints; tIndex++)
+                {
+                    mRightHandSide[tIndex] += (mConstraintP[tIndex][tControlIndex] * tInvUpperDiff)
+                        + (mConstraintQ[tIndex][tControlIndex] * tInvLowerDiff);
+                }
+            }
+        }
+
+        Plato::DeferredReductions<ScalarType, OrdinalType> tReductions(*mControlReductionOps);
+        for(OrdinalType tIndex = 0; tIndex < tNumConstraints; tIndex++)
+        {
+            tReductions.addLocalSum(mRightHandSide[tIndex]);
+        }
+        tReductions.evaluate();
+
+        for(OrdinalType tIndex = 0; tIndex < tNumConstraints; tIndex++)
+        {
+            const ScalarType tValue = aDataMng.getConstraintNormalization(tIndex);
+            const ScalarType tConstraintNormalization = std::abs(tValue) <= std::numeric_limits<ScalarType>::epsilon() ? static_cast<ScalarType>(1) : tValue;
+            const ScalarType tNormalizedConstraintValue = aDataMng.getCurrentConstraintValue(tIndex) / tConstraintNormalization;
+            mRightHandSide[tIndex] = tReductions.get(tIndex) - tNormalizedConstraintValue;
+        }
+    }
+
+    /******************************************************************************//**
+     * @brief Evaluate the minimizer of the Lagrangian, the dual function, its gradient and
+     * its Hessian at the trial multipliers. Results are stored in the trial containers.
+     * @param [in] aDataMng MMA data manager interface
+     * @param [in] aMultipliers Lagrange multipliers
+    **********************************************************************************/
+    void evaluateDual(const Plato::MethodMovingAsymptotesDataMng<ScalarType, OrdinalType>& aDataMng,
+                      const std::vector<ScalarType>& aMultipliers)
+    {
+        mNumDualEvaluations++;
+        const OrdinalType tNumConstraints = aMultipliers.size();
+        std::fill(mTrialGradient.begin(), mTrialGradient.end(), static_cast<ScalarType>(0));
+        std::fill(mTrialHessian.begin(), mTrialHessian.end(), static_cast<ScalarType>(0));
+
+        ScalarType tLocalValue = 0;
+        const OrdinalType tNumVectors = mTrialControls->getNumVectors();
+        for(OrdinalType tVectorIndex = 0; tVectorIndex < tNumVectors; tVectorIndex++)
+        {
+            this->gatherConstraintCoefficients(aDataMng, tVectorIndex);
+            const ScalarType* tObjFuncP = aDataMng.getObjFuncAppxFunctionP()[tVectorIndex].data();
+            const ScalarType* tObjFuncQ = aDataMng.getObjFuncAppxFunctionQ()[tVectorIndex].data();
+            const ScalarType* tLowerAsymptotes = aDataMng.getLowerAsymptotes()[tVectorIndex].data();
+            const ScalarType* tUpperAsymptotes = aDataMng.getUpperAsymptotes()[tVectorIndex].data();
+            const ScalarType* tLowerBounds = aDataMng.getSubProblemControlLowerBounds()[tVectorIndex].data();
+            const ScalarType* tUpperBounds = aDataMng.getSubProblemControlUpperBounds()[tVectorIndex].data();
+            ScalarType* tControls = (*mTrialControls)[tVectorIndex].data();
+
+            const OrdinalType tNumControls = (*mTrialControls)[tVectorIndex].size();
+            for(OrdinalType tControlIndex = 0; tControlIndex < tNumControls; tControlIndex++)
+            {
+                ScalarType tP = tObjFuncP[tControlIndex];
+                ScalarType tQ = tObjFuncQ[tControlIndex];
+                for(OrdinalType tIndex = 0; tIndex < tNumConstraints; tIndex++)
+                {
+                    tP += aMultipliers[tIndex] * mConstraintP[tIndex][tControlIndex];
+                    tQ += aMultipliers[tIndex] * mConstraintQ[tIndex][tControlIndex];
+                }
+
+                const ScalarType tSqrtP = std::sqrt(tP);
+                const ScalarType tSqrtQ = std::sqrt(tQ);
+                const ScalarType tLower = tLowerAsymptotes[tControlIndex];
+                const ScalarType tUpper = tUpperAsymptotes[tControlIndex];
+                const ScalarType tMinimizer = ((tSqrtP * tLower) + (tSqrtQ * tUpper)) / (tSqrtP + tSqrtQ);
+                const bool tIsInactive = tMinimizer > tLowerBounds[tControlIndex] && tMinimizer < tUpperBounds[tControlIndex];
+                const ScalarType tControl = std::min(std::max(tMinimizer, tLowerBounds[tControlIndex]), tUpperBounds[tControlIndex]);
+                tControls[tControlIndex] = tControl;
+
+                const ScalarType tInvUpperDiff = static_cast<ScalarType>(1) / (tUpper - tControl);
+                const ScalarType tInvLowerDiff = static_cast<ScalarType>(1) / (tControl - tLower);
+                tLocalValue += (tP * tInvUpperDiff) + (tQ * tInvLowerDiff);
+                for(OrdinalType tIndex = 0; tIndex < tNumConstraints; tIndex++)
+                {
+                    mTrialGradient[tIndex] += (mConstraintP[tIndex][tControlIndex] * tInvUpperDiff)
+                        + (mConstraintQ[tIndex][tControlIndex] * tInvLowerDiff);
+                }
+
+                if(tIsInactive && tNumConstraints > static_cast<OrdinalType>(0))
+                {
+                    // d^2W/dl_i dl_k = -sum_j (dg_i/dx_j)(dg_k/dx_j) / (d^2L/dx_j^2) over inactive controls
+                    const ScalarType tInvUpperDiffSquared = tInvUpperDiff * tInvUpperDiff;
+                    const ScalarType tInvLowerDiffSquared = tInvLowerDiff * tInvLowerDiff;
+                    const ScalarType tCurvature = static_cast<ScalarType>(2)
+                        * ((tP * tInvUpperDiffSquared * tInvUpperDiff) + (tQ * tInvLowerDiffSquared * tInvLowerDiff));
+                    for(OrdinalType tIndex = 0; tIndex < tNumConstraints; tIndex++)
+                    {
+                        mWork[tIndex] = (mConstraintP[tIndex][tControlIndex] * tInvUpperDiffSquared)
+                            - (mConstraintQ[tIndex][tControlIndex] * tInvLowerDiffSquared);
+                    }
+                    for(OrdinalType tRow = 0; tRow < tNumConstraints; tRow++)
+                    {
+                        const ScalarType tValue = mWork[tRow] / tCurvature;
+                        for(OrdinalType tColumn = 0; tColumn <= tRow; tColumn++)
+                        {
+                            mTrialHessian[tRow * tNumConstraints + tColumn] -= tValue * mWork[tColumn];
+                        }
+                    }
+                }
+            }
+        }
+
+        // the minimizer is local to each process, the dual function is only needed to drive the multipliers
+        if(tNumConstraints == static_cast<OrdinalType>(0))
+        {
+            return;
+        }
+
+        Plato::DeferredReductions<ScalarType, OrdinalType> tReductions(*mControlReductionOps);
+        const OrdinalType tValueHandle = tReductions.addLocalSum(tLocalValue);
+        for(OrdinalType tIndex = 0; tIndex < tNumConstraints; tIndex++)
+        {
+            tReductions.addLocalSum(mTrialGradient[tIndex]);
+        }
+        for(OrdinalType tRow = 0; tRow < tNumConstraints; tRow++)
+        {
+            for(OrdinalType tColumn = 0; tColumn <= tRow; tColumn++)
+            {
+                tReductions.addLocalSum(mTrialHessian[tRow * tNumConstraints + tColumn]);
+            }
+        }
+        tReductions.evaluate();
+
+        // handles are issued in the order the contributions were queued
+        OrdinalType tHandle = tValueHandle;
+        mTrialDualValue = tReductions.get(tHandle++);
+        for(OrdinalType tIndex = 0; tIndex < tNumConstraints; tIndex++)
+        {
+            mTrialGradient[tIndex] = tReductions.get(tHandle++) - mRightHandSide[tIndex];
+            mTrialDualValue -= aMultipliers[tIndex] * mRightHandSide[tIndex];
+        }
+        for(OrdinalType tRow = 0; tRow < tNumConstraints; tRow++)
+        {
+            for(OrdinalType tColumn = 0; tColumn <= tRow; tColumn++)
+            {
+                const ScalarType tValue = tReductions.get(tHandle++);
+                mTrialHessian[tRow * tNumConstraints + tColumn] = tValue;
+                mTrialHessian[tColumn * tNumConstraints + tRow] = tValue;
+            }
+        }
+
+        // elastic variables, y_i = max(0, lambda_i - c), contribute -y_i^2/2 to the dual function
+        for(OrdinalType tIndex = 0; tIndex < tNumConstraints; tIndex++)
+        {
+            const ScalarType tElastic = aMultipliers[tIndex] - mInfeasibilityPenalty;
+            if(tElastic > static_cast<ScalarType>(0))
+            {
+                mTrialDualValue -= static_cast<ScalarType>(0.5) * tElastic * tElastic;
+                mTrialGradient[tIndex] -= tElastic;
+                mTrialHessian[tIndex * tNumConstraints + tIndex] -= static_cast<ScalarType>(1);
+            }
+        }
+    }
+
+    /******************************************************************************//**
+     * @brief Make the trial dual state the current dual state
+    **********************************************************************************/
+    void acceptTrial()
+    {
+        mDualValue = mTrialDualValue;
+        mGradient.swap(mTrialGradient);
+        mHessian.swap(mTrialHessian);
+    }
+
+    /******************************************************************************//**
+     * @brief Compute optimality measure of the dual problem, i.e. the projected gradient
+     * @return /f$\max_i|\min(\lambda_i, -\nabla{W}_i)|/f$
+    **********************************************************************************/
+    ScalarType computeDualResidual() const
+    {
+        ScalarType tOutput = 0;
+        const OrdinalType tNumConstraints = mMultipliers.size();
+        for(OrdinalType tIndex = 0; tIndex < tNumConstraints; tIndex++)
+        {
+            tOutput = std::max(tOutput, std::abs(std::min(mMultipliers[tIndex], -mGradient[tIndex])));
+        }
+        return (tOutput);
+    }
+
+    /******************************************************************************//**
+     * @brief Compute projected Newton step. Multipliers at zero with a descent gradient
+     * are held fixed, the remaining ones solve /f$-\nabla^2{W}\Delta\lambda = \nabla{W}/f$
+    **********************************************************************************/
+    void computeNewtonStep()
+    {
+        const OrdinalType tNumConstraints = mMultipliers.size();
+        mFreeSet.clear();
+        std::fill(mStep.begin(), mStep.end(), static_cast<ScalarType>(0));
+        ScalarType tMaxCurvature = 0;
+        for(OrdinalType tIndex = 0; tIndex < tNumConstraints; tIndex++)
+        {
+            if(mMultipliers[tIndex] > static_cast<ScalarType>(0) || mGradient[tIndex] > static_cast<ScalarType>(0))
+            {
+                mFreeSet.push_back(tIndex);
+                tMaxCurvature = std::max(tMaxCurvature, -mHessian[tIndex * tNumConstraints + tIndex]);
+            }
+        }
+
+        if(tMaxCurvature <= std::numeric_limits<ScalarType>::min())
+        {
+            // every control sits on a bound and the dual function is linear: steepest ascent
+            // scaled to reach the elastic range, the line search backtracks to the first kink
+            ScalarType tMaxGradient = 0;
+            for(OrdinalType tIndex : mFreeSet)
+            {
+                tMaxGradient = std::max(tMaxGradient, std::abs(mGradient[tIndex]));
+            }
+            const ScalarType tScale = tMaxGradient > static_cast<ScalarType>(0) ? mInfeasibilityPenalty / tMaxGradient : static_cast<ScalarType>(0);
+            for(OrdinalType tIndex : mFreeSet)
+            {
+                mStep[tIndex] = tScale * mGradient[tIndex];
+            }
+            return;
+        }
+
+        // Cholesky factorization of the shifted reduced system, the shift guards rank deficiency
+        const OrdinalType tNumFree = mFreeSet.size();
+        const ScalarType tShift = std::sqrt(std::numeric_limits<ScalarType>::epsilon()) * tMaxCurvature;
+        mFactor.assign(tNumFree * tNumFree, static_cast<ScalarType>(0));
+        for(OrdinalType tRow = 0; tRow < tNumFree; tRow++)
+        {
+            for(OrdinalType tColumn = 0; tColumn <= tRow; tColumn++)
+            {
+                ScalarType tValue = -mHessian[mFreeSet[tRow] * tNumConstraints + mFreeSet[tColumn]];
+                tValue += tRow == tColumn ? tShift : static_cast<ScalarType>(0);
+                for(OrdinalType tIndex = 0; tIndex < tColumn; tIndex++)
+                {
+                    tValue -= mFactor[tRow * tNumFree + tIndex] * mFactor[tColumn * tNumFree + tIndex];
+                }
+                mFactor[tRow * tNumFree + tColumn] = tRow == tColumn ? std::sqrt(std::max(tValue, tShift))
+                    : tValue / mFactor[tColumn * tNumFree + tColumn];
+            }
+        }
+
+        for(OrdinalType tRow = 0; tRow < tNumFree; tRow++)
+        {
+            ScalarType tValue = mGradient[mFreeSet[tRow]];
+            for(OrdinalType tColumn = 0; tColumn < tRow; tColumn++)
+            {
+                tValue -= mFactor[tRow * tNumFree + tColumn] * mWork[tColumn];
+            }
+            mWork[tRow] = tValue / mFactor[tRow * tNumFree + tRow];
+        }
+        for(OrdinalType tRow = tNumFree; tRow-- > 0;)
+        {
+            ScalarType tValue = mWork[tRow];
+            for(OrdinalType tColumn = tRow + 1; tColumn < tNumFree; tColumn++)
+            {
+                tValue -= mFactor[tColumn * tNumFree + tRow] * mStep[mFreeSet[tColumn]];
+            }
+            mStep[mFreeSet[tRow]] = tValue / mFactor[tRow * tNumFree + tRow];
+        }
+    }
+
+    /******************************************************************************//**
+     * @brief Projected backtracking line search on the dual function
+     * @param [in] aDataMng MMA data manager interface
+     * @return true if a step with sufficient increase was found
+    **********************************************************************************/
+    bool lineSearch(const Plato::MethodMovingAsymptotesDataMng<ScalarType, OrdinalType>& aDataMng)
+    {
+        const OrdinalType tNumConstraints = mMultipliers.size();
+        const ScalarType tRoundOff = static_cast<ScalarType>(10) * std::numeric_limits<ScalarType>::epsilon()
+            * std::max(static_cast<ScalarType>(1), std::abs(mDualValue));
+
+        ScalarType tStepSize = 1;
+        for(OrdinalType tIteration = 0; tIteration < mMaxNumLineSearchIterations; tIteration++)
+        {
+            ScalarType tPredictedIncrease = 0;
+            for(OrdinalType tIndex = 0; tIndex < tNumConstraints; tIndex++)
+            {
+                mTrialMultipliers[tIndex] = std::max(static_cast<ScalarType>(0), mMultipliers[tIndex] + (tStepSize * mStep[tIndex]));
+                tPredictedIncrease += mGradient[tIndex] * (mTrialMultipliers[tIndex] - mMultipliers[tIndex]);
+            }
+
+            this->evaluateDual(aDataMng, mTrialMultipliers);
+            if(mTrialDualValue >= mDualValue + (mSufficientIncrease * tPredictedIncrease) - tRoundOff)
+            {
+                mMultipliers.swap(mTrialMultipliers);
+                this->acceptTrial();
+                return (true);
+            }
+            tStepSize *= static_cast<ScalarType>(0.5);
+        }
+        return (false);
+    }
+
+private:
+    bool mIsConstraintsEnabled; /*!< solve constrained subproblem (default=true) */
+
+    OrdinalType mNumIterations; /*!< number of Newton iterations */
+    OrdinalType mNumDualEvaluations; /*!< number of dual function evaluations */
+    OrdinalType mMaxNumIterations; /*!< maximum number of Newton iterations */
+    OrdinalType mMaxNumLineSearchIterations; /*!< maximum number of backtracking steps */
+
+    ScalarType mDualValue; /*!< dual function value at current multipliers */
+    ScalarType mTrialDualValue; /*!< dual function value at trial multipliers */
+    ScalarType mDualResidual; /*!< projected dual gradient norm */
+    ScalarType mFeasibilityTolerance; /*!< tolerance on the violation of the approximated constraints */
+    ScalarType mSufficientIncrease; /*!< sufficient increase parameter for the line search */
+    ScalarType mInfeasibilityPenalty; /*!< linear penalty on the elastic variables, upper bound on the multipliers of feasible subproblems */
+
+    std::vector<ScalarType> mMultipliers; /*!< current Lagrange multipliers */
+    std::vector<ScalarType> mTrialMultipliers; /*!< trial Lagrange multipliers */
+    std::vector<ScalarType> mStep; /*!< Newton step */
+    std::vector<ScalarType> mWork; /*!< work array, one entry per constraint */
+    std::vector<ScalarType> mRightHandSide; /*!< constant terms of the constraint approximation functions */
+    std::vector<ScalarType> mGradient; /*!< dual function gradient at current multipliers */
+    std::vector<ScalarType> mTrialGradient; /*!< dual function gradient at trial multipliers */
+    std::vector<ScalarType> mHessian; /*!< dual function Hessian at current multipliers */
+    std::vector<ScalarType> mTrialHessian; /*!< dual function Hessian at trial multipliers */
+    std::vector<ScalarType> mFactor; /*!< Cholesky factor of the reduced Newton system */
+    std::vector<OrdinalType> mFreeSet; /*!< multipliers updated by the Newton step */
+    std::vector<const ScalarType*> mConstraintP; /*!< constraint approximation functions one (P) */
+    std::vector<const ScalarType*> mConstraintQ; /*!< constraint approximation functions two (Q) */
+
+    std::shared_ptr<Plato::MultiVector<ScalarType, OrdinalType>> mTrialControls; /*!< minimizer of the Lagrangian at the last evaluated multipliers */
+    std::shared_ptr<Plato::ReductionOperations<ScalarType, OrdinalType>> mControlReductionOps; /*!< reduction operation interface for controls */
+
+private:
+    MethodMovingAsymptotesDualSolver(const Plato::MethodMovingAsymptotesDualSolver<ScalarType, OrdinalType> & aRhs);
+    Plato::MethodMovingAsymptotesDualSolver<ScalarType, OrdinalType> & operator=(const Plato::MethodMovingAsymptotesDualSolver<ScalarType, OrdinalType> & aRhs);
+};
+// class MethodMovingAsymptotesDualSolver
+
+}
+// namespace Plato
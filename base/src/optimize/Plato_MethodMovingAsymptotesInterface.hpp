@@ -87,6 +87,7 @@ inline void set_mma_algorithm_inputs(const Plato::AlgorithmInputsMMA<ScalarType,
     aAlgorithm.setAsymptoteContractionParameter(aInputs.mAsymptoteContraction);
     aAlgorithm.setAugLagSubProbPenaltyMultiplier(aInputs.mAugLagSubProbPenaltyMultiplier);
     aAlgorithm.setWhetherToUseIpoptForMMASubproblem(aInputs.mUseIpoptForMMASubproblem);
+    aAlgorithm.setWhetherToUseDualForMMASubproblem(aInputs.mUseDualForMMASubproblem);
 
     aAlgorithm.setOptimalityTolerance(aInputs.mOptimalityTolerance);
     aAlgorithm.setFeasibilityTolerance(aInputs.mFeasibilityTolerance);
@@ -48,6 +48,7 @@
 
 #pragma once
 
+#include "Plato_Exceptions.hpp"
 #include "Plato_OptimizerParser.hpp"
 #include "Plato_OptimizersIO_Utilities.hpp"
 #include "Plato_MethodMovingAsymptotesIO_Data.hpp"
@@ -101,6 +102,8 @@ private:
             aData.mPrintMMADiagnostics = this->outputDiagnostics(tOptionsNode);
             aData.mPrintAugLagSubProbDiagnostics = this->outputSubProblemDiagnostics(tOptionsNode);
             aData.mUseIpoptForMMASubproblem = this->useIpoptForMMASubproblem(tOptionsNode);
+            aData.mUseDualForMMASubproblem = this->useDualForMMASubproblem(tOptionsNode);
+            this->checkDualForMMASubproblemAlgebra(tOptionsNode, aData.mUseDualForMMASubproblem);
 
             aData.mUpdateFrequency = this->updateFrequency(tOptionsNode);
             aData.mNumControlVectors = this->numControlVectors(tOptionsNode);
@@ -172,6 +175,35 @@ private:
         return (tOuput);
     }
 
+    /******************************************************************************//**
+     * @brief Parse whether to use the dual method to solve MMA subproblem
+     * @param [in] aOptimizerNode data structure with optimization related input options
+     * @return use dual method for MMA subproblem flag, default = false
+    **********************************************************************************/
+    bool useDualForMMASubproblem(const Plato::InputData & aOptionsNode)
+    {
+        bool tOuput = false;
+        if(aOptionsNode.size<std::string>("UseDualForMMASubproblem"))
+        {
+            tOuput = Plato::Get::Bool(aOptionsNode, "UseDualForMMASubproblem");
+        }
+        return (tOuput);
+    }
+
+    /******************************************************************************//**
+     * @brief Throw if the dual method is requested with GPU algebra; the dual solver
+     *   reads and writes the control vectors through host pointers
+     * @param [in] aOptionsNode data structure with optimization related input options
+     * @param [in] aUseDual use dual method for MMA subproblem flag
+    **********************************************************************************/
+    void checkDualForMMASubproblemAlgebra(const Plato::InputData & aOptionsNode, const bool & aUseDual)
+    {
+        if(aUseDual && aOptionsNode.size<std::string>("Algebra") && Plato::Get::String(aOptionsNode, "Algebra") == "GPU")
+        {
+            throw Plato::ParsingException("MethodMovingAsymptotesParser: UseDualForMMASubproblem is not supported with GPU algebra.");
+        }
+    }
+
     /******************************************************************************//**
      * @brief Parse memory space keyword
      * @param [in] aOptimizerNode data structure with optimization related input options
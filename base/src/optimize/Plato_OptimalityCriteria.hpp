@@ -287,8 +287,7 @@ private:
     void computeStoppingMetrics()
     {
         mDataMng->computeMaxInequalityValue();
-        mDataMng->computeNormObjectiveGradient();
-        mDataMng->computeControlStagnationMeasure();
+        mDataMng->computeNormObjectiveGradientAndControlStagnation();
         mDataMng->computeObjectiveStagnationMeasure();
     }
 
@@ -52,11 +52,13 @@
 #include <cmath>
 #include <limits>
 #include <cassert>
+#include <algorithm>
 
 #include "Plato_Types.hpp"
 #include "Plato_Vector.hpp"
 #include "Plato_MultiVector.hpp"
 #include "Plato_DataFactory.hpp"
+#include "Plato_DeferredReductions.hpp"
 #include "Plato_ReductionOperations.hpp"
 
 namespace Plato
@@ -246,29 +248,27 @@ public:
     }
     void computeNormObjectiveGradient()
     {
-        ScalarType tCummulativeDotProduct = 0.;
-        OrdinalType tNumVectors = mObjectiveGradient->getNumVectors();
-        for(OrdinalType tIndex = 0; tIndex < tNumVectors; tIndex++)
-        {
-            const Plato::Vector<ScalarType, OrdinalType> & tMyGradient = (*mObjectiveGradient)[tIndex];
-            tCummulativeDotProduct += tMyGradient.dot(tMyGradient);
-        }
-        mNormObjectiveGradient = std::sqrt(tCummulativeDotProduct);
+        Plato::DeferredReductions<ScalarType, OrdinalType> tReductions(*mControlReductionOperations);
+        const OrdinalType tNormHandle = tReductions.addDot(*mObjectiveGradient, *mObjectiveGradient);
+        tReductions.evaluate();
+        mNormObjectiveGradient = std::sqrt(tReductions.get(tNormHandle));
     }
     void computeControlStagnationMeasure()
     {
-        OrdinalType tNumVectors = mCurrentControl->getNumVectors();
-        std::vector<ScalarType> storage(tNumVectors, std::numeric_limits<ScalarType>::min());
-        for(OrdinalType tIndex = 0; tIndex < tNumVectors; tIndex++)
-        {
-            Plato::Vector<ScalarType, OrdinalType> & tCurrentControl = mCurrentControl->operator[](tIndex);
-            mControlWorkVector->update(1., tCurrentControl, 0.);
-            Plato::Vector<ScalarType, OrdinalType> & tPreviousControl = mPreviousControl->operator[](tIndex);
-            mControlWorkVector->update(-1., tPreviousControl, 1.);
-            mControlWorkVector->modulus();
-            storage[tIndex] = mControlReductionOperations->max(*mControlWorkVector);
-        }
-        mControlStagnationMeasure = *std::max_element(storage.begin(), storage.end());
+        Plato::DeferredReductions<ScalarType, OrdinalType> tReductions(*mControlReductionOperations);
+        const OrdinalType tStagnationHandle = tReductions.addLocalMax(this->computeLocalControlStagnationMeasure());
+        tReductions.evaluate();
+        mControlStagnationMeasure = tReductions.get(tStagnationHandle);
+    }
+    // NOTE: INDEPENDENT STOPPING MEASURES SHARE ONE GLOBAL REDUCTION
+    void computeNormObjectiveGradientAndControlStagnation()
+    {
+        Plato::DeferredReductions<ScalarType, OrdinalType> tReductions(*mControlReductionOperations);
+        const OrdinalType tNormHandle = tReductions.addDot(*mObjectiveGradient, *mObjectiveGradient);
+        const OrdinalType tStagnationHandle = tReductions.addLocalMax(this->computeLocalControlStagnationMeasure());
+        tReductions.evaluate();
+        mNormObjectiveGradient = std::sqrt(tReductions.get(tNormHandle));
+        mControlStagnationMeasure = tReductions.get(tStagnationHandle);
     }
     void computeObjectiveStagnationMeasure()
     {
@@ -630,6 +630,21 @@ public:
     }
 
 private:
+    ScalarType computeLocalControlStagnationMeasure()
+    {
+        ScalarType tLocalMax = std::numeric_limits<ScalarType>::min();
+        OrdinalType tNumVectors = mCurrentControl->getNumVectors();
+        for(OrdinalType tIndex = 0; tIndex < tNumVectors; tIndex++)
+        {
+            Plato::Vector<ScalarType, OrdinalType> & tCurrentControl = mCurrentControl->operator[](tIndex);
+            mControlWorkVector->update(1., tCurrentControl, 0.);
+            Plato::Vector<ScalarType, OrdinalType> & tPreviousControl = mPreviousControl->operator[](tIndex);
+            mControlWorkVector->update(-1., tPreviousControl, 1.);
+            mControlWorkVector->modulus();
+            tLocalMax = std::max(tLocalMax, mControlReductionOperations->localMax(*mControlWorkVector));
+        }
+        return (tLocalMax);
+    }
     void initialize(const std::shared_ptr<Plato::DataFactory<ScalarType, OrdinalType>> & aFactory)
     {
         assert(aFactory->dual().getNumVectors() > static_cast<OrdinalType>(0));
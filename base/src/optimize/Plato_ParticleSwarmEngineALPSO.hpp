@@ -48,6 +48,7 @@
 
 #pragma once
 
+#include "Plato_Macros.hpp"
 #include "Plato_Interface.hpp"
 #include "Plato_AlgebraFactory.hpp"
 #include "Plato_OptimizerInterface.hpp"
@@ -260,9 +261,16 @@ private:
     {
         Plato::StandardMultiVector<ScalarType, OrdinalType> tParticlesSet;
 
+        // particles share the objective stage slots when the swarm outnumbers them
+        const OrdinalType tNumSlots = this->mStageDataMng.getNumInputs(mObjFuncStageName);
+        if(tNumSlots == static_cast<OrdinalType>(0))
+        {
+            THROWERR("ALPSO: OBJECTIVE STAGE WITH NAME = " + mObjFuncStageName + " HAS NO INPUTS\n")
+        }
         for(OrdinalType tParticleIndex = 0; tParticleIndex < aInputs.mNumParticles; tParticleIndex++)
         {
-            std::string tMySharedDataName = this->mStageDataMng.getInput(mObjFuncStageName, tParticleIndex);
+            const OrdinalType tSlotIndex = tParticleIndex % tNumSlots;
+            std::string tMySharedDataName = this->mStageDataMng.getInput(mObjFuncStageName, tSlotIndex);
             const OrdinalType tMyNumControls = this->mInterface->size(tMySharedDataName);
             std::shared_ptr<Plato::Vector<ScalarType, OrdinalType>> tMyParticle =
                     aFactory.createVector(this->mComm, tMyNumControls, this->mInterface);
@@ -48,6 +48,7 @@
 
 #pragma once
 
+#include "Plato_Macros.hpp"
 #include "Plato_Interface.hpp"
 #include "Plato_AlgebraFactory.hpp"
 #include "Plato_OptimizerInterface.hpp"
@@ -196,9 +197,16 @@ private:
     {
         Plato::StandardMultiVector<ScalarType, OrdinalType> tParticlesSet;
 
+        // particles share the objective stage slots when the swarm outnumbers them
+        const OrdinalType tNumSlots = this->mStageDataMng.getNumInputs(mObjFuncStageName);
+        if(tNumSlots == static_cast<OrdinalType>(0))
+        {
+            THROWERR("BCPSO: OBJECTIVE STAGE WITH NAME = " + mObjFuncStageName + " HAS NO INPUTS\n")
+        }
         for(OrdinalType tVectorIndex = 0; tVectorIndex < aInputs.mNumParticles; tVectorIndex++)
         {
-            const std::string & tMySharedDataName = this->mStageDataMng.getInput(mObjFuncStageName, tVectorIndex);
+            const OrdinalType tSlotIndex = tVectorIndex % tNumSlots;
+            const std::string & tMySharedDataName = this->mStageDataMng.getInput(mObjFuncStageName, tSlotIndex);
             const OrdinalType tNumControls = this->mInterface->size(tMySharedDataName);
             std::shared_ptr<Plato::Vector<ScalarType, OrdinalType>> tVector =
                     aFactory.createVector(this->mComm, tNumControls, this->mInterface);
@@ -49,6 +49,7 @@
 #ifndef PLATO_REDUCTIONOPERATIONS_HPP_
 #define PLATO_REDUCTIONOPERATIONS_HPP_
 
+#include <vector>
 #include <memory>
 
 namespace Plato
@@ -110,6 +111,60 @@ public:
     virtual void minloc(const Plato::Vector<ScalarType, OrdinalType> & aInput,
                         Plato::ReductionOutputs<ScalarType, OrdinalType> & aOutput) const = 0;
 
+    /******************************************************************************//**
+     * @brief Returns this process' contribution to the global maximum, i.e. the maximum
+     *        before it is reduced across processes. Serial implementations return max.
+     * @param [in] aInput array of elements
+     * @return local maximum
+    **********************************************************************************/
+    virtual ScalarType localMax(const Plato::Vector<ScalarType, OrdinalType> & aInput) const
+    {
+        return (this->max(aInput));
+    }
+
+    /******************************************************************************//**
+     * @brief Returns this process' contribution to the global minimum. Serial implementations return min.
+     * @param [in] aInput array of elements
+     * @return local minimum
+    **********************************************************************************/
+    virtual ScalarType localMin(const Plato::Vector<ScalarType, OrdinalType> & aInput) const
+    {
+        return (this->min(aInput));
+    }
+
+    /******************************************************************************//**
+     * @brief Returns this process' contribution to the global sum. Serial implementations return sum.
+     * @param [in] aInput array of elements
+     * @return local sum
+    **********************************************************************************/
+    virtual ScalarType localSum(const Plato::Vector<ScalarType, OrdinalType> & aInput) const
+    {
+        return (this->sum(aInput));
+    }
+
+    /******************************************************************************//**
+     * @brief Returns this process' contribution to the global inner product.
+     * @param [in] aInputOne array of elements
+     * @param [in] aInputTwo array of elements
+     * @return local inner product
+    **********************************************************************************/
+    virtual ScalarType localDot(const Plato::Vector<ScalarType, OrdinalType> & aInputOne,
+                                const Plato::Vector<ScalarType, OrdinalType> & aInputTwo) const
+    {
+        return (aInputOne.dot(aInputTwo));
+    }
+
+    /******************************************************************************//**
+     * @brief Reduces packed local contributions across processes in place. Serial
+     *        implementations have nothing to reduce. Parallel implementations must
+     *        issue at most one collective per call.
+     * @param [in/out] aSums local contributions to global sums
+     * @param [in/out] aMaxes local contributions to global maximums
+    **********************************************************************************/
+    virtual void reduce(std::vector<ScalarType> & aSums, std::vector<ScalarType> & aMaxes) const
+    {
+    }
+
     /******************************************************************************//**
      * @brief Returns a copy of a ReductionOperations instance
      * @return copy of this instance
@@ -48,11 +48,17 @@
 
 #pragma once
 
+#include <mpi.h>
+
 #include <cmath>
 #include <string>
+#include <vector>
+#include <cstring>
 #include <sstream>
 #include <fstream>
 #include <iomanip>
+#include <numeric>
+#include <algorithm>
 
 #include "Plato_Macros.hpp"
 #include "Plato_MultiVector.hpp"
@@ -405,5 +411,218 @@ inline void read_restart_data_value(const std::string &aDataID,
 }
 // function read_restart_data_value
 
+/******************************************************************************//**
+ * @brief Header of a native restart field file. The header is followed by one
+ *   double per global node id, stored at position (global id - 1).
+**********************************************************************************/
+struct RestartFieldHeader
+{
+    char mMagic[8];        /*!< file identifier, 'PLATORST' */
+    int mVersion;          /*!< file format version */
+    int mIteration;        /*!< optimization iteration */
+    long long mNumValues;  /*!< largest global node id */
+    char mFieldName[104];  /*!< null terminated field name */
+};
+// struct RestartFieldHeader
+
+/******************************************************************************//**
+ * @brief Return true if file starts with the native restart field file identifier.
+ * @param [in] aFileName file name
+**********************************************************************************/
+inline bool is_native_restart_file(const std::string& aFileName)
+{
+    std::ifstream tFile(aFileName, std::ios::binary);
+    char tMagic[8] = {0};
+    tFile.read(tMagic, sizeof(tMagic));
+    return tFile.good() && std::memcmp(tMagic, "PLATORST", sizeof(tMagic)) == 0;
+}
+// function is_native_restart_file
+
+/******************************************************************************//**
+ * @brief Return the permutation that sorts the global ids in ascending order.
+ * @param [in] aGlobalIds global ids
+**********************************************************************************/
+inline std::vector<size_t> sort_restart_global_ids(const std::vector<long long>& aGlobalIds)
+{
+    std::vector<size_t> tOrder(aGlobalIds.size());
+    std::iota(tOrder.begin(), tOrder.end(), 0);
+    std::sort(tOrder.begin(), tOrder.end(), [&](const size_t& aLeft, const size_t& aRight)
+    {
+        return aGlobalIds[aLeft] < aGlobalIds[aRight];
+    });
+    return tOrder;
+}
+// function sort_restart_global_ids
+
+/******************************************************************************//**
+ * @brief Set a file view that selects the values of the given global ids.
+ * @param [in] aFile MPI file
+ * @param [in] aGlobalIds one-based global ids, sorted in ascending order
+**********************************************************************************/
+inline void set_restart_field_view(MPI_File& aFile, const std::vector<long long>& aGlobalIds)
+{
+    std::vector<int> tDisplacements(aGlobalIds.size());
+    for(size_t tIndex = 0; tIndex < aGlobalIds.size(); tIndex++)
+    {
+        tDisplacements[tIndex] = static_cast<int>(aGlobalIds[tIndex] - 1);
+    }
+
+    MPI_Datatype tFileType;
+    MPI_Type_create_indexed_block(static_cast<int>(tDisplacements.size()), 1, tDisplacements.data(), MPI_DOUBLE, &tFileType);
+    MPI_Type_commit(&tFileType);
+    MPI_File_set_view(aFile, sizeof(Plato::RestartFieldHeader), MPI_DOUBLE, tFileType, "native", MPI_INFO_NULL);
+    MPI_Type_free(&tFileType);
+}
+// function set_restart_field_view
+
+/******************************************************************************//**
+ * @brief Collectively write a nodal field to a native restart file. Each processor
+ *   passes the nodes it owns; every global id must be owned by exactly one processor.
+ * @param [in] aComm communicator
+ * @param [in] aFileName restart file name
+ * @param [in] aFieldName field name
+ * @param [in] aIteration optimization iteration
+ * @param [in] aGlobalIds one-based global ids of the owned nodes
+ * @param [in] aValues field values of the owned nodes
+**********************************************************************************/
+inline void write_restart_field(const MPI_Comm& aComm,
+                                const std::string& aFileName,
+                                const std::string& aFieldName,
+                                const int& aIteration,
+                                const std::vector<long long>& aGlobalIds,
+                                const std::vector<double>& aValues)
+{
+    Plato::is_restart_data_identifier_defined(aFieldName);
+    if(aFieldName.size() >= sizeof(Plato::RestartFieldHeader::mFieldName))
+    {
+        THROWERR("RESTART FIELD NAME '" + aFieldName + "' IS TOO LONG.\n")
+    }
+    if(aGlobalIds.size() != aValues.size())
+    {
+        THROWERR("RESTART FIELD '" + aFieldName + "' HAS " + std::to_string(aGlobalIds.size()) + " GLOBAL IDS AND "
+                 + std::to_string(aValues.size()) + " VALUES.\n")
+    }
+
+    long long tLocalNumValues = 0;
+    for(auto& tGlobalId : aGlobalIds)
+    {
+        tLocalNumValues = std::max(tLocalNumValues, tGlobalId);
+    }
+    long long tNumValues = 0;
+    MPI_Allreduce(&tLocalNumValues, &tNumValues, 1, MPI_LONG_LONG, MPI_MAX, aComm);
+
+    // file views require ascending displacements
+    std::vector<size_t> tOrder = Plato::sort_restart_global_ids(aGlobalIds);
+    std::vector<long long> tSortedIds(aGlobalIds.size());
+    std::vector<double> tSortedValues(aValues.size());
+    for(size_t tIndex = 0; tIndex < tOrder.size(); tIndex++)
+    {
+        tSortedIds[tIndex] = aGlobalIds[tOrder[tIndex]];
+        tSortedValues[tIndex] = aValues[tOrder[tIndex]];
+    }
+
+    MPI_File tFile;
+    int tError = MPI_File_open(aComm, const_cast<char*>(aFileName.c_str()), MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &tFile);
+    if(tError != MPI_SUCCESS)
+    {
+        THROWERR("COULD NOT OPEN RESTART FILE '" + aFileName + "' FOR WRITING.\n")
+    }
+    MPI_File_set_size(tFile, sizeof(Plato::RestartFieldHeader) + tNumValues * sizeof(double));
+
+    int tMyRank = 0;
+    MPI_Comm_rank(aComm, &tMyRank);
+    if(tMyRank == 0)
+    {
+        Plato::RestartFieldHeader tHeader;
+        std::memset(&tHeader, 0, sizeof(tHeader));
+        std::memcpy(tHeader.mMagic, "PLATORST", sizeof(tHeader.mMagic));
+        tHeader.mVersion = 1;
+        tHeader.mIteration = aIteration;
+        tHeader.mNumValues = tNumValues;
+        std::strncpy(tHeader.mFieldName, aFieldName.c_str(), sizeof(tHeader.mFieldName) - 1);
+        MPI_File_write_at(tFile, 0, &tHeader, sizeof(tHeader), MPI_BYTE, MPI_STATUS_IGNORE);
+    }
+
+    Plato::set_restart_field_view(tFile, tSortedIds);
+    MPI_File_write_all(tFile, tSortedValues.data(), static_cast<int>(tSortedValues.size()), MPI_DOUBLE, MPI_STATUS_IGNORE);
+    MPI_File_close(&tFile);
+}
+// function write_restart_field
+
+/******************************************************************************//**
+ * @brief Collectively read a nodal field from a native restart file. The reading
+ *   decomposition does not need to match the one used to write the file.
+ * @param [in] aComm communicator
+ * @param [in] aFileName restart file name
+ * @param [in] aFieldName field name
+ * @param [in] aGlobalIds one-based global ids of the requested nodes
+ * @param [out] aValues field values of the requested nodes
+ * @return optimization iteration stored in the restart file
+**********************************************************************************/
+inline int read_restart_field(const MPI_Comm& aComm,
+                              const std::string& aFileName,
+                              const std::string& aFieldName,
+                              const std::vector<long long>& aGlobalIds,
+                              std::vector<double>& aValues)
+{
+    Plato::is_restart_data_identifier_defined(aFieldName);
+
+    MPI_File tFile;
+    int tError = MPI_File_open(aComm, const_cast<char*>(aFileName.c_str()), MPI_MODE_RDONLY, MPI_INFO_NULL, &tFile);
+    if(tError != MPI_SUCCESS)
+    {
+        THROWERR("COULD NOT OPEN RESTART FILE '" + aFileName + "' FOR READING.\n")
+    }
+
+    Plato::RestartFieldHeader tHeader;
+    MPI_File_read_at_all(tFile, 0, &tHeader, sizeof(tHeader), MPI_BYTE, MPI_STATUS_IGNORE);
+    tHeader.mFieldName[sizeof(tHeader.mFieldName) - 1] = '\0';
+    if(std::memcmp(tHeader.mMagic, "PLATORST", sizeof(tHeader.mMagic)) != 0 || tHeader.mVersion != 1)
+    {
+        MPI_File_close(&tFile);
+        THROWERR("FILE '" + aFileName + "' IS NOT A RESTART FIELD FILE.\n")
+    }
+    if(aFieldName != tHeader.mFieldName)
+    {
+        MPI_File_close(&tFile);
+        THROWERR("RESTART FILE '" + aFileName + "' HOLDS FIELD '" + tHeader.mFieldName + "', NOT '" + aFieldName + "'.\n")
+    }
+
+    // agree on errors before the collective read so that no processor is left waiting
+    int tLocalOutOfRange = 0;
+    for(auto& tGlobalId : aGlobalIds)
+    {
+        tLocalOutOfRange += (tGlobalId < 1 || tGlobalId > tHeader.mNumValues) ? 1 : 0;
+    }
+    int tOutOfRange = 0;
+    MPI_Allreduce(&tLocalOutOfRange, &tOutOfRange, 1, MPI_INT, MPI_SUM, aComm);
+    if(tOutOfRange > 0)
+    {
+        MPI_File_close(&tFile);
+        THROWERR("RESTART FILE '" + aFileName + "' DOES NOT HOLD " + std::to_string(tOutOfRange) + " OF THE REQUESTED GLOBAL IDS.\n")
+    }
+
+    std::vector<size_t> tOrder = Plato::sort_restart_global_ids(aGlobalIds);
+    std::vector<long long> tSortedIds(aGlobalIds.size());
+    for(size_t tIndex = 0; tIndex < tOrder.size(); tIndex++)
+    {
+        tSortedIds[tIndex] = aGlobalIds[tOrder[tIndex]];
+    }
+
+    std::vector<double> tSortedValues(tSortedIds.size());
+    Plato::set_restart_field_view(tFile, tSortedIds);
+    MPI_File_read_all(tFile, tSortedValues.data(), static_cast<int>(tSortedValues.size()), MPI_DOUBLE, MPI_STATUS_IGNORE);
+    MPI_File_close(&tFile);
+
+    aValues.resize(aGlobalIds.size());
+    for(size_t tIndex = 0; tIndex < tOrder.size(); tIndex++)
+    {
+        aValues[tOrder[tIndex]] = tSortedValues[tIndex];
+    }
+
+    return tHeader.mIteration;
+}
+// function read_restart_field
+
 }
 // namespace Plato
@@ -48,9 +48,11 @@
 #ifndef PLATO_TRUSTREGIONALGORITHMDATAMNG_HPP_
 #define PLATO_TRUSTREGIONALGORITHMDATAMNG_HPP_
 
+#include <cmath>
 #include <limits>
 #include <memory>
 #include <cassert>
+#include <algorithm>
 
 #include "Plato_Vector.hpp"
 #include "Plato_HostBounds.hpp"
@@ -58,6 +60,7 @@
 #include "Plato_DataFactory.hpp"
 #include "Plato_DeviceBounds.hpp"
 #include "Plato_LinearAlgebra.hpp"
+#include "Plato_DeferredReductions.hpp"
 #include "Plato_ReductionOperations.hpp"
 
 namespace Plato
@@ -632,18 +635,10 @@ public:
     // NOTE: STAGNATION MEASURE CRITERION
     void computeControlStagnationMeasure()
     {
-        OrdinalType tNumVectors = mCurrentControl->getNumVectors();
-        std::vector<ScalarType> tStorage(tNumVectors, std::numeric_limits<ScalarType>::min());
-        for(OrdinalType tIndex = 0; tIndex < tNumVectors; tIndex++)
-        {
-            const Plato::Vector<ScalarType, OrdinalType> & tMyCurrentControl = mCurrentControl->operator[](tIndex);
-            mControlWorkVector->update(1., tMyCurrentControl, 0.);
-            const Plato::Vector<ScalarType, OrdinalType> & tMyPreviousControl = mPreviousControl->operator[](tIndex);
-            mControlWorkVector->update(-1., tMyPreviousControl, 1.);
-            mControlWorkVector->modulus();
-            tStorage[tIndex] = mControlReductionOperations->max(*mControlWorkVector);
-        }
-        mControlStagnationMeasure = *std::max_element(tStorage.begin(), tStorage.end());
+        Plato::DeferredReductions<ScalarType, OrdinalType> tReductions(*mControlReductionOperations);
+        const OrdinalType tStagnationHandle = tReductions.addLocalMax(this->computeLocalControlStagnationMeasure());
+        tReductions.evaluate();
+        mControlStagnationMeasure = tReductions.get(tStagnationHandle);
     }
     ScalarType getControlStagnationMeasure() const
     {
@@ -653,18 +648,15 @@ public:
     // NOTE: NORM OF CURRENT PROJECTED GRADIENT
     ScalarType computeProjectedVectorNorm(const Plato::MultiVector<ScalarType, OrdinalType> & aInput)
     {
-        Plato::update(1., aInput, 0., *mControlWorkMultiVector);
-        Plato::entryWiseProduct(*mInactiveSet, *mControlWorkMultiVector);
-        const ScalarType tOutput =
-                mIsMeanNormEnabled == true ? Plato::norm_mean(*mControlWorkMultiVector) : Plato::norm(*mControlWorkMultiVector);
+        Plato::DeferredReductions<ScalarType, OrdinalType> tReductions(*mControlReductionOperations);
+        const OrdinalType tNormHandle = this->addProjectedVectorDot(aInput, tReductions);
+        tReductions.evaluate();
+        const ScalarType tOutput = this->computeNormFromDotProduct(tReductions.get(tNormHandle));
         return(tOutput);
     }
     void computeNormProjectedGradient()
     {
-        Plato::update(1., *mCurrentGradient, 0., *mControlWorkMultiVector);
-        Plato::entryWiseProduct(*mInactiveSet, *mControlWorkMultiVector);
-        mNormProjectedGradient =
-                mIsMeanNormEnabled == true ? Plato::norm_mean(*mControlWorkMultiVector) : Plato::norm(*mControlWorkMultiVector);
+        mNormProjectedGradient = this->computeProjectedVectorNorm(*mCurrentGradient);
     }
 
     ScalarType getNormProjectedGradient() const
@@ -692,18 +684,27 @@ public:
     // NOTE: STATIONARITY MEASURE CALCULATION
     void computeStationarityMeasure()
     {
-        assert(mCurrentControl.get() != nullptr);
-        assert(mCurrentGradient.get() != nullptr);
-        assert(mControlLowerBounds.get() != nullptr);
-        assert(mControlUpperBounds.get() != nullptr);
+        Plato::DeferredReductions<ScalarType, OrdinalType> tReductions(*mControlReductionOperations);
+        const OrdinalType tStationarityHandle = this->addStationarityDot(tReductions);
+        tReductions.evaluate();
+        mStationarityMeasure = this->computeNormFromDotProduct(tReductions.get(tStationarityHandle));
+    }
 
-        Plato::update(1., *mCurrentControl, 0., *mControlWorkMultiVector);
-        Plato::update(-1., *mCurrentGradient, 1., *mControlWorkMultiVector);
-        mBounds->project(*mControlLowerBounds, *mControlUpperBounds, *mControlWorkMultiVector);
-        Plato::update(1., *mCurrentControl, -1., *mControlWorkMultiVector);
-        Plato::entryWiseProduct(*mInactiveSet, *mControlWorkMultiVector);
-        mStationarityMeasure =
-                mIsMeanNormEnabled == true ? Plato::norm_mean(*mControlWorkMultiVector) : Plato::norm(*mControlWorkMultiVector);
+    /******************************************************************************//**
+     * @brief Compute stationarity measure, norm of the projected gradient and control
+     *        stagnation measure. The reductions are independent, so they share one collective.
+    **********************************************************************************/
+    void computeStoppingMeasures()
+    {
+        Plato::DeferredReductions<ScalarType, OrdinalType> tReductions(*mControlReductionOperations);
+        const OrdinalType tStationarityHandle = this->addStationarityDot(tReductions);
+        const OrdinalType tNormHandle = this->addProjectedVectorDot(*mCurrentGradient, tReductions);
+        const OrdinalType tStagnationHandle = tReductions.addLocalMax(this->computeLocalControlStagnationMeasure());
+        tReductions.evaluate();
+
+        mStationarityMeasure = this->computeNormFromDotProduct(tReductions.get(tStationarityHandle));
+        mNormProjectedGradient = this->computeNormFromDotProduct(tReductions.get(tNormHandle));
+        mControlStagnationMeasure = tReductions.get(tStagnationHandle);
     }
 
     ScalarType getStationarityMeasure() const
@@ -753,6 +754,77 @@ public:
     }
 
 private:
+    /******************************************************************************//**
+     * @brief Queue inner product of the input projected onto the inactive set
+     * @param [in] aInput input multi-vector
+     * @param [in/out] aReductions deferred reductions
+     * @return handle to the inner product
+    **********************************************************************************/
+    OrdinalType addProjectedVectorDot(const Plato::MultiVector<ScalarType, OrdinalType> & aInput,
+                                      Plato::DeferredReductions<ScalarType, OrdinalType> & aReductions)
+    {
+        Plato::update(1., aInput, 0., *mControlWorkMultiVector);
+        Plato::entryWiseProduct(*mInactiveSet, *mControlWorkMultiVector);
+        return (aReductions.addDot(*mControlWorkMultiVector, *mControlWorkMultiVector));
+    }
+
+    /******************************************************************************//**
+     * @brief Queue inner product of the projected gradient step restricted to the inactive set
+     * @param [in/out] aReductions deferred reductions
+     * @return handle to the inner product
+    **********************************************************************************/
+    OrdinalType addStationarityDot(Plato::DeferredReductions<ScalarType, OrdinalType> & aReductions)
+    {
+        assert(mCurrentControl.get() != nullptr);
+        assert(mCurrentGradient.get() != nullptr);
+        assert(mControlLowerBounds.get() != nullptr);
+        assert(mControlUpperBounds.get() != nullptr);
+
+        Plato::update(1., *mCurrentControl, 0., *mControlWorkMultiVector);
+        Plato::update(-1., *mCurrentGradient, 1., *mControlWorkMultiVector);
+        mBounds->project(*mControlLowerBounds, *mControlUpperBounds, *mControlWorkMultiVector);
+        Plato::update(1., *mCurrentControl, -1., *mControlWorkMultiVector);
+        Plato::entryWiseProduct(*mInactiveSet, *mControlWorkMultiVector);
+        return (aReductions.addDot(*mControlWorkMultiVector, *mControlWorkMultiVector));
+    }
+
+    /******************************************************************************//**
+     * @brief Convert a global inner product into the norm used by the algorithm, see
+     *        Plato::norm and Plato::norm_mean
+     * @param [in] aDotProduct global inner product of the control work multi-vector
+     * @return norm
+    **********************************************************************************/
+    ScalarType computeNormFromDotProduct(const ScalarType & aDotProduct) const
+    {
+        if(mIsMeanNormEnabled == true)
+        {
+            const OrdinalType tVECTOR_INDEX = 0;
+            const OrdinalType tNumElem = (*mControlWorkMultiVector)[tVECTOR_INDEX].size() * mControlWorkMultiVector->getNumVectors();
+            return (aDotProduct / tNumElem);
+        }
+        return (std::sqrt(aDotProduct));
+    }
+
+    /******************************************************************************//**
+     * @brief Return this process' maximum absolute change in the controls
+     * @return local control stagnation measure
+    **********************************************************************************/
+    ScalarType computeLocalControlStagnationMeasure()
+    {
+        ScalarType tLocalMax = std::numeric_limits<ScalarType>::min();
+        OrdinalType tNumVectors = mCurrentControl->getNumVectors();
+        for(OrdinalType tIndex = 0; tIndex < tNumVectors; tIndex++)
+        {
+            const Plato::Vector<ScalarType, OrdinalType> & tMyCurrentControl = mCurrentControl->operator[](tIndex);
+            mControlWorkVector->update(1., tMyCurrentControl, 0.);
+            const Plato::Vector<ScalarType, OrdinalType> & tMyPreviousControl = mPreviousControl->operator[](tIndex);
+            mControlWorkVector->update(-1., tMyPreviousControl, 1.);
+            mControlWorkVector->modulus();
+            tLocalMax = std::max(tLocalMax, mControlReductionOperations->localMax(*mControlWorkVector));
+        }
+        return (tLocalMax);
+    }
+
     /******************************************************************************//**
      * @brief Initialize defaults for core data structures
      * @param [in] aDataFactory linear algebra factory
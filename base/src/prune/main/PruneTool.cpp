@@ -6,6 +6,37 @@
 #include <stk_util/parallel/CommSparse.hpp>
 #include <stk_mesh/base/MetaData.hpp>
 #include <algorithm>
+#include <unordered_map>
+
+namespace
+{
+
+// Union-find root with path halving.
+template <typename Key, typename ParentMap>
+Key find_root(ParentMap &parent, Key key)
+{
+  while(parent[key] != key)
+  {
+    parent[key] = parent[parent[key]];
+    key = parent[key];
+  }
+  return key;
+}
+
+// Join the sets of key1 and key2, keeping the smaller root so that the
+// root of a set is its lowest key.
+template <typename Key, typename ParentMap>
+void join_sets(ParentMap &parent, Key key1, Key key2)
+{
+  Key root1 = find_root(parent, key1);
+  Key root2 = find_root(parent, key2);
+  if(root1 < root2)
+    parent[root2] = root1;
+  else if(root2 < root1)
+    parent[root1] = root2;
+}
+
+}
 
 void PruneTool::prune_mesh(const std::vector<PruneHandle> &elem_list,
                                std::set<PruneHandle> &elems_to_keep,
@@ -235,90 +266,88 @@ void PruneTool::find_local_groups(
                        std::vector<elem_group*> &groups,
                        PruneMeshAPISTK *mesh_api)
 {
-  bool done = false;
-  std::map<stk::mesh::EntityId, int> processed_map;
-
-  // Initialize processed map to zeros
-  std::set<stk::mesh::EntityId>::iterator set_it = elem_set.begin();
+  // Give the flagged elems a flat local index, seeds from elem_set first.
+  // local_index also remembers unflagged elems that were looked at (as -1)
+  // so that each elem is only looked up in elem_vals once.
+  std::unordered_map<stk::mesh::EntityId, int> local_index;
+  std::vector<stk::mesh::EntityId> local_ids;
+  std::vector<int> parent;
+  std::set<stk::mesh::EntityId>::const_iterator set_it = elem_set.begin();
   while(set_it != elem_set.end())
   {
-    processed_map[*set_it] = 0;
+    std::map<stk::mesh::EntityId, int>::iterator val_it = elem_vals.find(*set_it);
+    if(val_it != elem_vals.end() && val_it->second)
+    {
+      local_index[*set_it] = local_ids.size();
+      parent.push_back(local_ids.size());
+      local_ids.push_back(*set_it);
+    }
     ++set_it;
   }
 
-  while(!done)
+  // One pass over the indexed elems joins each with the flagged elems
+  // it shares a node with.  Flagged neighbors that are not in elem_set are
+  // indexed as they are found so the pass also walks through them.
+  for(size_t i=0; i<local_ids.size(); ++i)
   {
-    done = true;
-    stk::mesh::EntityId start_elem = 0;
-    // Look for a flagged elem that has not been processed.
-    set_it = elem_set.begin();
-    while(set_it != elem_set.end())
+    stk::mesh::Entity cur_elem = mesh_api->bulk_data()->get_entity(
+                           stk::topology::ELEMENT_RANK, local_ids[i]);
+    stk::mesh::Entity const *nodes = mesh_api->bulk_data()->begin_nodes(cur_elem);
+    int num_nodes = mesh_api->bulk_data()->num_nodes(cur_elem);
+    for(int j=0; j<num_nodes; ++j)
     {
-      if(elem_vals[*set_it] && !processed_map[*set_it])
+      stk::mesh::Entity node_entity = nodes[j];
+      stk::mesh::Entity const *node_elems = mesh_api->
+                        bulk_data()->begin_elements(node_entity);
+      int num_elems = mesh_api->bulk_data()->num_elements(node_entity);
+      for(int k=0; k<num_elems; ++k)
       {
-        done = false;
-        start_elem = *set_it;
-        break;
-      }
-      ++set_it;
-    }
-    if(start_elem)
-    {
-      elem_group *new_group = new elem_group;
-      groups.push_back(new_group);
-      std::set<stk::mesh::EntityId> elems_to_process;
-      elems_to_process.insert(start_elem);
-      while(!elems_to_process.empty())
-      {
-        // get the last entry in the set in case it is more efficient
-        // to erase this one
-        std::set<stk::mesh::EntityId>::iterator it = elems_to_process.end();
-        --it;
-        stk::mesh::EntityId cur_elem_id = *it;
-        processed_map[cur_elem_id] = 1;
-        elems_to_process.erase(it);
-        new_group->elems.insert(cur_elem_id);
-        stk::mesh::Entity cur_elem = mesh_api->bulk_data()->get_entity(
-                               stk::topology::ELEMENT_RANK, cur_elem_id);
-        stk::mesh::Entity const *nodes = mesh_api->bulk_data()->begin_nodes(cur_elem);
-        int num_nodes = mesh_api->bulk_data()->num_nodes(cur_elem);
-
-        for(int i=0; i<num_nodes; ++i)
+        stk::mesh::Entity cur_node_elem = node_elems[k];
+        if(cur_node_elem == cur_elem)
+          continue;
+        stk::mesh::EntityId elem_id = mesh_api->bulk_data()->identifier(cur_node_elem);
+        int neighbor_index;
+        std::unordered_map<stk::mesh::EntityId, int>::iterator index_it = local_index.find(elem_id);
+        if(index_it != local_index.end())
         {
-          stk::mesh::Entity node_entity = nodes[i];
-          stk::mesh::Entity const *node_elems = mesh_api->  
-                            bulk_data()->begin_elements(node_entity);
-          int num_elems = mesh_api->bulk_data()->num_elements(node_entity);
-          for(int j=0; j<num_elems; ++j)
+          neighbor_index = index_it->second;
+        }
+        else
+        {
+          std::map<stk::mesh::EntityId, int>::iterator val_it = elem_vals.find(elem_id);
+          neighbor_index = -1;
+          if(val_it != elem_vals.end() && val_it->second)
           {
-            stk::mesh::Entity cur_node_elem = node_elems[j];
-            stk::mesh::EntityId elem_id = mesh_api->bulk_data()->identifier(cur_node_elem);
-            // Make sure hex is locally owned
-            if(cur_node_elem != cur_elem )
-            {
-              if(elem_vals.count(elem_id) && elem_vals[elem_id] &&
-                   !processed_map[elem_id])
-              {
-                elems_to_process.insert(elem_id);
-              }
-            }
+            neighbor_index = local_ids.size();
+            parent.push_back(local_ids.size());
+            local_ids.push_back(elem_id);
           }
+          local_index[elem_id] = neighbor_index;
         }
+        if(neighbor_index >= 0)
+          join_sets(parent, (int)i, neighbor_index);
       }
-      // Now find the lowest global element id in this group and set the group id to it
-      std::set<stk::mesh::EntityId>::iterator it = new_group->elems.begin();
-      stk::mesh::EntityId min_id = *it;
-      ++it;
-      while(it != new_group->elems.end())
-      {
-        stk::mesh::EntityId cur_id = *it;
-        if(min_id > cur_id)
-          min_id = cur_id;
-        ++it;
-      }
-      new_group->id = min_id;
     }
   }
+
+  // Make a group per set.  Sets are ordered by their first seed, and the
+  // group id is the lowest global element id in the group.
+  std::vector<int> root_group(local_ids.size(), -1);
+  for(size_t i=0; i<local_ids.size(); ++i)
+  {
+    int root = find_root(parent, (int)i);
+    if(root_group[root] < 0)
+    {
+      elem_group *new_group = new elem_group;
+      new_group->id = local_ids[i];
+      root_group[root] = groups.size();
+      groups.push_back(new_group);
+    }
+    elem_group *cur_group = groups[root_group[root]];
+    cur_group->elems.insert(local_ids[i]);
+    if(cur_group->id > local_ids[i])
+      cur_group->id = local_ids[i];
+  }
 }
 
 void PruneTool::find_local_equivs(std::vector<proc_node_map> &procs,
@@ -328,6 +357,18 @@ void PruneTool::find_local_equivs(std::vector<proc_node_map> &procs,
 {
   if(procs.size() > 0)
   {
+    // Groups are disjoint, so each elem maps to at most one group.
+    std::unordered_map<stk::mesh::EntityId, size_t> elem_groups;
+    for(size_t k=0; k<groups.size(); ++k)
+    {
+      std::set<stk::mesh::EntityId>::iterator it = groups[k]->elems.begin();
+      while(it != groups[k]->elems.end())
+      {
+        elem_groups[*it] = k;
+        ++it;
+      }
+    }
+
     stk::CommSparse comm_spec(mesh_api->bulk_data()->parallel());
     for(int phase=0; phase<2; ++phase)
     {
@@ -342,14 +383,10 @@ void PruneTool::find_local_equivs(std::vector<proc_node_map> &procs,
           comm_spec.send_buffer(other_proc).pack<stk::mesh::EntityId>
                   (procs[i].elements[j]);
           stk::mesh::EntityId group_id = 0;
-          for(size_t k=0; k<groups.size(); ++k)
-          {
-            if(groups[k]->elems.find(procs[i].elements[j]) != groups[k]->elems.end())
-            {
-              group_id = groups[k]->id;
-              break;
-            }
-          }
+          std::unordered_map<stk::mesh::EntityId, size_t>::iterator group_it =
+                  elem_groups.find(procs[i].elements[j]);
+          if(group_it != elem_groups.end())
+            group_id = groups[group_it->second]->id;
           comm_spec.send_buffer(other_proc).pack<int>(group_id);
         }
       }
@@ -377,24 +414,12 @@ void PruneTool::find_local_equivs(std::vector<proc_node_map> &procs,
         comm_spec.recv_buffer(other_proc).unpack<int>(group_id);
         if(group_id > 0)
         {
-          for(size_t k=0; k<groups.size(); ++k)
+          std::unordered_map<stk::mesh::EntityId, size_t>::iterator group_it = elem_groups.find(elem_id);
+          if(group_it != elem_groups.end())
           {
-            if(groups[k]->elems.find(elem_id) != groups[k]->elems.end())
-            {
-              if(groups[k]->id != (stk::mesh::EntityId)group_id)
-              {
-                if(!my_equivs.count(groups[k]->id))
-                {
-                  std::set<stk::mesh::EntityId> new_set;
-                  new_set.insert(group_id);
-                  my_equivs[groups[k]->id] = new_set;
-                }
-                else
-                {
-                  my_equivs[groups[k]->id].insert(group_id);
-                }
-              }
-            }
+            stk::mesh::EntityId my_group_id = groups[group_it->second]->id;
+            if(my_group_id != (stk::mesh::EntityId)group_id)
+              my_equivs[my_group_id].insert(group_id);
           }
         }
       }
@@ -407,67 +432,39 @@ void PruneTool::get_global_equiv_info(
               std::map<stk::mesh::EntityId, std::set<stk::mesh::EntityId> > &global_equivs,
               PruneMeshAPISTK *mesh_api)
 {
-  // Determine how much info each processor will send.
-  int num_procs = mesh_api->bulk_data()->parallel_size();
-  int my_rank = mesh_api->bulk_data()->parallel_rank();
-  int global_counts [num_procs];
-  int local_counts[num_procs];
-  for(int i=0; i<num_procs; ++i)
-  {
-    global_counts[i] = 0;
-    local_counts[i] = 0;
-  }
-  int cnt = 0;
+  std::vector<int> local_equiv_pairs;
   std::map<stk::mesh::EntityId,std::set<stk::mesh::EntityId> >::iterator it = local_equivs.begin();
   while(it != local_equivs.end())
   {
-    cnt += (2 * (it->second.size()));
+    std::set<stk::mesh::EntityId>::iterator it2 = it->second.begin();
+    while(it2 != it->second.end())
+    {
+      local_equiv_pairs.push_back(it->first);
+      local_equiv_pairs.push_back(*it2);
+      ++it2;
+    }
     ++it;
   }
 
-  local_counts[my_rank] = cnt;
-
-  MPI_Allreduce(local_counts,
-                global_counts, num_procs,
-                sierra::MPI::Datatype<int>::type(),
-                MPI_MAX, mesh_api->bulk_data()->parallel()); 
+  // Determine how much info each processor will send and gather it all.
+  int num_procs = mesh_api->bulk_data()->parallel_size();
+  int local_count = local_equiv_pairs.size();
+  std::vector<int> global_counts(num_procs, 0);
+  MPI_Allgather(&local_count, 1, sierra::MPI::Datatype<int>::type(),
+                global_counts.data(), 1, sierra::MPI::Datatype<int>::type(),
+                mesh_api->bulk_data()->parallel());
 
-  // Now get the equiv info from each processor. 
+  std::vector<int> offsets(num_procs, 0);
   int total_num = 0;
-  int my_start_index = 0;
   for(int i=0; i<num_procs; ++i)
   {
+    offsets[i] = total_num;
     total_num += global_counts[i];
-    if(i < my_rank)
-      my_start_index += global_counts[i]; 
-  }
-
-  int global_equiv_pairs[total_num];
-  int local_equiv_pairs[total_num];
-  for(int i=0; i<total_num; ++i)
-  {
-    global_equiv_pairs[i] = 0;
-    local_equiv_pairs[i] = 0;
   }
-  it = local_equivs.begin();
-  while(it != local_equivs.end())
-  {
-    std::set<stk::mesh::EntityId>::iterator it2 = it->second.begin();
-    while(it2 != it->second.end())
-    {
-      local_equiv_pairs[my_start_index] = it->first;
-      my_start_index++;
-      local_equiv_pairs[my_start_index] = *it2;
-      my_start_index++;
-      ++it2;
-    }
-    ++it;
-  }
-
-  MPI_Allreduce(local_equiv_pairs,
-                global_equiv_pairs, total_num,
-                sierra::MPI::Datatype<int>::type(),
-                MPI_MAX, mesh_api->bulk_data()->parallel()); 
+  std::vector<int> global_equiv_pairs(total_num);
+  MPI_Allgatherv(local_equiv_pairs.data(), local_count, sierra::MPI::Datatype<int>::type(),
+                 global_equiv_pairs.data(), global_counts.data(), offsets.data(),
+                 sierra::MPI::Datatype<int>::type(), mesh_api->bulk_data()->parallel());
 
   // Now we should have a list of all of the pairs of 
   // groups ids that are equivalent
@@ -476,95 +473,55 @@ void PruneTool::get_global_equiv_info(
   {
     stk::mesh::EntityId id1 = global_equiv_pairs[2*i];
     stk::mesh::EntityId id2 = global_equiv_pairs[2*i+1];
-    if(!global_equivs.count(id1))
-    {
-      std::set<stk::mesh::EntityId> new_set;
-      new_set.insert(id2);
-      global_equivs[id1] = new_set;
-    }
-    else
-    {
-      global_equivs[id1].insert(id2);
-    }
+    global_equivs[id1].insert(id2);
   }
 }
 
-void PruneTool::recursively_consolidate_groups(stk::mesh::EntityId key,
-                             std::map<stk::mesh::EntityId, 
-                             std::set<stk::mesh::EntityId> > &global_equivs,
-                             std::set<stk::mesh::EntityId> &new_set)
-{
-  if(global_equivs.count(key))
-  {
-    std::set<stk::mesh::EntityId> copy = global_equivs[key];
-    global_equivs.erase(key);
-    std::set<stk::mesh::EntityId>::iterator it = copy.begin();
-    while(it != copy.end())
-    {
-      new_set.insert(*it);
-      recursively_consolidate_groups(*it, global_equivs, new_set); 
-      ++it;
-    }
-  } 
-}
-
 void PruneTool::consolidate_groups(
               std::map<stk::mesh::EntityId, 
               std::set<stk::mesh::EntityId> > &global_equivs,
               std::vector<elem_group*> &groups,
               PruneMeshAPISTK *mesh_api)
 {
-  std::vector<std::set<stk::mesh::EntityId> > unique_group_sets;
-  while(!global_equivs.empty())
+  // Every processor resolves the same global pairs, so every processor
+  // agrees on the root, the lowest id, of each set of equivalent groups.
+  std::unordered_map<stk::mesh::EntityId, stk::mesh::EntityId> parent;
+  std::map<stk::mesh::EntityId, std::set<stk::mesh::EntityId> >::iterator it = global_equivs.begin();
+  while(it != global_equivs.end())
   {
-    std::map<stk::mesh::EntityId, std::set<stk::mesh::EntityId> >::iterator it = global_equivs.begin();
-    std::set<stk::mesh::EntityId> new_set;
-    new_set.insert(it->first);
-    recursively_consolidate_groups(it->first, global_equivs, new_set);
-    unique_group_sets.push_back(new_set);
+    parent.emplace(it->first, it->first);
+    std::set<stk::mesh::EntityId>::iterator it2 = it->second.begin();
+    while(it2 != it->second.end())
+    {
+      parent.emplace(*it2, *it2);
+      join_sets(parent, it->first, *it2);
+      ++it2;
+    }
+    ++it;
   }
+  global_equivs.clear();
 
-  // Use global equivalencing to find the lowest group ids for my groups.
+  // Relabel my groups and merge the ones that end up with the same id
+  // into the first of them.
+  std::unordered_map<stk::mesh::EntityId, size_t> first_group;
+  std::vector<elem_group*> merged_groups;
   for(size_t i=0; i<groups.size(); ++i)
   {
-    stk::mesh::EntityId cur_id = groups[i]->id;
-    for(size_t j=0; j<unique_group_sets.size(); ++j)
+    if(parent.count(groups[i]->id))
+      groups[i]->id = find_root(parent, groups[i]->id);
+    std::unordered_map<stk::mesh::EntityId, size_t>::iterator first_it = first_group.find(groups[i]->id);
+    if(first_it == first_group.end())
     {
-      if(unique_group_sets[j].find(cur_id) != unique_group_sets[j].end())
-      {
-        groups[i]->id = *(unique_group_sets[j].begin());
-        break;
-      }
+      first_group[groups[i]->id] = merged_groups.size();
+      merged_groups.push_back(groups[i]);
     }
-  }
-
-  // If I have any groups with the same ids consolidate them.
-  size_t num_groups = groups.size();
-  for(size_t i=0; i<num_groups; ++i)
-  {
-    stk::mesh::EntityId id1 = groups[i]->id;
-    for(size_t j=i+1; j<num_groups; ++j)
+    else
     {
-      stk::mesh::EntityId id2 = groups[j]->id;
-      if(id1 == id2)
-      {
-        std::set<stk::mesh::EntityId>::iterator it = groups[j]->elems.begin();
-        while(it != groups[j]->elems.end())
-        {
-          groups[i]->elems.insert(*it);
-          ++it;
-        }
-        delete groups[j];
-        for(size_t k=j; k<num_groups-1; k++)
-          groups[k] = groups[k+1];
-        std::vector<elem_group*>::iterator it2 = groups.end();
-        --it2;
-        groups.erase(it2);
-        num_groups--;
-        j--;
-      }
+      merged_groups[first_it->second]->elems.insert(groups[i]->elems.begin(), groups[i]->elems.end());
+      delete groups[i];
     }
   }
+  groups.swap(merged_groups);
 }
 
 int PruneTool::number_of_groups(
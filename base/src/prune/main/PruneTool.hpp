@@ -24,9 +24,6 @@ struct elem_group
 class PruneTool
 {
 private:
-  void recursively_consolidate_groups(stk::mesh::EntityId key,
-                             std::map<stk::mesh::EntityId, std::set<stk::mesh::EntityId> > &global_equivs,
-                             std::set<stk::mesh::EntityId> &new_set);
   void consolidate_groups(
               std::map<stk::mesh::EntityId, std::set<stk::mesh::EntityId> > &global_equivs,
               std::vector<elem_group*> &groups,
@@ -18,6 +18,10 @@
 
 #include <Ioss_SubSystem.h>
 
+#include <algorithm>
+#include <functional>
+#include <thread>
+
 #define platoPI 3.141592653589793
 
 namespace plato
@@ -54,6 +58,7 @@ bool SupportStructure::createMeshAPIsStandAlone(int argc, char **argv)
     mBuildPlateNormal[2] = 1.1;
     mOutputFields = "";
     mNeighborSearchRadius=2;
+    mNumThreads=0; // use all hardware threads
 
     stk::ParallelMachine *comm = new stk::ParallelMachine(stk::parallel_machine_init(&argc, &argv));
     if(!comm)
@@ -103,6 +108,8 @@ bool SupportStructure::run()
             return_val = runPrivateNodeBasedMaxDensityAbove();
         else if(mAlgorithm == 4)
             return_val = runPrivateNodeBasedMaxDensityAboveTopDown();
+        else if(mAlgorithm == 6)
+            return_val = runPrivateVoxelBasedStreaming();
         else
             return_val = runPrivateVoxelBasedInefficientMemory();
     }
@@ -1816,6 +1823,167 @@ void SupportStructure::getNodeInterfaceData(std::map<stk::mesh::Entity, double>
     }
 }
 
+bool SupportStructure::getElementInterfaceNormal(stk::mesh::Entity aElement, Vector3D &aInterfaceNormal)
+{
+    double tolerance = 1e-12;
+    bool allNodesInside = true;
+    bool allNodesOutside = true;
+    stk::mesh::Entity const *elemNodes = mSTKMeshIn->bulk_data()->begin_nodes(aElement);
+    int numNodes = mSTKMeshIn->bulk_data()->num_nodes(aElement);
+    for(int j=0; j<numNodes; ++j)
+    {
+        double designVariableValue = mSTKMeshIn->getMaxNodalIsoFieldVariable(elemNodes[j].m_value);
+        if((designVariableValue + tolerance) >= mDesignFieldThresholdValue)
+            allNodesOutside = false;
+        else
+            allNodesInside = false;
+    }
+    if(allNodesInside || allNodesOutside)
+        return false;
+
+    Vector3D interfaceOrigin;
+    std::vector<Vector3D> triPoints;
+    if(!getIntersectionInfo(aElement, FIELD_DENSITY, aInterfaceNormal, interfaceOrigin, triPoints))
+        return false;
+
+    // Only interfaces pointing toward the build plate affect things later on.
+    return (aInterfaceNormal % mBuildPlateNormal) < 0.0;
+}
+
+void SupportStructure::getSlabNodeInterfaceData(std::vector<stk::mesh::Entity> &aSlabNodes,
+                                                std::map<stk::mesh::Entity, double> &aNodeInterfaceAngles)
+{
+    // Same averaging as getNodeInterfaceData but only for the nodes of one slab. Element
+    // normals are cached for the slab since neighboring slab nodes share elements.
+    std::map<stk::mesh::Entity, std::pair<bool, Vector3D> > elementNormals;
+    for(size_t n=0; n<aSlabNodes.size(); ++n)
+    {
+        stk::mesh::Entity curNode = aSlabNodes[n];
+        stk::mesh::Entity const *nodeElements = mSTKMeshIn->bulk_data()->begin_elements(curNode);
+        int numElems = mSTKMeshIn->bulk_data()->num_elements(curNode);
+        Vector3D averageNormal;
+        averageNormal[0] = averageNormal[1] = averageNormal[2] = 0.0;
+        double numInterfaceNeighbors = 0.0;
+        for(int q=0; q<numElems; ++q)
+        {
+            stk::mesh::Entity curNeighborElem = nodeElements[q];
+            std::map<stk::mesh::Entity, std::pair<bool, Vector3D> >::iterator curNeighborIter = elementNormals.find(curNeighborElem);
+            if(curNeighborIter == elementNormals.end())
+            {
+                Vector3D interfaceNormal;
+                bool isInterface = getElementInterfaceNormal(curNeighborElem, interfaceNormal);
+                curNeighborIter = elementNormals.insert(std::make_pair(curNeighborElem, std::make_pair(isInterface, interfaceNormal))).first;
+            }
+            if(curNeighborIter->second.first)
+            {
+                numInterfaceNeighbors += 1.0;
+                averageNormal += curNeighborIter->second.second;
+            }
+        }
+        if(numInterfaceNeighbors > 0.1)
+        {
+            averageNormal.normalize();
+            aNodeInterfaceAngles[curNode] = averageNormal % mBuildPlateNormal;
+        }
+    }
+}
+
+void SupportStructure::getNodesBucketedByZLayer(Vector3D &aOrigin,
+                                                Vector3D &aAxis,
+                                                double aAverageEdgeLength,
+                                                std::vector<size_t> &aLayerOffsets,
+                                                std::vector<stk::mesh::Entity> &aLayerNodes,
+                                                double &zMax, double &zStep, int &aNumZLayers)
+{
+    stk::mesh::Selector myNodeSelector = mSTKMeshIn->meta_data()->universal_part();
+    stk::mesh::BucketVector const &nodeBuckets = mSTKMeshIn->bulk_data()->get_buckets(
+            stk::topology::NODE_RANK, myNodeSelector );
+
+    // Find the z extents without sorting the nodes.
+    size_t numNodes = 0;
+    double zMin = 0.0;
+    zMax = 0.0;
+    for ( stk::mesh::BucketVector::const_iterator nodeBucketIter = nodeBuckets.begin();
+            nodeBucketIter != nodeBuckets.end();
+            ++nodeBucketIter )
+    {
+        stk::mesh::Bucket &tmpBucket = **nodeBucketIter;
+        size_t numBucketNodes = tmpBucket.size();
+        for (size_t i=0; i<numBucketNodes; ++i)
+        {
+            Vector3D curNodeCoords;
+            mSTKMeshIn->nodeCoordinates(tmpBucket[i], curNodeCoords.data());
+            double dot = (curNodeCoords - aOrigin) % aAxis;
+            if(numNodes == 0 || dot < zMin)
+                zMin = dot;
+            if(numNodes == 0 || dot > zMax)
+                zMax = dot;
+            numNodes++;
+        }
+    }
+
+    aLayerOffsets.assign(1, 0);
+    aLayerNodes.clear();
+    aNumZLayers = 0;
+    zStep = 0.0;
+    if(numNodes == 0)
+        return;
+
+    // Same layer extents as runPrivateVoxelBasedInefficientMemory.
+    zMax += 1e-4;
+    zMin -= 1e-4;
+    aNumZLayers = (int)(((zMax-zMin)/aAverageEdgeLength) + 1.0);
+    zStep = (zMax - zMin) / (double)aNumZLayers;
+
+    // Counting sort of the nodes by layer. A node belongs to the first layer
+    // zLayer with nodeZ > zMax - (zLayer+1)*zStep.
+    std::vector<int> nodeLayers;
+    nodeLayers.reserve(numNodes);
+    aLayerOffsets.assign(aNumZLayers+1, 0);
+    for ( stk::mesh::BucketVector::const_iterator nodeBucketIter = nodeBuckets.begin();
+            nodeBucketIter != nodeBuckets.end();
+            ++nodeBucketIter )
+    {
+        stk::mesh::Bucket &tmpBucket = **nodeBucketIter;
+        size_t numBucketNodes = tmpBucket.size();
+        for (size_t i=0; i<numBucketNodes; ++i)
+        {
+            Vector3D curNodeCoords;
+            mSTKMeshIn->nodeCoordinates(tmpBucket[i], curNodeCoords.data());
+            double dot = (curNodeCoords - aOrigin) % aAxis;
+            int zLayer = (int)((zMax - dot)/zStep);
+            if(zLayer < 0)
+                zLayer = 0;
+            while(zLayer > 0 && dot > zMax - zLayer*zStep)
+                zLayer--;
+            while(zLayer < aNumZLayers && !(dot > zMax - (zLayer+1)*zStep))
+                zLayer++;
+            nodeLayers.push_back(zLayer);
+            if(zLayer < aNumZLayers)
+                aLayerOffsets[zLayer+1]++;
+        }
+    }
+    for(int zLayer=0; zLayer<aNumZLayers; ++zLayer)
+        aLayerOffsets[zLayer+1] += aLayerOffsets[zLayer];
+
+    std::vector<size_t> insertPosition(aLayerOffsets.begin(), aLayerOffsets.end()-1);
+    aLayerNodes.resize(aLayerOffsets[aNumZLayers]);
+    size_t nodeIndex = 0;
+    for ( stk::mesh::BucketVector::const_iterator nodeBucketIter = nodeBuckets.begin();
+            nodeBucketIter != nodeBuckets.end();
+            ++nodeBucketIter )
+    {
+        stk::mesh::Bucket &tmpBucket = **nodeBucketIter;
+        size_t numBucketNodes = tmpBucket.size();
+        for (size_t i=0; i<numBucketNodes; ++i, ++nodeIndex)
+        {
+            int zLayer = nodeLayers[nodeIndex];
+            if(zLayer < aNumZLayers)
+                aLayerNodes[insertPosition[zLayer]++] = tmpBucket[i];
+        }
+    }
+}
+
 void SupportStructure::getNodeXY(stk::mesh::Entity &aNode, Vector3D &aOrigin, Vector3D &aXAxis,
                                  Vector3D &aYAxis, Vector3D &aMinCoords, double &aGridSizeX,
                                  double &aGridSizeY, int &aNumGridX, int &aNumGridY, int &aNodeX,
@@ -2207,15 +2375,9 @@ void SupportStructure::setVoxelDataByNeighbor(int aXIndex, int aYIndex, int aNum
                                     int aZLayer,
                                     int aNumZLayers)
 {
-    double tolerance = 1e-12;
     double curDensity=0.0;
     double curDot=0.0;
     bool hasInterface = false;
-    int aboveLayerIndex = aZLayer-1;
-    VoxelData aboveVoxelData;
-    if(aboveLayerIndex >= 0)
-        aboveVoxelData = aVoxelData[aboveLayerIndex][aXIndex][aYIndex];
-    VoxelData &curVoxelData = aVoxelData[aZLayer][aXIndex][aYIndex];
 
     if(aXIndex == 32 && aYIndex == 29)
     {
@@ -2223,6 +2385,25 @@ void SupportStructure::setVoxelDataByNeighbor(int aXIndex, int aYIndex, int aNum
         ff++;
     }
 
+    if(!getVoxelValuesFromNeighbors(aXIndex, aYIndex, aNumGridX, aNumGridY, aVoxelData, aZLayer, aNumZLayers,
+                                    curDensity, curDot, hasInterface))
+        std::cout << "****** Didn't find any voxel neighbors for interpolating density values! *********" << std::endl;
+
+    setVoxelDataByValues(aXIndex, aYIndex, aVoxelData, aZLayer, curDensity, curDot, hasInterface);
+}
+
+bool SupportStructure::getVoxelValuesFromNeighbors(int aXIndex, int aYIndex, int aNumGridX, int aNumGridY,
+                                    const std::vector<std::vector<std::vector<VoxelData> > > &aVoxelData,
+                                    int aZLayer,
+                                    int aNumZLayers,
+                                    double &aDensity,
+                                    double &aDot,
+                                    bool &aHasInterface)
+{
+    aDensity=0.0;
+    aDot=0.0;
+    aHasInterface = false;
+
     // Get values for density, dot, and has interface from neighbors
     int imin=aXIndex-mNeighborSearchRadius;
     if(imin<0)
@@ -2277,14 +2458,32 @@ void SupportStructure::setVoxelDataByNeighbor(int aXIndex, int aYIndex, int aNum
     }
     if(numFound > .1)
     {
-        curDensity = weightedAverageDensity/sumDensityWeights;
+        aDensity = weightedAverageDensity/sumDensityWeights;
         if(sumDotWeights > .00001 && (weightedAverageHasInterface/sumDotWeights) > 0.5)
-            hasInterface = true;
+            aHasInterface = true;
         if(sumDotWeights > .00001)
-            curDot = weightedAverageDot/sumDotWeights;
+            aDot = weightedAverageDot/sumDotWeights;
+        return true;
     }
-    else
-        std::cout << "****** Didn't find any voxel neighbors for interpolating density values! *********" << std::endl;
+    return false;
+}
+
+void SupportStructure::setVoxelDataByValues(int aXIndex, int aYIndex,
+                                    std::vector<std::vector<std::vector<VoxelData> > > &aVoxelData,
+                                    int aZLayer,
+                                    double aDensity,
+                                    double aDot,
+                                    bool aHasInterface)
+{
+    double tolerance = 1e-12;
+    double curDensity=aDensity;
+    double curDot=aDot;
+    bool hasInterface=aHasInterface;
+    int aboveLayerIndex = aZLayer-1;
+    VoxelData aboveVoxelData;
+    if(aboveLayerIndex >= 0)
+        aboveVoxelData = aVoxelData[aboveLayerIndex][aXIndex][aYIndex];
+    VoxelData &curVoxelData = aVoxelData[aZLayer][aXIndex][aYIndex];
 
     // Now set values based on current and above values
     if(aboveLayerIndex >= 0)
@@ -3175,6 +3374,210 @@ bool SupportStructure::runPrivateVoxelBasedInefficientMemory()
     return true;
 }
 
+// Split the rows [0,aNumRows) into contiguous ranges, one per thread.
+static void forEachRowRange(int aNumRows, int aNumThreads, const std::function<void(int,int)> &aRowRangeFunction)
+{
+    int numThreads = std::max(1, std::min(aNumThreads, aNumRows));
+    if(numThreads == 1)
+    {
+        aRowRangeFunction(0, aNumRows);
+        return;
+    }
+    int rowsPerThread = (aNumRows + numThreads - 1) / numThreads;
+    std::vector<std::thread> threads;
+    for(int t=0; t<numThreads; ++t)
+    {
+        int rowBegin = std::min(aNumRows, t*rowsPerThread);
+        int rowEnd = std::min(aNumRows, rowBegin+rowsPerThread);
+        threads.push_back(std::thread(aRowRangeFunction, rowBegin, rowEnd));
+    }
+    for(size_t t=0; t<threads.size(); ++t)
+        threads[t].join();
+}
+
+bool SupportStructure::runPrivateVoxelBasedStreaming()
+{
+    // Get the build direction.
+    std::string workingString = mBuildPlateNormalString;
+    size_t spacePos = workingString.find(' ');
+    int cntr = 0;
+    while(spacePos != std::string::npos)
+    {
+        std::string cur_string = workingString.substr(0,spacePos);
+        workingString = workingString.substr(spacePos+1);
+        mBuildPlateNormal[cntr] = std::atof(cur_string.c_str());
+        cntr++;
+        spacePos = workingString.find(' ');
+    }
+    mBuildPlateNormal[cntr] = std::atof(workingString.c_str());
+    mBuildPlateNormal.normalize();
+
+    // Define a coordinate system with z axis being the
+    // build plate normal and x and y defined arbitrarily.
+    if(mSTKMeshIn->bulk_data()->parallel_rank() == 0)
+        std::cout << "Calculating coordinate system based on build plate normal. " << std::endl;
+    Vector3D xAxis, yAxis, zAxis, origin;
+    if(!getBuildPlateCoordinateSystem(xAxis, yAxis, zAxis, origin))
+    {
+        // error message
+        return false;
+    }
+
+    // Get the average edge size
+    if(mSTKMeshIn->bulk_data()->parallel_rank() == 0)
+        std::cout << "Calculating average edge length. " << std::endl;
+    double averageEdgeLength;
+    getAverageEdgeLength(averageEdgeLength);
+    averageEdgeLength *= mCellSizeMultiplier;
+
+    // Setup up voxel layer based on the average mesh size.
+    if(mSTKMeshIn->bulk_data()->parallel_rank() == 0)
+        std::cout << "Set up voxel dimensions for traversal. " << std::endl;
+    int numGridX, numGridY;
+    double gridSizeX, gridSizeY;
+    Vector3D minCoords, maxCoords;
+    getGridDimensions(averageEdgeLength, origin, xAxis, yAxis, numGridX, numGridY, minCoords, maxCoords,
+                      gridSizeX, gridSizeY);
+
+    // Bucket nodes by layer instead of sorting them all.
+    if(mSTKMeshIn->bulk_data()->parallel_rank() == 0)
+        std::cout << "Bucketing nodes by layer in build plate direction. " << std::endl;
+    std::vector<size_t> layerOffsets;
+    std::vector<stk::mesh::Entity> layerNodes;
+    double zMax, zStep;
+    int numZLayers;
+    getNodesBucketedByZLayer(origin, zAxis, averageEdgeLength, layerOffsets, layerNodes, zMax, zStep, numZLayers);
+    std::cout << "Number grid x: " << numGridX << std::endl;
+    std::cout << "Number grid y: " << numGridY << std::endl;
+    std::cout << "Number grid z: " << numZLayers << std::endl;
+
+    int numThreads = mNumThreads;
+    if(numThreads <= 0)
+        numThreads = std::max(1, (int)std::thread::hardware_concurrency());
+
+    // Only the layers within the neighbor search radius of the current layer are kept. The
+    // window holds layers windowStart to windowStart+voxelWindow.size()-1; layers above the
+    // current one are already processed and layers below only hold node data.
+    std::vector<std::vector<std::vector<VoxelData> > > voxelWindow;
+    int windowStart = 0;
+    int nextLayerToLoad = 0;
+    std::vector<double> neighborDensity(numGridX*numGridY);
+    std::vector<double> neighborDot(numGridX*numGridY);
+    std::vector<char> neighborHasInterface(numGridX*numGridY);
+    std::vector<char> neighborFound(numGridX*numGridY);
+
+    for(int zLayer=0; zLayer < numZLayers; ++zLayer)
+    {
+        // Drop layers that are no longer within reach, keeping at least the layer above.
+        while(windowStart < zLayer - std::max(mNeighborSearchRadius, 1))
+        {
+            voxelWindow.erase(voxelWindow.begin());
+            windowStart++;
+        }
+
+        // Load node data for the layers now within reach.
+        while(nextLayerToLoad < numZLayers && nextLayerToLoad <= zLayer + mNeighborSearchRadius)
+        {
+            voxelWindow.push_back(std::vector<std::vector<VoxelData> >(numGridX, std::vector<VoxelData>(numGridY)));
+            int localLayer = nextLayerToLoad - windowStart;
+            for(int i=0; i<numGridX; ++i)
+                for(int j=0; j<numGridY; ++j)
+                    voxelWindow[localLayer][i][j].dataExists = false;
+
+            std::vector<stk::mesh::Entity> slabNodes(layerNodes.begin()+layerOffsets[nextLayerToLoad],
+                                                     layerNodes.begin()+layerOffsets[nextLayerToLoad+1]);
+            std::map<stk::mesh::Entity, double> slabInterfaceAngles;
+            getSlabNodeInterfaceData(slabNodes, slabInterfaceAngles);
+
+            // Visit the slab nodes from the top down so the lowest node in a voxel wins,
+            // as it does when all nodes are sorted.
+            std::vector<std::pair<stk::mesh::Entity, double> > slabNodeDistancePairs;
+            for(size_t n=0; n<slabNodes.size(); ++n)
+            {
+                Vector3D curNodeCoords;
+                mSTKMeshIn->nodeCoordinates(slabNodes[n], curNodeCoords.data());
+                slabNodeDistancePairs.push_back(std::make_pair(slabNodes[n], (curNodeCoords - origin) % zAxis));
+            }
+            std::sort(slabNodeDistancePairs.begin(), slabNodeDistancePairs.end(), comparePairs);
+            for(std::vector<std::pair<stk::mesh::Entity, double> >::reverse_iterator riter = slabNodeDistancePairs.rbegin();
+                riter != slabNodeDistancePairs.rend(); ++riter)
+            {
+                stk::mesh::Entity curNode = riter->first;
+                int nodeX, nodeY;
+                getNodeXY(curNode, origin, xAxis, yAxis, minCoords, gridSizeX, gridSizeY,
+                          numGridX, numGridY, nodeX, nodeY);
+                setVoxelNodeData(curNode, nodeX, nodeY, voxelWindow, slabInterfaceAngles, localLayer);
+            }
+            nextLayerToLoad++;
+        }
+
+        std::cout << "Layer: " << zLayer << std::endl;
+        int localLayer = zLayer - windowStart;
+        int numWindowLayers = (int)voxelWindow.size();
+
+        // Interpolate voxels without nodes from the node data of the current layer before
+        // any voxel of it is updated, so the result does not depend on the traversal order.
+        forEachRowRange(numGridX, numThreads, [&](int aRowBegin, int aRowEnd)
+        {
+            for(int i=aRowBegin; i<aRowEnd; ++i)
+            {
+                for(int j=0; j<numGridY; ++j)
+                {
+                    int index = i*numGridY + j;
+                    if(voxelWindow[localLayer][i][j].setByNode == false)
+                    {
+                        double density, dot;
+                        bool hasInterface;
+                        neighborFound[index] = getVoxelValuesFromNeighbors(i, j, numGridX, numGridY, voxelWindow, localLayer,
+                                                                           numWindowLayers, density, dot, hasInterface);
+                        neighborDensity[index] = density;
+                        neighborDot[index] = dot;
+                        neighborHasInterface[index] = hasInterface;
+                    }
+                }
+            }
+        });
+
+        // Each voxel only reads the layer above and writes itself and its own nodes.
+        forEachRowRange(numGridX, numThreads, [&](int aRowBegin, int aRowEnd)
+        {
+            for(int i=aRowBegin; i<aRowEnd; ++i)
+            {
+                for(int j=0; j<numGridY; ++j)
+                {
+                    int index = i*numGridY + j;
+                    if(voxelWindow[localLayer][i][j].setByNode == true)
+                        setVoxelDataByNode(i, j, voxelWindow, localLayer);
+                    else
+                        setVoxelDataByValues(i, j, voxelWindow, localLayer, neighborDensity[index],
+                                             neighborDot[index], neighborHasInterface[index]);
+                }
+            }
+        });
+
+        int numNotSetByNodes=0;
+        int numNotFound=0;
+        for(int i=0; i<numGridX; ++i)
+        {
+            for(int j=0; j<numGridY; ++j)
+            {
+                if(voxelWindow[localLayer][i][j].setByNode == false)
+                {
+                    numNotSetByNodes++;
+                    if(!neighborFound[i*numGridY + j])
+                        numNotFound++;
+                }
+            }
+        }
+        std::cout << "Num voxels without nodes: " << numNotSetByNodes << std::endl;
+        if(numNotFound > 0)
+            std::cout << "****** Didn't find any voxel neighbors for interpolating density values of " << numNotFound << " voxels! *********" << std::endl;
+    }
+
+    mSTKMeshIn->write_exodus_mesh(mMeshOut, mConcatenateResults);
+    return true;
+}
+
 bool SupportStructure::runPrivateNodeBasedMaxDensityAboveTopDown()
 {
     // Get the build direction.
@@ -4381,8 +4784,9 @@ bool SupportStructure::readCommandLine( int argc, char *argv[])
     clp.setOption("time_step",  &mTimeStep, "specify the time step to be read from the file.", false );
     clp.setOption("output_fields",  &mOutputFields, "specify the fields (commma separated, no spaces) to output in the output mesh.", false );
     clp.setOption("build_plate_normal",  &mBuildPlateNormalString, "specify the normal of the build plate (values separated by spaces)", false );
-    clp.setOption("algorithm",  &mAlgorithm, "specify the algorithm to use (0=nodal based (default), 1=element based, 2=project triangles)", false );
+    clp.setOption("algorithm",  &mAlgorithm, "specify the algorithm to use (0=nodal based (default), 1=element based, 2=project triangles, 6=voxel based streamed one layer at a time)", false );
     clp.setOption("neighbor_search_radius",  &mNeighborSearchRadius, "specify the number of layers to expand search for voxel neighbors (default=2)", false );
+    clp.setOption("num_threads",  &mNumThreads, "specify the number of threads used within a voxel layer by the streaming algorithm (default=0, all hardware threads)", false );
 
     Teuchos::CommandLineProcessor::EParseCommandLineReturn parseReturn =
             Teuchos::CommandLineProcessor::PARSE_SUCCESSFUL;
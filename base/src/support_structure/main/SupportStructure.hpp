@@ -151,6 +151,19 @@ private:
                                 std::vector<std::vector<std::vector<VoxelData> > > &aVoxelData,
                                 int aZLayer,
                                 int aNumZLayers);
+    bool getVoxelValuesFromNeighbors(int aXIndex, int aYIndex, int aNumGridX, int aNumGridY,
+                                     const std::vector<std::vector<std::vector<VoxelData> > > &aVoxelData,
+                                     int aZLayer,
+                                     int aNumZLayers,
+                                     double &aDensity,
+                                     double &aDot,
+                                     bool &aHasInterface);
+    void setVoxelDataByValues(int aXIndex, int aYIndex,
+                              std::vector<std::vector<std::vector<VoxelData> > > &aVoxelData,
+                              int aZLayer,
+                              double aDensity,
+                              double aDot,
+                              bool aHasInterface);
     void setVoxelDataByNode(int aXIndex, int aYIndex,
                             std::vector<std::vector<std::vector<VoxelData> > > &aVoxelData,
                             int aZLayer);
@@ -194,6 +207,15 @@ private:
                    double &aGridSizeY, int &aNumGridX, int &aNumGridY, int &aNodeX,
                    int &aNodeY);
     void getNodeInterfaceData(std::map<stk::mesh::Entity, double> &aNodeInterfaceAngles);
+    bool getElementInterfaceNormal(stk::mesh::Entity aElement, Vector3D &aInterfaceNormal);
+    void getSlabNodeInterfaceData(std::vector<stk::mesh::Entity> &aSlabNodes,
+                                  std::map<stk::mesh::Entity, double> &aNodeInterfaceAngles);
+    void getNodesBucketedByZLayer(Vector3D &aOrigin,
+                                  Vector3D &aAxis,
+                                  double aAverageEdgeLength,
+                                  std::vector<size_t> &aLayerOffsets,
+                                  std::vector<stk::mesh::Entity> &aLayerNodes,
+                                  double &zMax, double &zStep, int &aNumZLayers);
     void getGridDimensions(double &aAverageEdgeLength, Vector3D &aOrigin,
                            Vector3D &aXAxis, Vector3D &aYAxis, int &aNumGridX, int &aNumGridY,
                            Vector3D &aMinCoords, Vector3D &aMaxCoords,
@@ -206,6 +228,7 @@ private:
     bool getBuildPlateCoordinateSystem(Vector3D &aX, Vector3D &aY, Vector3D &aZ, Vector3D &origin);
     bool runPrivateVoxelBased();
     bool runPrivateVoxelBasedInefficientMemory();
+    bool runPrivateVoxelBasedStreaming();
     bool runPrivateNodeBased();
     bool runPrivateElementBased();
     bool runPrivateProjectTriangle();
@@ -272,6 +295,7 @@ private:
     int mTimeStep;
     int mAlgorithm;
     int mNeighborSearchRadius;
+    int mNumThreads;
     MeshWrapper *mSTKMeshIn;
     MeshWrapper *mSTKMeshOut;
 };
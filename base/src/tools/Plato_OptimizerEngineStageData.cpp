@@ -63,6 +63,7 @@ OptimizerEngineStageData::OptimizerEngineStageData() :
         mOutputDiagnosticsToFile(true),
         mDisablePostSmoothing(false),
         mResetAlgorithmOnUpdate(false),
+        mDerivativeCheckerBatchedEvaluations(false),
         mMaxNumAugLagSubProbIter(5),
         mMaxNumIterations(500),
         mDerivativeCheckerFinalSuperscript(8),
@@ -319,6 +320,20 @@ void OptimizerEngineStageData::setDerivativeCheckerInitialSuperscript(const int
     mDerivativeCheckerInitialSuperscript = aInput;
 }
 
+/******************************************************************************/
+bool OptimizerEngineStageData::getDerivativeCheckerBatchedEvaluations() const
+/******************************************************************************/
+{
+    return (mDerivativeCheckerBatchedEvaluations);
+}
+
+/******************************************************************************/
+void OptimizerEngineStageData::setDerivativeCheckerBatchedEvaluations(const bool & aInput)
+/******************************************************************************/
+{
+    mDerivativeCheckerBatchedEvaluations = aInput;
+}
+
 /******************************************************************************/
 std::vector<double> OptimizerEngineStageData::getInitialGuess() const
 /******************************************************************************/
@@ -120,6 +120,8 @@ public:
     void setDerivativeCheckerFinalSuperscript(const int & aInput);
     int getDerivativeCheckerInitialSuperscript() const;
     void setDerivativeCheckerInitialSuperscript(const int & aInput);
+    bool getDerivativeCheckerBatchedEvaluations() const;
+    void setDerivativeCheckerBatchedEvaluations(const bool & aInput);
 
     std::vector<double> getInitialGuess() const;
     void setInitialGuess(const std::vector<double> & aInput);
@@ -507,6 +509,7 @@ public:
       aArchive & boost::serialization::make_nvp("OutputDiagnosticsToFile",mOutputDiagnosticsToFile);
       aArchive & boost::serialization::make_nvp("DisablePostSmoothing",mDisablePostSmoothing);
       aArchive & boost::serialization::make_nvp("ResetAlgorithmOnUpdate",mResetAlgorithmOnUpdate);
+      aArchive & boost::serialization::make_nvp("DerivativeCheckerBatchedEvaluations",mDerivativeCheckerBatchedEvaluations);
 
       aArchive & boost::serialization::make_nvp("MaxNumAugLagSubProbIter",mMaxNumAugLagSubProbIter);
       aArchive & boost::serialization::make_nvp("MaxNumIterations",mMaxNumIterations);
@@ -598,6 +601,7 @@ private:
     bool mOutputDiagnosticsToFile;
     bool mDisablePostSmoothing;
     bool mResetAlgorithmOnUpdate;
+    bool mDerivativeCheckerBatchedEvaluations;
 
     size_t mMaxNumAugLagSubProbIter;
     size_t mMaxNumIterations;
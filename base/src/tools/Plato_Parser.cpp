@@ -1070,6 +1070,17 @@ void parseOperationData(const Plato::InputData & aOperationNode, Plato::Operatio
 
 }
 
+/******************************************************************************/
+void parseSkipUnchangedInputs(const Plato::InputData & aOperationNode, Plato::OperationInputDataMng & aOperationData)
+/******************************************************************************/
+{
+    // Optional: skip the compute when the performer's input fields did not change since its last compute
+    if(aOperationNode.size<std::string>("SkipUnchangedInputs"))
+    {
+        aOperationData.set<std::string>("SkipUnchangedInputs", aOperationNode.get<std::string>("SkipUnchangedInputs"));
+    }
+}
+
 /******************************************************************************/
 void parseStageOperations(const Plato::InputData & aStageNode, Plato::StageInputDataMng & aStageInputDataMng)
 /******************************************************************************/
@@ -1094,12 +1105,14 @@ void parseStageOperations(const Plato::InputData & aStageNode, Plato::StageInput
                 }
                 Plato::Parse::parseOperationData(*tSubOperationNode, tOperationInputData);
             }
+            Plato::Parse::parseSkipUnchangedInputs(*tOperationNode, tOperationInputData);
             aStageInputDataMng.addOperationInputData(tStageName, tOperationInputData);
         }
         else
         {
             Plato::OperationInputDataMng tOperationInputData;
             Plato::Parse::parseOperationData(*tOperationNode, tOperationInputData);
+            Plato::Parse::parseSkipUnchangedInputs(*tOperationNode, tOperationInputData);
             aStageInputDataMng.addOperationInputData(tStageName, tOperationInputData);
         }
     }
@@ -1133,6 +1146,12 @@ void parseStageData(const Plato::InputData & aStageNode, Plato::StageInputDataMn
 
     aStageInputDataMng.add(tStageName, tSharedDataNameInputs, tSharedDataNameOutputs);
 
+    // Optional: post all stage transfers at once and wait on them together
+    if(aStageNode.size<std::string>("BatchTransmission"))
+    {
+        aStageInputDataMng.set<std::string>("BatchTransmission", aStageNode.get<std::string>("BatchTransmission"));
+    }
+
     Plato::Parse::parseStageOperations(aStageNode, aStageInputDataMng);
 }
 
@@ -1470,6 +1489,11 @@ void parseOptimizerOptions(const Plato::InputData & aOptimizerNode, Plato::Optim
             int tInitialSuperscript = Plato::Get::Int(tOptionsNode, "DerivativeCheckerInitialSuperscript");
             aOptimizerEngineStageData.setDerivativeCheckerInitialSuperscript(tInitialSuperscript);
         }
+        if( tOptionsNode.size<std::string>("DerivativeCheckerBatchedEvaluations") )
+        {
+            bool tBatchedEvaluations = Plato::Get::Bool(tOptionsNode, "DerivativeCheckerBatchedEvaluations");
+            aOptimizerEngineStageData.setDerivativeCheckerBatchedEvaluations(tBatchedEvaluations);
+        }
 
         if( tOptionsNode.size<std::string>("GCMMAInitialMovingAsymptoteScaleFactor") )
         {
@@ -199,6 +199,7 @@ void parseConstraintReferenceValues(const Plato::InputData & aOptimizationNode,
 void parseConstraintReferenceValueNames(const Plato::InputData & aOptimizationNode, Plato::OptimizerEngineStageData & aOptimizerEngineStageData);
 
 void parseOperationData(const Plato::InputData & aOperationNode, Plato::OperationInputDataMng & aOperationData);
+void parseSkipUnchangedInputs(const Plato::InputData & aOperationNode, Plato::OperationInputDataMng & aOperationData);
 
 void parseObjectiveStagesData(const Plato::InputData & aObjectiveNode, Plato::OptimizerEngineStageData & aOptimizerEngineStageData);
 
@@ -60,6 +60,7 @@ TimersTree::TimersTree(const MPI_Comm& aLocalComm,
         m_num_keys(num_keys),
         m_accumulated_times_by_key(num_keys + 1, 0.0),
         m_num_entrances_by_key(num_keys + 1, 0u),
+        m_counts_by_key(num_keys + 1, 0u),
         m_stack_of_keys_and_times(),
         m_consider_partition(num_keys + 1, true),
         m_just_incrementing(false)
@@ -146,6 +147,25 @@ bool TimersTree::end_partition()
     return true;
 }
 
+bool TimersTree::add_count(const int partition, const size_t count)
+{
+    // only proceed on rank 0
+    int rank = -1;
+    MPI_Comm_rank(mLocalComm, &rank);
+    if(rank != 0)
+    {
+        return false;
+    }
+
+    if(partition < 0 || partition > m_num_keys)
+    {
+        return false;
+    }
+
+    m_counts_by_key[partition] += count;
+    return true;
+}
+
 bool TimersTree::print_results()
 {
     // only proceed on rank 0
@@ -179,12 +199,14 @@ bool TimersTree::print_results()
     const int time_width = 15;
     const int percentage_width = 15;
     const int entrances_width = 15;
+    const int counts_width = 15;
 
     std::cout << "Plato Timers:" << std::endl;
     std::cout << std::left << std::setw(partition_width) << "partition" << "|"
               << std::setw(time_width) << "seconds" << "|"
               << std::setw(percentage_width) << "percentage" << "|"
-              << std::setw(entrances_width) << "entrances" << std::endl;
+              << std::setw(entrances_width) << "entrances" << "|"
+              << std::setw(counts_width) << "counts" << std::endl;
 
     for(int partition_index = 0; partition_index <= m_num_keys; partition_index++)
     {
@@ -199,7 +221,8 @@ bool TimersTree::print_results()
         std::cout << std::left << std::setw(partition_width) << this_partition_name << "|"
                   << std::setw(time_width) << m_accumulated_times_by_key[partition_index] << "|"
                   << std::setw(percentage_width) << this_percentage << "|"
-                  << std::setw(entrances_width) << m_num_entrances_by_key[partition_index] << std::endl;
+                  << std::setw(entrances_width) << m_num_entrances_by_key[partition_index] << "|"
+                  << std::setw(counts_width) << m_counts_by_key[partition_index] << std::endl;
     }
 
     return true;
@@ -260,6 +283,21 @@ std::vector<size_t> TimersTree::unit_testing_get_entrances() const
     return result;
 }
 
+std::vector<size_t> TimersTree::unit_testing_get_counts() const
+{
+    // only proceed on rank 0
+    int rank = -1;
+    MPI_Comm_rank(mLocalComm, &rank);
+    if(rank != 0)
+    {
+        std::vector<size_t> empty_result;
+        return empty_result;
+    }
+
+    std::vector<size_t> result(m_counts_by_key.begin(), m_counts_by_key.end());
+    return result;
+}
+
 #define PLATO_TIMERSTREE_PARTITION_CASE(name) \
         case timer_partition_t::timer_partition_t::name: \
         { \
@@ -276,6 +314,8 @@ const char* TimersTree::get_string_from_partition_enum(const int partition) cons
         PLATO_TIMERSTREE_PARTITION_CASE(file_input_output)
         PLATO_TIMERSTREE_PARTITION_CASE(physics_compute)
         PLATO_TIMERSTREE_PARTITION_CASE(aggregator)
+        PLATO_TIMERSTREE_PARTITION_CASE(linear_solver_setup)
+        PLATO_TIMERSTREE_PARTITION_CASE(linear_solver_solve)
         case timer_partition_t::timer_partition_t::TOTAL_NUM_KEYS:
         {
             return "uncategorized";
@@ -60,6 +60,8 @@ enum timer_partition_t
     file_input_output,
     physics_compute,
     aggregator,
+    linear_solver_setup,
+    linear_solver_solve,
     TOTAL_NUM_KEYS
 };
 }
@@ -73,12 +75,15 @@ public:
 
     bool begin_partition(const int partition);
     bool end_partition();
+    // accumulate a work count, such as solver iterations, against a partition
+    bool add_count(const int partition, const size_t count);
 
     bool print_results();
 
     void unit_testing_incrament();
     std::vector<double> unit_testing_get_timers() const;
     std::vector<size_t> unit_testing_get_entrances() const;
+    std::vector<size_t> unit_testing_get_counts() const;
 
 private:
     const char* get_string_from_partition_enum(const int partition) const;
@@ -87,6 +92,7 @@ private:
     int m_num_keys;
     std::vector<double> m_accumulated_times_by_key;
     std::vector<size_t> m_num_entrances_by_key;
+    std::vector<size_t> m_counts_by_key;
     std::vector<std::pair<int,double> > m_stack_of_keys_and_times;
     std::vector<bool> m_consider_partition;
 